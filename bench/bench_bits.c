@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/* Throughput of bit field extraction and insertion against the bit at a
+ * time loops they replaced, on fields of random position and of lengths
+ * typical of RTCM, SBAS and CNAV messages. */
+
+#include "bench_utils.h"
+
+#include <swiftnav/bits.h>
+
+#define BUFF_BYTES 4096
+#define N_FIELDS 1000000
+
+static u8 buff[BUFF_BYTES + 8];
+static u32 pos[N_FIELDS];
+static u8 len[N_FIELDS];
+static u32 fields[N_FIELDS];
+
+/* Previous implementation of getbitu(). */
+static u32 bitwise_getbitu(const u8 *b, u32 p, u8 l) {
+  u32 bits = 0;
+  for (u32 i = p; i < p + l; i++) {
+    bits = (bits << 1) + ((b[i / 8] >> (7 - i % 8)) & 1u);
+  }
+  return bits;
+}
+
+/* Previous implementation of getbitul(). */
+static u64 bitwise_getbitul(const u8 *b, u32 p, u8 l) {
+  u64 bits = 0;
+  for (u32 i = p; i < p + l; i++) {
+    bits = (bits << 1) + ((b[i / 8] >> (7 - i % 8)) & 1u);
+  }
+  return bits;
+}
+
+int main(void) {
+  for (size_t i = 0; i < sizeof(buff); i++) {
+    buff[i] = (u8)rand();
+  }
+  for (size_t i = 0; i < N_FIELDS; i++) {
+    len[i] = (u8)(1 + rand() % 32);
+    pos[i] = (u32)(rand() % (8 * BUFF_BYTES));
+    fields[i] = (u32)rand();
+  }
+
+  u32 sum = 0;
+  double t0 = bench_now();
+  for (size_t i = 0; i < N_FIELDS; i++) {
+    sum += bitwise_getbitu(buff, pos[i], len[i]);
+  }
+  bench_report("getbitu (bitwise)", bench_now() - t0, N_FIELDS);
+  t0 = bench_now();
+  for (size_t i = 0; i < N_FIELDS; i++) {
+    sum -= getbitu(buff, pos[i], len[i]);
+  }
+  bench_report("getbitu", bench_now() - t0, N_FIELDS);
+  if (sum != 0) {
+    fprintf(stderr, "getbitu does not match the bitwise version\n");
+    return 1;
+  }
+
+  u64 sum64 = 0;
+  t0 = bench_now();
+  for (size_t i = 0; i < N_FIELDS; i++) {
+    sum64 += bitwise_getbitul(buff, pos[i], (u8)(2 * len[i]));
+  }
+  bench_report("getbitul (bitwise)", bench_now() - t0, N_FIELDS);
+  t0 = bench_now();
+  for (size_t i = 0; i < N_FIELDS; i++) {
+    sum64 -= getbitul(buff, pos[i], (u8)(2 * len[i]));
+  }
+  bench_report("getbitul", bench_now() - t0, N_FIELDS);
+  if (sum64 != 0) {
+    fprintf(stderr, "getbitul does not match the bitwise version\n");
+    return 1;
+  }
+
+  t0 = bench_now();
+  for (size_t i = 0; i < N_FIELDS; i++) {
+    setbitu(buff, pos[i], len[i], fields[i]);
+  }
+  bench_report("setbitu", bench_now() - t0, N_FIELDS);
+  t0 = bench_now();
+  for (size_t i = 0; i < N_FIELDS; i++) {
+    setbitul(buff, pos[i], 2u * len[i], ((u64)fields[i] << 32) | fields[i]);
+  }
+  bench_report("setbitul", bench_now() - t0, N_FIELDS);
+  bench_consume(buff[0]);
+  return 0;
+}
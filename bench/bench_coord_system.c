@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/* Latency and accuracy of the ECEF to geodetic conversions.
+ *
+ * The accuracy sweep generates geodetic points, converts them to ECEF in
+ * long double precision and measures how well each method recovers the
+ * original coordinates, so the reference is independent of all of the
+ * double precision routines under test. */
+
+#include "bench_utils.h"
+
+#include <math.h>
+#include <swiftnav/constants.h>
+#include <swiftnav/coord_system.h>
+
+#define N_POINTS 1000000
+#define N_SWEEP 200000
+
+static double x[N_POINTS], y[N_POINTS], z[N_POINTS];
+static double lat[N_POINTS], lon[N_POINTS], hgt[N_POINTS];
+
+/* wgsllh2ecef() evaluated in extended precision. */
+static void llh2ecef_ref(const long double llh[3], double ecef[3]) {
+  const long double f = 1.0L / 298.257223563L;
+  const long double e2 = 2 * f - f * f;
+  const long double a = 6378137.0L;
+  const long double sin_lat = sinl(llh[0]);
+  const long double N = a / sqrtl(1 - e2 * sin_lat * sin_lat);
+  ecef[0] = (double)((N + llh[2]) * cosl(llh[0]) * cosl(llh[1]));
+  ecef[1] = (double)((N + llh[2]) * cosl(llh[0]) * sinl(llh[1]));
+  ecef[2] = (double)(((1 - e2) * N + llh[2]) * sin_lat);
+}
+
+static void bench_latency(void) {
+  srand(1);
+  for (size_t i = 0; i < N_POINTS; i++) {
+    double llh[3] = {D2R * bench_rand(-90, 90),
+                     D2R * bench_rand(-180, 180),
+                     bench_rand(-1e3, 1e4)};
+    double ecef[3];
+    wgsllh2ecef(llh, ecef);
+    x[i] = ecef[0];
+    y[i] = ecef[1];
+    z[i] = ecef[2];
+  }
+
+  const wgsecef2llh_method_t methods[] = {WGSECEF2LLH_ITERATIVE,
+                                          WGSECEF2LLH_CLOSED_FORM};
+  const char *names[] = {"wgsecef2llh (iterative)",
+                         "wgsecef2llh (closed form)"};
+  for (size_t m = 0; m < sizeof(methods) / sizeof(methods[0]); m++) {
+    double sum = 0;
+    double t = bench_now();
+    for (size_t i = 0; i < N_POINTS; i++) {
+      double ecef[3] = {x[i], y[i], z[i]};
+      double llh[3];
+      wgsecef2llh_method(ecef, llh, methods[m]);
+      sum += llh[0];
+    }
+    bench_report(names[m], bench_now() - t, N_POINTS);
+    bench_consume(sum);
+  }
+
+  double t = bench_now();
+  wgsecef2llh_batch(N_POINTS, x, y, z, lat, lon, hgt);
+  bench_report("wgsecef2llh_batch", bench_now() - t, N_POINTS);
+  bench_consume(lat[N_POINTS - 1]);
+
+  t = bench_now();
+  wgsecef2llh_batch_fast(N_POINTS, x, y, z, lat, lon, hgt);
+  bench_report("wgsecef2llh_batch_fast", bench_now() - t, N_POINTS);
+  bench_consume(lat[N_POINTS - 1]);
+
+  t = bench_now();
+  wgsllh2ecef_batch(N_POINTS, lat, lon, hgt, x, y, z);
+  bench_report("wgsllh2ecef_batch", bench_now() - t, N_POINTS);
+  bench_consume(x[N_POINTS - 1]);
+}
+
+static void bench_accuracy(void) {
+  /* Height bands from below the geoid up to geostationary orbit. */
+  const double bands[][2] = {{-1e4, 0},
+                             {0, 1e4},
+                             {1e4, 1e6},
+                             {1e6, 2.02e7},
+                             {2.02e7, 3.6e7}};
+  const wgsecef2llh_method_t methods[] = {WGSECEF2LLH_ITERATIVE,
+                                          WGSECEF2LLH_CLOSED_FORM};
+
+  printf("\n%-24s %-12s %14s %14s\n",
+         "height band [km]",
+         "method",
+         "max lat [rad]",
+         "max hgt [m]");
+  for (size_t b = 0; b < sizeof(bands) / sizeof(bands[0]); b++) {
+    for (size_t m = 0; m < sizeof(methods) / sizeof(methods[0]); m++) {
+      double max_lat_err = 0;
+      double max_hgt_err = 0;
+      srand(2);
+      for (size_t i = 0; i < N_SWEEP; i++) {
+        long double llh_ref[3] = {D2R * bench_rand(-90, 90),
+                                  D2R * bench_rand(-180, 180),
+                                  bench_rand(bands[b][0], bands[b][1])};
+        double ecef[3];
+        double llh[3];
+        llh2ecef_ref(llh_ref, ecef);
+        wgsecef2llh_method(ecef, llh, methods[m]);
+        max_lat_err = fmax(max_lat_err, fabs(llh[0] - (double)llh_ref[0]));
+        max_hgt_err = fmax(max_hgt_err, fabs(llh[2] - (double)llh_ref[2]));
+      }
+      printf("[%9.0f, %9.0f]   %-12s %14.3g %14.3g\n",
+             bands[b][0] / 1e3,
+             bands[b][1] / 1e3,
+             methods[m] == WGSECEF2LLH_ITERATIVE ? "iterative" : "closed form",
+             max_lat_err,
+             max_hgt_err);
+    }
+
+    /* The batch conversion over the same points. */
+    static long double llh_ref[N_SWEEP][2];
+    srand(2);
+    for (size_t i = 0; i < N_SWEEP; i++) {
+      long double llh[3] = {D2R * bench_rand(-90, 90),
+                            D2R * bench_rand(-180, 180),
+                            bench_rand(bands[b][0], bands[b][1])};
+      double ecef[3];
+      llh2ecef_ref(llh, ecef);
+      x[i] = ecef[0];
+      y[i] = ecef[1];
+      z[i] = ecef[2];
+      llh_ref[i][0] = llh[0];
+      llh_ref[i][1] = llh[2];
+    }
+    wgsecef2llh_batch(N_SWEEP, x, y, z, lat, lon, hgt);
+    double max_lat_err = 0;
+    double max_hgt_err = 0;
+    for (size_t i = 0; i < N_SWEEP; i++) {
+      max_lat_err = fmax(max_lat_err, fabs(lat[i] - (double)llh_ref[i][0]));
+      max_hgt_err = fmax(max_hgt_err, fabs(hgt[i] - (double)llh_ref[i][1]));
+    }
+    printf("[%9.0f, %9.0f]   %-12s %14.3g %14.3g\n",
+           bands[b][0] / 1e3,
+           bands[b][1] / 1e3,
+           "batch",
+           max_lat_err,
+           max_hgt_err);
+  }
+}
+
+int main(void) {
+  bench_latency();
+  bench_accuracy();
+  return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/* Geoid lookup throughput for scattered points and for points along a
+ * track, where consecutive points mostly fall in the same grid cell.
+ *
+ * The library, which reads heights from the padded and tiled copy of the
+ * compiled in model generated at build time, is compared with the same
+ * source built to read the original longitude major table directly. */
+
+#include "bench_utils.h"
+
+#include <math.h>
+#include <swiftnav/constants.h>
+
+#define GEOID_MODEL_FLAT_LAYOUT
+#define get_geoid_offset flat_get_geoid_offset
+#define get_geoid_offset_batch flat_get_geoid_offset_batch
+#define get_geoid_model flat_get_geoid_model
+#define set_geoid_grid flat_set_geoid_grid
+#include "src/geoid_model.c"
+#undef get_geoid_offset
+#undef get_geoid_offset_batch
+#undef get_geoid_model
+#undef set_geoid_grid
+
+float get_geoid_offset(double lat_rad, double lon_rad);
+void get_geoid_offset_batch(size_t n,
+                            const double *lat_rad,
+                            const double *lon_rad,
+                            float *offset);
+
+#define N_POINTS 1000000
+
+static double lat[N_POINTS], lon[N_POINTS];
+static float offset[N_POINTS];
+
+static void make_random(void) {
+  srand(1);
+  for (size_t i = 0; i < N_POINTS; i++) {
+    lat[i] = D2R * bench_rand(-90, 90);
+    lon[i] = D2R * bench_rand(-180, 180);
+  }
+}
+
+/* A vehicle at 30 m/s sampled at 10 Hz, about 3 m between points. */
+static void make_track(void) {
+  srand(2);
+  double la = 37.0;
+  double lo = -122.0;
+  double heading = 0.3;
+  for (size_t i = 0; i < N_POINTS; i++) {
+    heading += bench_rand(-0.01, 0.01);
+    la += 3.0 / 111e3 * cos(heading);
+    lo += 3.0 / 111e3 * sin(heading) / cos(D2R * la);
+    lat[i] = D2R * la;
+    lon[i] = D2R * lo;
+  }
+}
+
+typedef float (*offset_fn)(double lat_rad, double lon_rad);
+typedef void (*batch_fn)(size_t n,
+                         const double *lat_rad,
+                         const double *lon_rad,
+                         float *offset);
+
+static void run_one(const char *label,
+                    const char *pattern,
+                    offset_fn scalar,
+                    batch_fn batch) {
+  char name[64];
+  double sum = 0;
+  double t = bench_now();
+  for (size_t i = 0; i < N_POINTS; i++) {
+    sum += scalar(lat[i], lon[i]);
+  }
+  snprintf(name, sizeof(name), "%s (%s)", label, pattern);
+  bench_report(name, bench_now() - t, N_POINTS);
+  bench_consume(sum);
+
+  t = bench_now();
+  batch(N_POINTS, lat, lon, offset);
+  snprintf(name, sizeof(name), "%s batch (%s)", label, pattern);
+  bench_report(name, bench_now() - t, N_POINTS);
+  bench_consume(offset[N_POINTS - 1]);
+}
+
+static void run(const char *pattern) {
+  run_one("flat layout",
+          pattern,
+          flat_get_geoid_offset,
+          flat_get_geoid_offset_batch);
+  run_one("tiled layout", pattern, get_geoid_offset, get_geoid_offset_batch);
+}
+
+int main(void) {
+  make_random();
+  run("random");
+  make_track();
+  run("track");
+  return 0;
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/* Throughput of the scalar and batch time conversions on a column of
+ * timestamps as read from an observation archive: 1 Hz epochs over almost
+ * two weeks, crossing the leap second at the start of 2017. */
+
+#include "bench_utils.h"
+
+#include <swiftnav/gnss_time.h>
+
+#define N_TIMES 1000000
+
+static gps_time_t gps[N_TIMES];
+static gps_time_t gps_out[N_TIMES];
+static utc_tm utc[N_TIMES];
+static double mjd[N_TIMES];
+static double mjd_out[N_TIMES];
+
+int main(void) {
+  gps_time_t t = {.wn = 1929, .tow = 0.5};
+  for (size_t i = 0; i < N_TIMES; i++) {
+    gps[i] = t;
+    gps2utc(&t, &utc[i], NULL);
+    mjd[i] = gps2mjd(&t);
+    add_secs(&t, 1.0);
+  }
+
+  double t0 = bench_now();
+  for (size_t i = 0; i < N_TIMES; i++) {
+    mjd_out[i] = gps2mjd(&gps[i]);
+  }
+  bench_report("gps2mjd", bench_now() - t0, N_TIMES);
+  t0 = bench_now();
+  gps2mjd_batch(N_TIMES, gps, NULL, mjd_out);
+  bench_report("gps2mjd_batch", bench_now() - t0, N_TIMES);
+  bench_consume(mjd_out[N_TIMES - 1]);
+
+  t0 = bench_now();
+  for (size_t i = 0; i < N_TIMES; i++) {
+    mjd_out[i] = utc2mjd(&utc[i]);
+  }
+  bench_report("utc2mjd", bench_now() - t0, N_TIMES);
+  t0 = bench_now();
+  utc2mjd_batch(N_TIMES, utc, mjd_out);
+  bench_report("utc2mjd_batch", bench_now() - t0, N_TIMES);
+  bench_consume(mjd_out[N_TIMES - 1]);
+
+  t0 = bench_now();
+  for (size_t i = 0; i < N_TIMES; i++) {
+    gps_out[i] = mjd2gps(mjd[i]);
+  }
+  bench_report("mjd2gps", bench_now() - t0, N_TIMES);
+  t0 = bench_now();
+  mjd2gps_batch(N_TIMES, mjd, NULL, gps_out);
+  bench_report("mjd2gps_batch", bench_now() - t0, N_TIMES);
+  bench_consume(gps_out[N_TIMES - 1].tow);
+
+  t0 = bench_now();
+  for (size_t i = 0; i < N_TIMES; i++) {
+    utc2gps(&utc[i], &gps_out[i], NULL);
+  }
+  bench_report("utc2gps", bench_now() - t0, N_TIMES);
+  t0 = bench_now();
+  utc2gps_batch(N_TIMES, utc, NULL, gps_out);
+  bench_report("utc2gps_batch", bench_now() - t0, N_TIMES);
+  bench_consume(gps_out[N_TIMES - 1].tow);
+  return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/* NeQuick-G throughput for a receiver tracking a full constellation.
+ *
+ * Usage: bench_nequick [directory]
+ *
+ * With a directory containing modipNeQG_wrapped.asc and ccir11.asc to
+ * ccir22.asc the official tables are used, otherwise synthetic ones. The cost
+ * depends on the shape of the profiles but not much on the exact values. */
+
+#include "bench_utils.h"
+
+#include <math.h>
+#include <string.h>
+#include <swiftnav/constants.h>
+#include <swiftnav/nequick.h>
+
+#define N_SATS 12
+#define N_EPOCHS 200
+
+static nequick_data_t data;
+
+static bool load_data(const char *dir) {
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/modipNeQG_wrapped.asc", dir);
+  if (nequick_load_modip(&data, path) < 0) {
+    return false;
+  }
+  for (u8 m = 1; m <= 12; m++) {
+    snprintf(path, sizeof(path), "%s/ccir%u.asc", dir, m + 10);
+    if (nequick_load_ccir(&data, m, path) < 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/* Modip of a dipole field and foF2 with a diurnal variation. */
+static void make_data(void) {
+  for (u32 i = 0; i < NEQUICK_MODIP_ROWS; i++) {
+    for (u32 j = 0; j < NEQUICK_MODIP_COLS; j++) {
+      double lat = D2R * (5.0 * i - 95.0);
+      data.modip[i][j] = R2D * atan(2 * tan(lat)) * 0.9;
+    }
+  }
+  for (u32 m = 0; m < 12; m++) {
+    for (u32 r = 0; r < 2; r++) {
+      data.f2[m][r][0][0] = 7 + 3 * r;
+      data.f2[m][r][0][2] = -2;
+      data.f2[m][r][2][0] = -1.5;
+      data.f2[m][r][12][0] = 0.5;
+      data.fm3[m][r][0][0] = 3;
+      data.fm3[m][r][1][0] = 0.1;
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1 && load_data(argv[1])) {
+    printf("Official coefficient tables\n");
+  } else {
+    make_data();
+    printf("Synthetic coefficient tables\n");
+  }
+
+  static const nequick_coeffs_t coeffs = {.ai0 = 236.831, .ai1 = -0.393};
+  double rx_lat = 40 * D2R;
+  double rx_lon = 5 * D2R;
+  double lat[N_SATS], lon[N_SATS], h[N_SATS];
+  double delay[N_SATS];
+  srand(1);
+
+  /* Satellites spread over the sky, recomputed once per epoch. */
+  nequick_context_t ctx;
+  nequick_init(&ctx, &data, &coeffs);
+  double t_prepare = 0;
+  double t_batch = 0;
+  for (u32 e = 0; e < N_EPOCHS; e++) {
+    utc_tm t = {.year = 2026, .month = 1 + e % 12, .hour = e % 24};
+    for (u32 i = 0; i < N_SATS; i++) {
+      lat[i] = rx_lat + D2R * bench_rand(-50, 50);
+      lon[i] = rx_lon + D2R * bench_rand(-50, 50);
+      h[i] = 23222e3;
+    }
+    double t0 = bench_now();
+    nequick_prepare(&ctx, &t, rx_lat, rx_lon, 0);
+    double t1 = bench_now();
+    nequick_delay_batch(&ctx, N_SATS, lat, lon, h, NULL, delay);
+    double t2 = bench_now();
+    t_prepare += t1 - t0;
+    t_batch += t2 - t1;
+    bench_consume(delay[0]);
+  }
+  bench_report("nequick_prepare, new epoch", t_prepare, N_EPOCHS);
+  bench_report("nequick_delay_batch per satellite", t_batch, N_EPOCHS * N_SATS);
+
+  utc_tm t = {.year = 2026, .month = 6, .hour = 12};
+  double t0 = bench_now();
+  for (u32 e = 0; e < N_EPOCHS * 100; e++) {
+    nequick_prepare(&ctx, &t, rx_lat, rx_lon, 0);
+  }
+  bench_report("nequick_prepare, cached", bench_now() - t0, N_EPOCHS * 100);
+
+  /* Overhead of preparing the context for every satellite. */
+  t0 = bench_now();
+  for (u32 e = 0; e < N_EPOCHS; e++) {
+    for (u32 i = 0; i < N_SATS; i++) {
+      nequick_context_t fresh;
+      nequick_init(&fresh, &data, &coeffs);
+      nequick_prepare(&fresh, &t, rx_lat, rx_lon, 0);
+      nequick_delay_batch(&fresh, 1, &lat[i], &lon[i], &h[i], NULL, delay);
+      bench_consume(delay[0]);
+    }
+  }
+  bench_report("uncached per satellite", bench_now() - t0, N_EPOCHS * N_SATS);
+
+  /* Two signals per satellite share the slant TEC. */
+  double lat2[2 * N_SATS], lon2[2 * N_SATS], h2[2 * N_SATS];
+  gnss_signal_t sids[2 * N_SATS];
+  for (u32 i = 0; i < N_SATS; i++) {
+    for (u32 k = 0; k < 2; k++) {
+      lat2[2 * i + k] = lat[i];
+      lon2[2 * i + k] = lon[i];
+      h2[2 * i + k] = h[i];
+      sids[2 * i + k].sat = (u16)(i + 1);
+      sids[2 * i + k].code = k ? CODE_GAL_E5X : CODE_GAL_E1B;
+    }
+  }
+  double delay2[2 * N_SATS];
+  t0 = bench_now();
+  for (u32 e = 0; e < N_EPOCHS; e++) {
+    nequick_delay_batch(&ctx, 2 * N_SATS, lat2, lon2, h2, sids, delay2);
+    bench_consume(delay2[0]);
+  }
+  bench_report("dual frequency batch per signal",
+               bench_now() - t0,
+               N_EPOCHS * 2 * N_SATS);
+  return 0;
+}
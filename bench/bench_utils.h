@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef LIBSWIFTNAV_BENCH_UTILS_H
+#define LIBSWIFTNAV_BENCH_UTILS_H
+
+/* clock_gettime() is POSIX, not C99. Include this header first. */
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Monotonic wall clock time in seconds. */
+static inline double bench_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Uniformly distributed random number in [lo, hi]. */
+static inline double bench_rand(double lo, double hi) {
+  return lo + (hi - lo) * ((double)rand() / RAND_MAX);
+}
+
+/* Print the time per item of a benchmark run in a common format. */
+static inline void bench_report(const char *name,
+                                double seconds,
+                                size_t n_items) {
+  printf("%-40s %10.2f ns/item\n", name, seconds * 1e9 / (double)n_items);
+}
+
+static volatile double bench_sink;
+
+/* Prevent the compiler from optimising away a benchmarked result. */
+static inline void bench_consume(double x) { bench_sink = x; }
+
+#endif /* LIBSWIFTNAV_BENCH_UTILS_H */
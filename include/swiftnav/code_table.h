@@ -0,0 +1,939 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/* Properties of each code, shared by the C table in signal.c and the
+ * constexpr table in signal.hpp.
+ *
+ * This file is deliberately not include guarded. Define
+ * CODE_TABLE_ENTRY(code, constellation, sat_count, sig_count, sat_start, str,
+ *                  carr_freq, chip_count, chip_rate, requires_direct_acq,
+ *                  prn_period_ms, sv_doppler_max, phase_alignment_cycles,
+ *                  requires_data_decoder)
+ * before including it, it is undefined again at the end.
+ *
+ *  [1] RINEX3.03 Table A23
+ *      "Reference code and phase alignment by constellation and frequency band"
+ */
+
+#ifndef CODE_TABLE_ENTRY
+#error "CODE_TABLE_ENTRY must be defined before including code_table.h"
+#endif
+
+/* GPS */
+CODE_TABLE_ENTRY(CODE_GPS_L1CA,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L1CA,
+                 GPS_FIRST_PRN,
+                 "GPS L1CA",
+                 GPS_L1_HZ,
+                 GPS_L1CA_CHIPS_NUM,
+                 GPS_CA_CHIPPING_RATE,
+                 true,
+                 GPS_L1CA_PRN_PERIOD_MS,
+                 GPS_L1_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L1C in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_AUX_GPS,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L1CA,
+                 GPS_FIRST_PRN,
+                 "GPS AUX",
+                 GPS_L1_HZ,
+                 GPS_L1CA_CHIPS_NUM,
+                 GPS_CA_CHIPPING_RATE,
+                 false,
+                 GPS_L1CA_PRN_PERIOD_MS,
+                 GPS_L1_DOPPLER_MAX_HZ,
+                 0.f, /* assuming CODE_GPS_L1CA */
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L1CI,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L1C,
+                 GPS_FIRST_PRN,
+                 "GPS L1CI",
+                 GPS_L1_HZ,
+                 GPS_L1C_CHIPS_NUM,
+                 GPS_CA_CHIPPING_RATE,
+                 false,
+                 GPS_L1C_PRN_PERIOD_MS,
+                 GPS_L1_DOPPLER_MAX_HZ,
+                 0.25f, /* see L1S in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L1CQ,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L1C,
+                 GPS_FIRST_PRN,
+                 "GPS L1CQ",
+                 GPS_L1_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 GPS_L1_DOPPLER_MAX_HZ,
+                 0.25f, /* see L1L in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L1CX,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L1C,
+                 GPS_FIRST_PRN,
+                 "GPS L1C",
+                 GPS_L1_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 GPS_L1_DOPPLER_MAX_HZ,
+                 0.25f, /* see L1X in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L2CM,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L2C,
+                 GPS_FIRST_PRN,
+                 "GPS L2CM",
+                 GPS_L2_HZ,
+                 GPS_L2CM_CHIPS_NUM,
+                 GPS_CA_CHIPPING_RATE,
+                 false,
+                 GPS_L2CM_PRN_PERIOD_MS,
+                 (float)GPS_L2_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L2S in [1] */
+                 true)
+CODE_TABLE_ENTRY(CODE_GPS_L2CL,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L2C,
+                 GPS_FIRST_PRN,
+                 "GPS L2CL",
+                 GPS_L2_HZ,
+                 GPS_L2CL_CHIPS_NUM,
+                 GPS_CA_CHIPPING_RATE,
+                 false,
+                 GPS_L2CL_PRN_PERIOD_MS,
+                 (float)GPS_L2_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L2L in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L2CX,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L2C,
+                 GPS_FIRST_PRN,
+                 "GPS L2C",
+                 GPS_L2_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GPS_L2_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L2X [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L5I,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L5,
+                 GPS_FIRST_PRN,
+                 "GPS L5I",
+                 GPS_L5_HZ,
+                 GPS_L5_CHIPS_NUM,
+                 GPS_L5_CHIPPING_RATE,
+                 false,
+                 GPS_L5_PRN_PERIOD_MS,
+                 (float)GPS_L5_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L5I in [1]) */
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L5Q,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L5,
+                 GPS_FIRST_PRN,
+                 "GPS L5Q",
+                 GPS_L5_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GPS_L5_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L5Q in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L5X,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L5,
+                 GPS_FIRST_PRN,
+                 "GPS L5",
+                 GPS_L5_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GPS_L5_DOPPLER_MAX_HZ,
+                 0.f, /* must be aligned to CODE_GPS_L5I (see L5X in [1])*/
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L1P,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L1P,
+                 GPS_FIRST_PRN,
+                 "GPS L1P",
+                 GPS_L1_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 GPS_L1_DOPPLER_MAX_HZ,
+                 0.25f, /* see L1P in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GPS_L2P,
+                 CONSTELLATION_GPS,
+                 NUM_SATS_GPS,
+                 NUM_SIGNALS_GPS_L2P,
+                 GPS_FIRST_PRN,
+                 "GPS L2P",
+                 GPS_L2_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GPS_L2_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L2P in [1]) */
+                 false)
+
+/* SBAS */
+CODE_TABLE_ENTRY(CODE_SBAS_L1CA,
+                 CONSTELLATION_SBAS,
+                 NUM_SATS_SBAS,
+                 NUM_SIGNALS_SBAS_L1CA,
+                 SBAS_FIRST_PRN,
+                 "SBAS L1",
+                 SBAS_L1_HZ,
+                 SBAS_L1CA_CHIPS_NUM,
+                 SBAS_L1CA_CHIPPING_RATE,
+                 true,
+                 SBAS_L1CA_PRN_PERIOD_MS,
+                 SBAS_L1_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal */
+                 true)
+CODE_TABLE_ENTRY(CODE_AUX_SBAS,
+                 CONSTELLATION_SBAS,
+                 NUM_SATS_SBAS,
+                 NUM_SIGNALS_SBAS_L1CA,
+                 SBAS_FIRST_PRN,
+                 "SBAS AUX",
+                 SBAS_L1_HZ,
+                 SBAS_L1CA_CHIPS_NUM,
+                 SBAS_L1CA_CHIPPING_RATE,
+                 false,
+                 SBAS_L1CA_PRN_PERIOD_MS,
+                 SBAS_L1_DOPPLER_MAX_HZ,
+                 0.f, /* not used */
+                 false)
+CODE_TABLE_ENTRY(CODE_SBAS_L5I,
+                 CONSTELLATION_SBAS,
+                 NUM_SATS_SBAS,
+                 NUM_SIGNALS_SBAS_L5,
+                 SBAS_FIRST_PRN,
+                 "SBAS L5I",
+                 SBAS_L5_HZ,
+                 SBAS_L5_CHIPS_NUM,
+                 SBAS_L5_CHIPPING_RATE,
+                 false,
+                 SBAS_L5_PRN_PERIOD_MS,
+                 (float)SBAS_L5_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal */
+                 true)
+CODE_TABLE_ENTRY(CODE_SBAS_L5Q,
+                 CONSTELLATION_SBAS,
+                 NUM_SATS_SBAS,
+                 NUM_SIGNALS_SBAS_L5,
+                 SBAS_FIRST_PRN,
+                 "SBAS L5Q",
+                 SBAS_L5_HZ,
+                 SBAS_L5_CHIPS_NUM,
+                 SBAS_L5_CHIPPING_RATE,
+                 false,
+                 SBAS_L5_PRN_PERIOD_MS,
+                 (float)SBAS_L5_DOPPLER_MAX_HZ,
+                 -0.25f, /* not used */
+                 false)
+CODE_TABLE_ENTRY(CODE_SBAS_L5X,
+                 CONSTELLATION_SBAS,
+                 NUM_SATS_SBAS,
+                 NUM_SIGNALS_SBAS_L5,
+                 SBAS_FIRST_PRN,
+                 "SBAS L5",
+                 SBAS_L5_HZ,
+                 SBAS_L5_CHIPS_NUM,
+                 SBAS_L5_CHIPPING_RATE,
+                 false,
+                 SBAS_L5_PRN_PERIOD_MS,
+                 (float)SBAS_L5_DOPPLER_MAX_HZ,
+                 0.f, /* must be aligned with CODE_SBAS_L5I */
+                 false)
+
+/* Glonass  */
+CODE_TABLE_ENTRY(CODE_GLO_L1OF,
+                 CONSTELLATION_GLO,
+                 NUM_SATS_GLO,
+                 NUM_FREQ_GLO_L1OF,
+                 GLO_FIRST_PRN,
+                 "GLO L1OF",
+                 GLO_L1_HZ,
+                 GLO_CA_CHIPS_NUM,
+                 GLO_CA_CHIPPING_RATE,
+                 true,
+                 GLO_PRN_PERIOD_MS,
+                 GLO_L1_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L1C in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_GLO_L2OF,
+                 CONSTELLATION_GLO,
+                 NUM_SATS_GLO,
+                 NUM_FREQ_GLO_L2OF,
+                 GLO_FIRST_PRN,
+                 "GLO L2OF",
+                 GLO_L2_HZ,
+                 GLO_CA_CHIPS_NUM,
+                 GLO_CA_CHIPPING_RATE,
+                 false,
+                 GLO_PRN_PERIOD_MS,
+                 (float)GLO_L2_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L2C in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_GLO_L1P,
+                 CONSTELLATION_GLO,
+                 NUM_SATS_GLO,
+                 NUM_FREQ_GLO_L1OF,
+                 GLO_FIRST_PRN,
+                 "GLO L1P",
+                 GLO_L1_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 GLO_L1_DOPPLER_MAX_HZ,
+                 0.25f, /* see L1P in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GLO_L2P,
+                 CONSTELLATION_GLO,
+                 NUM_SATS_GLO,
+                 NUM_FREQ_GLO_L2OF,
+                 GLO_FIRST_PRN,
+                 "GLO L2P",
+                 GLO_L2_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GLO_L2_DOPPLER_MAX_HZ,
+                 0.25f, /* see L2P in [1] */
+                 false)
+
+/* Galileo  */
+CODE_TABLE_ENTRY(CODE_GAL_E1B,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E1,
+                 GAL_FIRST_PRN,
+                 "GAL E1B",
+                 GAL_E1_HZ,
+                 GAL_E1B_CHIPS_NUM,
+                 GAL_E1_CHIPPING_RATE,
+                 true,
+                 GAL_E1B_PRN_PERIOD_MS,
+                 GAL_E1_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L1B in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_GAL_E1C,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E1,
+                 GAL_FIRST_PRN,
+                 "GAL E1C",
+                 GAL_E1_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 GAL_E1_DOPPLER_MAX_HZ,
+                 0.5f, /* see L1C in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E1X,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E1,
+                 GAL_FIRST_PRN,
+                 "GAL E1",
+                 GAL_E1_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 GAL_E1_DOPPLER_MAX_HZ,
+                 0.f, /* must be aligned to CODE_GAL_E1B (see L1X in [1])*/
+                 false)
+CODE_TABLE_ENTRY(CODE_AUX_GAL,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E1,
+                 GAL_FIRST_PRN,
+                 "GAL AUX",
+                 GAL_E1_HZ,
+                 GAL_E1B_CHIPS_NUM,
+                 GAL_E1_CHIPPING_RATE,
+                 false,
+                 GAL_E1B_PRN_PERIOD_MS,
+                 GAL_E1_DOPPLER_MAX_HZ,
+                 0.f, /* assuming CODE_GAL_E1B */
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E6B,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E6,
+                 GAL_FIRST_PRN,
+                 "GAL E6B",
+                 GAL_E6_HZ,
+                 GAL_E6_CHIPS_NUM,
+                 GAL_E6_CHIPPING_RATE,
+                 false,
+                 GAL_E6B_PRN_PERIOD_MS,
+                 (float)GAL_E6_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L6B in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_GAL_E6C,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E6,
+                 GAL_FIRST_PRN,
+                 "GAL E6C",
+                 GAL_E6_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GAL_E6_DOPPLER_MAX_HZ,
+                 -0.5f, /* see L6C in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E6X,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E6,
+                 GAL_FIRST_PRN,
+                 "GAL E6",
+                 GAL_E6_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GAL_E6_DOPPLER_MAX_HZ,
+                 0.f, /* must be aligned to CODE_GAL_E6B (see L6X in [1])*/
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E7I,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E7,
+                 GAL_FIRST_PRN,
+                 "GAL E5bI",
+                 GAL_E7_HZ,
+                 GAL_E7_CHIPS_NUM,
+                 GAL_E7_CHIPPING_RATE,
+                 false,
+                 GAL_E7I_PRN_PERIOD_MS,
+                 (float)GAL_E7_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L7I in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_GAL_E7Q,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E7,
+                 GAL_FIRST_PRN,
+                 "GAL E5bQ",
+                 GAL_E7_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GAL_E7_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L7Q in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E7X,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E7,
+                 GAL_FIRST_PRN,
+                 "GAL E5b",
+                 GAL_E7_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GAL_E7_DOPPLER_MAX_HZ,
+                 0.f, /* must be aligned to CODE_GAL_E7I (see L7X in [1])*/
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E8I,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E8,
+                 GAL_FIRST_PRN,
+                 "GAL E8I",
+                 GAL_E8_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GAL_E8_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L8I in [1]) */
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E8Q,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E8,
+                 GAL_FIRST_PRN,
+                 "GAL E8Q",
+                 GAL_E8_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GAL_E8_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L8Q in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E8X,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E8,
+                 GAL_FIRST_PRN,
+                 "GAL E8",
+                 GAL_E8_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GAL_E8_DOPPLER_MAX_HZ,
+                 0.f, /* must be aligned to CODE_GAL_E8Q (see L8X in [1])*/
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E5I,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E5,
+                 GAL_FIRST_PRN,
+                 "GAL E5aI",
+                 GAL_E5_HZ,
+                 GAL_E5_CHIPS_NUM,
+                 GAL_E5_CHIPPING_RATE,
+                 false,
+                 GAL_E5I_PRN_PERIOD_MS,
+                 (float)GAL_E5_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L5I in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_GAL_E5Q,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E5,
+                 GAL_FIRST_PRN,
+                 "GAL E5aQ",
+                 GAL_E5_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GAL_E5_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L5Q in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_GAL_E5X,
+                 CONSTELLATION_GAL,
+                 NUM_SATS_GAL,
+                 NUM_SIGNALS_GAL_E5,
+                 GAL_FIRST_PRN,
+                 "GAL E5a",
+                 GAL_E5_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)GAL_E5_DOPPLER_MAX_HZ,
+                 0.f, /* must be aligned to CODE_GAL_E5I (see L5X in [1])*/
+                 false)
+
+/* Beidou */
+CODE_TABLE_ENTRY(CODE_BDS2_B1,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS2_B1,
+                 BDS_FIRST_PRN,
+                 "BDS B1",
+                 BDS2_B1I_HZ,
+                 BDS2_B1I_CHIPS_NUM,
+                 BDS2_B1I_CHIPPING_RATE,
+                 true,
+                 BDS2_B1I_PRN_PERIOD_MS,
+                 BDS2_B1I_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L2I in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_AUX_BDS,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS2_B1,
+                 BDS_FIRST_PRN,
+                 "BDS AUX",
+                 BDS2_B1I_HZ,
+                 BDS2_B1I_CHIPS_NUM,
+                 BDS2_B1I_CHIPPING_RATE,
+                 false,
+                 BDS2_B1I_PRN_PERIOD_MS,
+                 BDS2_B1I_DOPPLER_MAX_HZ,
+                 0.f, /* assuming CODE_BDS2_B1 */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS2_B2,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS2_B2,
+                 BDS_FIRST_PRN,
+                 "BDS B2",
+                 BDS2_B2_HZ,
+                 BDS2_B2_CHIPS_NUM,
+                 BDS2_B2_CHIPPING_RATE,
+                 false,
+                 BDS2_B2_PRN_PERIOD_MS,
+                 (float)BDS2_B2_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L7I in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_BDS3_B1CI,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B1C,
+                 BDS_FIRST_PRN,
+                 "BDS3 B1CI",
+                 BDS3_B1C_HZ,
+                 BDS3_B1C_CHIPS_NUM,
+                 BDS3_B1C_CHIPPING_RATE,
+                 false,
+                 BDS3_B1C_PRN_PERIOD_MS,
+                 BDS3_B1C_DOPPLER_MAX_HZ,
+                 0.f, /* not used (interoperable with SBAS) */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B1CQ,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B1C,
+                 BDS_FIRST_PRN,
+                 "BDS3 B1CQ",
+                 BDS3_B1C_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 BDS3_B1C_DOPPLER_MAX_HZ,
+                 0.f, /* not used (interoperable with SBAS) */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B1CX,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B1C,
+                 BDS_FIRST_PRN,
+                 "BDS3 B1C",
+                 BDS3_B1C_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 BDS3_B1C_DOPPLER_MAX_HZ,
+                 0.f, /* not used (interoperable with SBAS) */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B3I,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B3,
+                 BDS_FIRST_PRN,
+                 "BDS3 B3I",
+                 BDS3_B3_HZ,
+                 BDS3_B3_CHIPS_NUM,
+                 BDS3_B3_CHIPPING_RATE,
+                 false,
+                 BDS3_B3_PRN_PERIOD_MS,
+                 (float)BDS3_B3_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L6I in [1]) */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B3Q,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B3,
+                 BDS_FIRST_PRN,
+                 "BDS3 B3Q",
+                 BDS3_B3_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)BDS3_B3_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L6Q in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B3X,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B3,
+                 BDS_FIRST_PRN,
+                 "BDS3 B3",
+                 BDS3_B3_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)BDS3_B3_DOPPLER_MAX_HZ,
+                 0.f, /*must be aligned to CODE_BDS3_B3I (L6X in [1]) */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B7I,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B7,
+                 BDS_FIRST_PRN,
+                 "BDS3 B7I",
+                 BDS3_B7_HZ,
+                 BDS3_B7_CHIPS_NUM,
+                 BDS3_B7_CHIPPING_RATE,
+                 false,
+                 BDS3_B7_PRN_PERIOD_MS,
+                 (float)BDS3_B7_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L7I in [1]) */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B7Q,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B7,
+                 BDS_FIRST_PRN,
+                 "BDS3 B7Q",
+                 BDS3_B7_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)BDS3_B7_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L7Q in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B7X,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B7,
+                 BDS_FIRST_PRN,
+                 "BDS3 B7",
+                 BDS3_B7_HZ,
+                 BDS3_B7_CHIPS_NUM,
+                 BDS3_B7_CHIPPING_RATE,
+                 false,
+                 BDS3_B7_PRN_PERIOD_MS,
+                 (float)BDS3_B7_DOPPLER_MAX_HZ,
+                 0.f, /* must be aligned to CODE_BDS3_B7I (L7X in [1]) */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B5I,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B5,
+                 BDS_FIRST_PRN,
+                 "BDS3 B5I",
+                 BDS3_B5_HZ,
+                 BDS3_B5_CHIPS_NUM,
+                 BDS3_B5_CHIPPING_RATE,
+                 false,
+                 BDS3_B5_PRN_PERIOD_MS,
+                 (float)BDS3_B5_DOPPLER_MAX_HZ,
+                 0.f, /* not used (interoperable with SBAS) */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B5Q,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B5,
+                 BDS_FIRST_PRN,
+                 "BDS3 B5Q",
+                 BDS3_B5_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)BDS3_B5_DOPPLER_MAX_HZ,
+                 0.f, /* not used (interoperable with SBAS) */
+                 false)
+CODE_TABLE_ENTRY(CODE_BDS3_B5X,
+                 CONSTELLATION_BDS,
+                 NUM_SATS_BDS,
+                 NUM_SIGNALS_BDS3_B5,
+                 BDS_FIRST_PRN,
+                 "BDS3 B5",
+                 BDS3_B5_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)BDS3_B5_DOPPLER_MAX_HZ,
+                 0.f, /* not used (interoperable with SBAS) */
+                 false)
+
+/* QZS L1C/A has all the same characteristics as GPS L1 C/A */
+CODE_TABLE_ENTRY(CODE_QZS_L1CA,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L1,
+                 QZS_FIRST_PRN,
+                 "QZS L1CA",
+                 QZS_L1_HZ,
+                 QZS_L1CA_CHIPS_NUM,
+                 QZS_L1CA_CHIPPING_RATE,
+                 true,
+                 QZS_L1CA_PRN_PERIOD_MS,
+                 QZS_L1_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L1C in [1]) */
+                 true)
+CODE_TABLE_ENTRY(CODE_AUX_QZS,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L1,
+                 QZS_FIRST_PRN,
+                 "QZS AUX",
+                 QZS_L1_HZ,
+                 QZS_L1CA_CHIPS_NUM,
+                 QZS_L1CA_CHIPPING_RATE,
+                 false,
+                 QZS_L1CA_PRN_PERIOD_MS,
+                 QZS_L1_DOPPLER_MAX_HZ,
+                 0.f, /* assuming CODE_QZS_L1CA */
+                 false)
+CODE_TABLE_ENTRY(CODE_QZS_L1CI,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L1C,
+                 QZS_FIRST_PRN,
+                 "QZS L1CI",
+                 QZS_L1_HZ,
+                 GPS_L1C_CHIPS_NUM,
+                 GPS_CA_CHIPPING_RATE,
+                 false,
+                 GPS_L1C_PRN_PERIOD_MS,
+                 GPS_L1_DOPPLER_MAX_HZ,
+                 0.f, /* see L1S in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_QZS_L1CQ,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L1C,
+                 QZS_FIRST_PRN,
+                 "QZS L1CQ",
+                 QZS_L1_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 GPS_L1_DOPPLER_MAX_HZ,
+                 0.25f, /* see L1L in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_QZS_L1CX,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L1C,
+                 QZS_FIRST_PRN,
+                 "QZS L1CX",
+                 QZS_L1_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 GPS_L1_DOPPLER_MAX_HZ,
+                 0.25f, /* see L1X in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_QZS_L2CM,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L2C,
+                 QZS_FIRST_PRN,
+                 "QZS L2CM",
+                 GPS_L2_HZ,
+                 GPS_L2CM_CHIPS_NUM,
+                 QZS_L1CA_CHIPPING_RATE,
+                 false,
+                 GPS_L2CM_PRN_PERIOD_MS,
+                 (float)QZS_L2_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L2S in [1]) */
+                 false)
+CODE_TABLE_ENTRY(CODE_QZS_L2CL,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L2C,
+                 QZS_FIRST_PRN,
+                 "QZS L2CL",
+                 GPS_L2_HZ,
+                 GPS_L2CL_CHIPS_NUM,
+                 QZS_L1CA_CHIPPING_RATE,
+                 false,
+                 GPS_L2CL_PRN_PERIOD_MS,
+                 (float)QZS_L2_DOPPLER_MAX_HZ,
+                 0.f, /* see L2L in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_QZS_L2CX,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L2C,
+                 QZS_FIRST_PRN,
+                 "QZS L2C",
+                 GPS_L2_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)QZS_L2_DOPPLER_MAX_HZ,
+                 0.f, /* see L2X in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_QZS_L5I,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L5,
+                 QZS_FIRST_PRN,
+                 "QZS L5I",
+                 QZS_L5_HZ,
+                 GPS_L5_CHIPS_NUM,
+                 GPS_L5_CHIPPING_RATE,
+                 false,
+                 GPS_L5_PRN_PERIOD_MS,
+                 (float)QZS_L5_DOPPLER_MAX_HZ,
+                 0.f, /* reference signal (see L5I in [1]) */
+                 false)
+CODE_TABLE_ENTRY(CODE_QZS_L5Q,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L5,
+                 QZS_FIRST_PRN,
+                 "QZS L5Q",
+                 QZS_L5_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)QZS_L5_DOPPLER_MAX_HZ,
+                 -0.25f, /* see L5Q in [1] */
+                 false)
+CODE_TABLE_ENTRY(CODE_QZS_L5X,
+                 CONSTELLATION_QZS,
+                 NUM_SATS_QZS,
+                 NUM_SIGNALS_QZS_L5,
+                 QZS_FIRST_PRN,
+                 "QZS L5",
+                 QZS_L5_HZ,
+                 0,
+                 0,
+                 false,
+                 0,
+                 (float)QZS_L5_DOPPLER_MAX_HZ,
+                 0.f, /* must be aligned to CODE_QZS_L5I (see L5X in [1])*/
+                 false)
+
+#undef CODE_TABLE_ENTRY
@@ -13,6 +13,8 @@
 #ifndef LIBSWIFTNAV_COORD_SYSTEM_H
 #define LIBSWIFTNAV_COORD_SYSTEM_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
@@ -60,6 +62,30 @@ extern "C" {
 
 /* \} */
 
+/** Algorithm used to convert from ECEF to geodetic coordinates. */
+typedef enum {
+  /** Fukushima's iterative method, see wgsecef2llh(). */
+  WGSECEF2LLH_ITERATIVE,
+  /** Vermeille's closed form solution, see wgsecef2llh_closed_form(). */
+  WGSECEF2LLH_CLOSED_FORM,
+} wgsecef2llh_method_t;
+
+/** Local North, East, Down frame of a fixed reference point.
+ *
+ * Caches the reference position and the ECEF to NED rotation so that many
+ * points can be converted without recomputing the reference geodetic
+ * coordinates and trigonometric functions each time.
+ */
+typedef struct {
+  /** Reference point in WGS84 ECEF coordinates [X, Y, Z] in meters. */
+  double ref_ecef[3];
+  /** Reference point in WGS84 geodetic coordinates [lat, lon, height] in
+   * [radians, radians, meters]. */
+  double ref_llh[3];
+  /** Rotation matrix from ECEF to NED. */
+  double M[3][3];
+} ned_frame_t;
+
 void llhrad2deg(const double llh_rad[3], double llh_deg[3]);
 
 void llhdeg2rad(const double llh_deg[3], double llh_rad[3]);
@@ -68,6 +94,36 @@ void wgsllh2ecef(const double llh[3], double ecef[3]);
 
 void wgsecef2llh(const double ecef[3], double llh[3]);
 
+void wgsecef2llh_closed_form(const double ecef[3], double llh[3]);
+
+void wgsecef2llh_method(const double ecef[3],
+                        double llh[3],
+                        wgsecef2llh_method_t method);
+
+void wgsllh2ecef_batch(size_t n,
+                       const double *lat,
+                       const double *lon,
+                       const double *height,
+                       double *x,
+                       double *y,
+                       double *z);
+
+void wgsecef2llh_batch(size_t n,
+                       const double *x,
+                       const double *y,
+                       const double *z,
+                       double *lat,
+                       double *lon,
+                       double *height);
+
+void wgsecef2llh_batch_fast(size_t n,
+                            const double *x,
+                            const double *y,
+                            const double *z,
+                            double *lat,
+                            double *lon,
+                            double *height);
+
 void wgsecef2ned(const double ecef[3], const double ref_ecef[3], double ned[3]);
 void wgsecef2ned_d(const double ecef[3],
                    const double ref_ecef[3],
@@ -87,6 +143,34 @@ void wgs_ecef2ned_matrix(const double llh[3], double M[3][3]);
 
 void ecef2ned_matrix(const double ref_ecef[3], double M[3][3]);
 
+void ned_frame_init_ecef(ned_frame_t* frame, const double ref_ecef[3]);
+void ned_frame_init_llh(ned_frame_t* frame, const double ref_llh[3]);
+void ned_frame_ecef2ned(const ned_frame_t* frame,
+                        const double ecef[3],
+                        double ned[3]);
+void ned_frame_ecef2ned_d(const ned_frame_t* frame,
+                          const double ecef[3],
+                          double ned[3]);
+void ned_frame_ned2ecef(const ned_frame_t* frame,
+                        const double ned[3],
+                        double ecef[3]);
+void ned_frame_ned2ecef_d(const ned_frame_t* frame,
+                          const double ned[3],
+                          double ecef[3]);
+void ned_frame_ecef2azel(const ned_frame_t* frame,
+                         const double ecef[3],
+                         double* azimuth,
+                         double* elevation);
+void ned_frame_ecef2ned_d_batch(const ned_frame_t* frame,
+                                size_t n,
+                                const double* ecef,
+                                double* ned);
+void ned_frame_ecef2azel_batch(const ned_frame_t* frame,
+                               size_t n,
+                               const double* ecef,
+                               double* azimuth,
+                               double* elevation);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif /* __cplusplus */
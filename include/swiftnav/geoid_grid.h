@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef LIBSWIFTNAV_GEOID_GRID_H
+#define LIBSWIFTNAV_GEOID_GRID_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <swiftnav/common.h>
+#include <swiftnav/geoid_model.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Magic bytes at the start of a compact geoid grid file. */
+#define GEOID_GRID_MAGIC "LSNGEOID"
+/** Length of the magic bytes, excluding any terminator. */
+#define GEOID_GRID_MAGIC_LEN 8
+/** Compact geoid grid file format version. */
+#define GEOID_GRID_VERSION 1
+/** Size of the compact geoid grid file header in bytes. */
+#define GEOID_GRID_HEADER_LEN 56
+/** Tiled, quantized geoid grid file format version. */
+#define GEOID_GRID_VERSION_TILED 2
+/** Size of the tiled geoid grid file header in bytes. */
+#define GEOID_GRID_TILED_HEADER_LEN 64
+/** Size of a tile directory entry in bytes. */
+#define GEOID_GRID_TILE_ENTRY_LEN 16
+/** Largest supported tile edge length in posts. */
+#define GEOID_GRID_MAX_TILE_SIZE 32
+/** Finest quantization step of a tiled grid in meters. */
+#define GEOID_GRID_TILE_RESOLUTION 0.001
+/** Number of decoded tiles held by a tile cache. */
+#define GEOID_GRID_TILE_CACHE_SLOTS 8
+/** Size of the GTX file header in bytes. */
+#define GEOID_GRID_GTX_HEADER_LEN 40
+
+/** Encoding of the quantized posts within each tile of a tiled grid. */
+typedef enum geoid_tile_encoding_e {
+  /** Little endian unsigned 16 bit values. */
+  GEOID_TILE_ENCODING_RAW = 0,
+  /** Zigzag varint coded differences between consecutive values. */
+  GEOID_TILE_ENCODING_DELTA = 1,
+  GEOID_TILE_ENCODING_COUNT
+} geoid_tile_encoding_t;
+
+/** Decoded tile held in a tile cache. */
+typedef struct geoid_tile_slot_s {
+  /** Directory entry of the tile held, NULL if the slot is empty. */
+  const u8 *tile;
+  /** Identifier of the grid the tile belongs to. */
+  u32 grid_id;
+  /** Cache clock value of the last access. */
+  u32 last_used;
+  /** Decoded heights, `tile_size` posts per row. */
+  float posts[GEOID_GRID_MAX_TILE_SIZE * GEOID_GRID_MAX_TILE_SIZE];
+} geoid_tile_slot_t;
+
+/** Least recently used cache of decoded tiles.
+ *
+ * A cache may be shared between several grids but is not thread safe. */
+typedef struct geoid_tile_cache_s {
+  /** Incremented on every access. */
+  u32 clock;
+  /** Most recently used slot, checked first. */
+  u32 mru;
+  geoid_tile_slot_t slots[GEOID_GRID_TILE_CACHE_SLOTS];
+} geoid_tile_cache_t;
+
+/** Geoid undulation grid backed by an external buffer or file.
+ *
+ * The grid does not own the height data, it references the buffer passed to
+ * geoid_grid_init() or the file mapping created by geoid_grid_map_file().
+ * Posts are stored row by row from south to north, each row from west to
+ * east.
+ */
+typedef struct geoid_grid_s {
+  /** Geoid model the heights are derived from. GTX files do not record this
+   * so it is `GEOID_MODEL_NONE` unless set by the caller. */
+  geoid_model_t model;
+  /** Latitude of the southernmost row in degrees. */
+  double lat0_deg;
+  /** Longitude of the westernmost column in degrees. */
+  double lon0_deg;
+  /** Latitude spacing in degrees. */
+  double dlat_deg;
+  /** Longitude spacing in degrees. */
+  double dlon_deg;
+  /** Number of rows (latitudes). */
+  u32 n_lat;
+  /** Number of columns (longitudes). */
+  u32 n_lon;
+  /** Number of columns after which longitude wraps around, or 0 if the grid
+   * does not cover all longitudes. */
+  u32 lon_period;
+  /** Posts are big endian (GTX) rather than little endian. */
+  bool big_endian;
+  /** Tile edge length in posts, 0 if the posts are stored as floats. */
+  u32 tile_size;
+  /** Number of tile columns of a tiled grid. */
+  u32 n_tile_cols;
+  /** Encoding of the tiles of a tiled grid. */
+  geoid_tile_encoding_t tile_encoding;
+  /** Start of the height data, or of the tile data of a tiled grid. */
+  const u8 *data;
+  /** Tile directory of a tiled grid. */
+  const u8 *tile_index;
+  /** Cache used to decode tiles, the per thread default cache if NULL. */
+  geoid_tile_cache_t *cache;
+  /** Identifier of a tiled grid, tells apart the tiles of grids initialised
+   * in turn from the same buffer. */
+  u32 id;
+  /** File mapping created by geoid_grid_map_file(), NULL otherwise. */
+  void *mapping;
+  /** Length of the file mapping in bytes. */
+  size_t mapping_len;
+} geoid_grid_t;
+
+s8 geoid_grid_init(geoid_grid_t *grid, const void *buf, size_t len);
+s8 geoid_grid_map_file(geoid_grid_t *grid, const char *path);
+void geoid_grid_unmap_file(geoid_grid_t *grid);
+void geoid_grid_set_cache(geoid_grid_t *grid, geoid_tile_cache_t *cache);
+void geoid_tile_cache_reset(geoid_tile_cache_t *cache);
+s8 geoid_grid_encode_tiled(const geoid_grid_t *src,
+                           u32 tile_size,
+                           geoid_tile_encoding_t encoding,
+                           u8 *buf,
+                           size_t *len);
+float geoid_grid_post(const geoid_grid_t *grid, u32 row, u32 col);
+s8 geoid_grid_offset(const geoid_grid_t *grid,
+                     double lat_rad,
+                     double lon_rad,
+                     float *offset);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBSWIFTNAV_GEOID_GRID_H */
@@ -13,6 +13,7 @@
 #ifndef GEOID_MODEL_H
 #define GEOID_MODEL_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -23,6 +24,12 @@ extern "C" {
 // range for lon_rad is (-2 * M_PI, 2 * M_PI)
 float get_geoid_offset(double lat_rad, double lon_rad);
 
+// get_geoid_offset() for n locations, faster for points along a track
+void get_geoid_offset_batch(size_t n,
+                            const double *lat_rad,
+                            const double *lon_rad,
+                            float *offset);
+
 typedef enum {
   GEOID_MODEL_NONE = 0,
   GEOID_MODEL_EGM96 = 1,
@@ -31,6 +38,13 @@ typedef enum {
 
 geoid_model_t get_geoid_model(void);
 
+struct geoid_grid_s;
+
+// Use a geoid grid loaded at runtime (see geoid_grid.h) in place of the
+// compiled in model, or revert to the compiled in model when grid is NULL.
+// The grid must remain valid until it is replaced.
+void set_geoid_grid(const struct geoid_grid_s *grid);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
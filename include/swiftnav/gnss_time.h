@@ -195,6 +195,32 @@ static constexpr const gps_time_t GPS_TIME_UNKNOWN = {TOW_UNKNOWN, WN_UNKNOWN};
 #define GPS_TIME_UNKNOWN ((gps_time_t){TOW_UNKNOWN, WN_UNKNOWN})
 #endif
 
+/** Number of nanoseconds in a second, as an integer. */
+#define SECS_NS_INT INT64_C(1000000000)
+
+/** Number of nanoseconds in a week, as an integer. */
+#define WEEK_NS_INT (WEEK_SECS * SECS_NS_INT)
+
+/** Largest week number that can be held by a `gps_time_ns_t`. */
+#define GPS_TIME_NS_MAX_WN 15000
+
+/** Structure representing a GPS time as integer nanoseconds since the GPS
+ * epoch.
+ *
+ * Unlike `gps_time_t` there is no week to wrap, so differences, offsets and
+ * comparisons are exact integer operations. The arithmetic helpers do not
+ * check for `GPS_TIME_NS_UNKNOWN`.
+ */
+typedef struct {
+  s64 ns; /**< Nanoseconds since the GPS epoch. */
+} gps_time_ns_t;
+
+#ifdef __cplusplus
+static constexpr const gps_time_ns_t GPS_TIME_NS_UNKNOWN = {INT64_MIN};
+#else
+#define GPS_TIME_NS_UNKNOWN ((gps_time_ns_t){INT64_MIN})
+#endif
+
 /** IS-GPS-200H Table 20-IX: 602112 [s] */
 #define GPS_LNAV_UTC_MAX_TOT 602112
 /** IS-GPS-200H Table 20-IX: 1 [days] */
@@ -242,6 +268,33 @@ typedef struct {
   double second_frac; /**< Fractional part of seconds (0 - .99...). */
 } utc_tm;
 
+/** Length of an ISO 8601 UTC time string "YYYY-MM-DDTHH:MM:SSZ" without
+ * fractional seconds, excluding the terminating null. */
+#define UTC_ISO8601_LEN 20
+
+/** Maximum number of decimals of the seconds in an ISO 8601 string. */
+#define UTC_ISO8601_MAX_DECIMALS 9
+
+/** Converts a stream of GPS times to UTC, caching the current UTC day.
+ *
+ * Within the cached day the conversion takes a time difference and a few
+ * integer divisions. Day changes and leap second events take the full
+ * `gps2utc()` path and refill the cache.
+ */
+typedef struct {
+  /** UTC parameters, used if `has_params` is set. */
+  utc_params_t params;
+  bool has_params;
+  /** `day_start`, `day` and `date_str` hold a cached day. */
+  bool valid;
+  /** GPS time of 00:00:00 of the cached UTC day. */
+  gps_time_t day_start;
+  /** Date of the cached day, the time of day fields are not used. */
+  utc_tm day;
+  /** The cached date as ISO 8601, "YYYY-MM-DDT". */
+  char date_str[12];
+} utc_formatter_t;
+
 bool unix_time_valid(const time_t *t);
 bool unix_time_valid_with_wn_ref(const time_t *t, u16 wn_ref);
 bool gps_time_valid(const gps_time_t *t);
@@ -258,6 +311,13 @@ time_t gps2time(const gps_time_t *t_gps);
 gps_time_t time2gps_t(const time_t t_unix);
 void gps2utc(const gps_time_t *t, utc_tm *u, const utc_params_t *p);
 void make_utc_tm(const gps_time_t *t, utc_tm *u);
+void utc_formatter_init(utc_formatter_t *f, const utc_params_t *p);
+void utc_formatter_tm(utc_formatter_t *f, const gps_time_t *t, utc_tm *u);
+size_t utc_formatter_iso8601(utc_formatter_t *f,
+                             const gps_time_t *t,
+                             u8 decimals,
+                             char *buf,
+                             size_t len);
 
 bool gpstime_in_range(const gps_time_t *bgn,
                       const gps_time_t *end,
@@ -312,6 +372,19 @@ gps_time_t mjd2gps(double mjd);
 gps_time_t mjd2gps_params(double mjd, const utc_params_t *p);
 double gps2mjd(const gps_time_t *gps_time);
 double gps2mjd_params(const gps_time_t *gps_time, const utc_params_t *p);
+void utc2mjd_batch(size_t n, const utc_tm *utc, double *mjd);
+void mjd2gps_batch(size_t n,
+                   const double *mjd,
+                   const utc_params_t *p,
+                   gps_time_t *gps);
+void utc2gps_batch(size_t n,
+                   const utc_tm *utc,
+                   const utc_params_t *p,
+                   gps_time_t *gps);
+void gps2mjd_batch(size_t n,
+                   const gps_time_t *gps,
+                   const utc_params_t *p,
+                   double *mjd);
 gps_time_t date2gps(
     s32 year, s32 month, s32 day, s32 hour, s32 min, double sec);
 gps_time_t date2gps_params(s32 year,
@@ -337,6 +410,44 @@ void gps2date_params(const gps_time_t *gps_time,
                      double *sec,
                      const utc_params_t *p);
 
+gps_time_ns_t gps2ns(const gps_time_t *t);
+gps_time_t ns2gps(gps_time_ns_t t);
+gps_time_ns_t glo2ns(const glo_time_t *glo_t, const utc_params_t *utc_params);
+glo_time_t ns2glo(gps_time_ns_t t, const utc_params_t *utc_params);
+
+/** Tell whether a `gps_time_ns_t` holds a known time. */
+static inline bool gps_time_ns_valid(gps_time_ns_t t) {
+  return t.ns != INT64_MIN;
+}
+
+/** Time `ns` nanoseconds after `t`. */
+static inline gps_time_ns_t gps_time_ns_add(gps_time_ns_t t, s64 ns) {
+  gps_time_ns_t r = {t.ns + ns};
+  return r;
+}
+
+/** Time `secs` seconds after `t`, rounded to the nanosecond. */
+static inline gps_time_ns_t gps_time_ns_add_secs(gps_time_ns_t t,
+                                                 double secs) {
+  return gps_time_ns_add(t, (s64)llround(secs * SECS_NS));
+}
+
+/** Nanoseconds from `beginning` to `end`. */
+static inline s64 gps_time_ns_diff(gps_time_ns_t end, gps_time_ns_t beginning) {
+  return end.ns - beginning.ns;
+}
+
+/** Seconds from `beginning` to `end`. */
+static inline double gps_time_ns_diff_secs(gps_time_ns_t end,
+                                           gps_time_ns_t beginning) {
+  return (double)(end.ns - beginning.ns) / SECS_NS;
+}
+
+/** Three way comparison, -1, 0 or 1 as `a` is before, at or after `b`. */
+static inline int gps_time_ns_cmp(gps_time_ns_t a, gps_time_ns_t b) {
+  return (a.ns > b.ns) - (a.ns < b.ns);
+}
+
 /* GPS-UTC time offset at given GPS time */
 double get_gps_utc_offset(const gps_time_t *t, const utc_params_t *p);
 /* UTC-GPS time offset at given UTC time */
@@ -405,6 +516,56 @@ static inline gps_time_t &operator-=(gps_time_t &lhs, double rhs) {
   add_secs(&lhs, -rhs);
   return lhs;
 }
+
+static inline bool operator==(const gps_time_ns_t &a, const gps_time_ns_t &b) {
+  return a.ns == b.ns;
+}
+
+static inline bool operator!=(const gps_time_ns_t &a, const gps_time_ns_t &b) {
+  return a.ns != b.ns;
+}
+
+static inline bool operator<(const gps_time_ns_t &a, const gps_time_ns_t &b) {
+  return a.ns < b.ns;
+}
+
+static inline bool operator>(const gps_time_ns_t &a, const gps_time_ns_t &b) {
+  return a.ns > b.ns;
+}
+
+static inline bool operator>=(const gps_time_ns_t &a, const gps_time_ns_t &b) {
+  return a.ns >= b.ns;
+}
+
+static inline bool operator<=(const gps_time_ns_t &a, const gps_time_ns_t &b) {
+  return a.ns <= b.ns;
+}
+
+static inline double operator-(const gps_time_ns_t &a, const gps_time_ns_t &b) {
+  return gps_time_ns_diff_secs(a, b);
+}
+
+static inline gps_time_ns_t operator+(const gps_time_ns_t &lhs, double rhs) {
+  return gps_time_ns_add_secs(lhs, rhs);
+}
+
+static inline gps_time_ns_t operator+(double lhs, const gps_time_ns_t &rhs) {
+  return gps_time_ns_add_secs(rhs, lhs);
+}
+
+static inline gps_time_ns_t operator-(const gps_time_ns_t &lhs, double rhs) {
+  return gps_time_ns_add_secs(lhs, -rhs);
+}
+
+static inline gps_time_ns_t &operator+=(gps_time_ns_t &lhs, double rhs) {
+  lhs = gps_time_ns_add_secs(lhs, rhs);
+  return lhs;
+}
+
+static inline gps_time_ns_t &operator-=(gps_time_ns_t &lhs, double rhs) {
+  lhs = gps_time_ns_add_secs(lhs, -rhs);
+  return lhs;
+}
 #endif
 
 #endif /* LIBSWIFTNAV_GNSS_TIME_H */
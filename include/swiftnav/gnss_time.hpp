@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef LIBSWIFTNAV_GNSS_TIME_HPP
+#define LIBSWIFTNAV_GNSS_TIME_HPP
+
+#include <assert.h>
+#include <swiftnav/gnss_time.h>
+
+/* Header only C++ counterparts of the GPS time arithmetic in gnss_time.h.
+ *
+ * The functions are constexpr and take and return values instead of
+ * pointers, otherwise they behave as the C function of the same name. Call
+ * them qualified, `swiftnav::`.
+ */
+namespace swiftnav {
+
+/** Tell whether a `gps_time_t` is a valid GPS time, see `gps_time_valid()`.
+ * A non finite time of week is not valid as it fails the range checks. */
+constexpr bool gps_time_valid(const gps_time_t &t) {
+  return t.tow >= 0 && t.tow < WEEK_SECS && t.wn >= 0;
+}
+
+/** Wrap the time of week into [0, WEEK_SECS) and carry into the week
+ * number, see `unsafe_normalize_gps_time()`. */
+constexpr gps_time_t unsafe_normalize_gps_time(gps_time_t t) {
+  while (t.tow < 0) {
+    t.tow += WEEK_SECS;
+    t.wn -= 1;
+  }
+  while (t.tow >= WEEK_SECS) {
+    t.tow -= WEEK_SECS;
+    t.wn += 1;
+  }
+  return t;
+}
+
+/** Normalize a GPS time, leaving an unknown week number unknown, see
+ * `normalize_gps_time()`. */
+constexpr gps_time_t normalize_gps_time(gps_time_t t) {
+  assert(t.wn >= WN_UNKNOWN);
+  if (t.wn == WN_UNKNOWN) {
+    while (t.tow < 0) {
+      t.tow += WEEK_SECS;
+    }
+    while (t.tow >= WEEK_SECS) {
+      t.tow -= WEEK_SECS;
+    }
+    return t;
+  }
+  t = swiftnav::unsafe_normalize_gps_time(t);
+  assert(swiftnav::gps_time_valid(t));
+  return t;
+}
+
+/** Time `secs` seconds after `t`, see `add_secs()`. */
+constexpr gps_time_t add_secs(gps_time_t t, double secs) {
+  t.tow += secs;
+  return swiftnav::unsafe_normalize_gps_time(t);
+}
+
+/** Seconds from `beginning` to `end`, see `gpsdifftime()`. */
+constexpr double gpsdifftime(const gps_time_t &end,
+                             const gps_time_t &beginning) {
+  double dt = end.tow - beginning.tow;
+  if (end.wn == WN_UNKNOWN || beginning.wn == WN_UNKNOWN) {
+    if (dt > WEEK_SECS / 2) {
+      dt -= WEEK_SECS;
+    }
+    if (dt < -WEEK_SECS / 2) {
+      dt += WEEK_SECS;
+    }
+  } else {
+    dt += ((double)end.wn - beginning.wn) * WEEK_SECS;
+  }
+  return dt;
+}
+
+/** Absolute week number of a week number modulo 1024, see
+ * `gps_adjust_week_cycle()`. */
+constexpr u16 gps_adjust_week_cycle(u16 wn_raw, u16 wn_ref) {
+  return wn_raw >= wn_ref
+             ? wn_raw
+             : static_cast<u16>(wn_raw +
+                                1024 * ((wn_ref + 1023 - wn_raw) / 1024));
+}
+
+/** Absolute week number of a week number modulo 256, see
+ * `gps_adjust_week_cycle256()`. */
+constexpr u16 gps_adjust_week_cycle256(u16 wn_raw, u16 wn_ref) {
+  return wn_raw >= wn_ref
+             ? wn_raw
+             : static_cast<u16>(wn_raw + 256 * ((wn_ref + 255 - wn_raw) / 256));
+}
+
+constexpr bool gps_time_ns_valid(gps_time_ns_t t) {
+  return t.ns != INT64_MIN;
+}
+
+constexpr gps_time_ns_t gps_time_ns_add(gps_time_ns_t t, s64 ns) {
+  return gps_time_ns_t{t.ns + ns};
+}
+
+constexpr s64 gps_time_ns_diff(gps_time_ns_t end, gps_time_ns_t beginning) {
+  return end.ns - beginning.ns;
+}
+
+constexpr double gps_time_ns_diff_secs(gps_time_ns_t end,
+                                       gps_time_ns_t beginning) {
+  return (double)(end.ns - beginning.ns) / SECS_NS;
+}
+
+constexpr int gps_time_ns_cmp(gps_time_ns_t a, gps_time_ns_t b) {
+  return (a.ns > b.ns) - (a.ns < b.ns);
+}
+
+/** Convert integer nanoseconds since the GPS epoch to a GPS time, see
+ * `ns2gps()`. */
+constexpr gps_time_t ns2gps(gps_time_ns_t t) {
+  if (!swiftnav::gps_time_ns_valid(t)) {
+    return GPS_TIME_UNKNOWN;
+  }
+  s64 wn = t.ns / WEEK_NS_INT;
+  s64 ns = t.ns % WEEK_NS_INT;
+  if (ns < 0) {
+    ns += WEEK_NS_INT;
+    wn -= 1;
+  }
+  return gps_time_t{
+      (double)(ns / SECS_NS_INT) + (double)(ns % SECS_NS_INT) / SECS_NS,
+      static_cast<s16>(wn)};
+}
+
+}  // namespace swiftnav
+
+#endif /* LIBSWIFTNAV_GNSS_TIME_HPP */
@@ -13,8 +13,10 @@
 #ifndef LIBSWIFTNAV_IONOSHPERE_H
 #define LIBSWIFTNAV_IONOSHPERE_H
 
+#include <stddef.h>
 #include <swiftnav/common.h>
 #include <swiftnav/gnss_time.h>
+#include <swiftnav/signal.h>
 
 #ifdef __cplusplus
 #include <swiftnav/linear_algebra.h>
@@ -64,6 +66,16 @@ double calc_ionosphere(const gps_time_t *t_gps,
                        double e,
                        const ionosphere_t *i);
 
+void calc_ionosphere_batch(const gps_time_t *t_gps,
+                           double lat_u,
+                           double lon_u,
+                           const ionosphere_t *i,
+                           size_t n,
+                           const double *a,
+                           const double *e,
+                           const gnss_signal_t *sids,
+                           double *delay);
+
 bool decode_iono_parameters(const u32 words[8], ionosphere_t *i);
 
 void decode_bds_d1_iono(const u32 words[10], ionosphere_t *iono);
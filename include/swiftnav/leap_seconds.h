@@ -52,6 +52,31 @@ static const s32 utc_leaps[][3] = {
     {1930, 17, 18},     /* 01-01-2017 */
 };
 
+/**
+ * Start times of the UTC leap second events of `utc_leaps` in seconds since
+ * the GPS epoch, for searching the table without forming `gps_time_t`s.
+ */
+static const s64 utc_leap_secs[] = {
+    46828800,    /* 01-07-1981 */
+    78364801,    /* 01-07-1982 */
+    109900802,   /* 01-07-1983 */
+    173059203,   /* 01-07-1985 */
+    252028804,   /* 01-01-1988 */
+    315187205,   /* 01-01-1990 */
+    346723206,   /* 01-01-1991 */
+    393984007,   /* 01-07-1992 */
+    425520008,   /* 01-07-1993 */
+    457056009,   /* 01-07-1994 */
+    504489610,   /* 01-01-1996 */
+    551750411,   /* 01-07-1997 */
+    599184012,   /* 01-01-1999 */
+    820108813,   /* 01-01-2006 */
+    914803214,   /* 01-01-2009 */
+    1025136015,  /* 01-07-2012 */
+    1119744016,  /* 01-07-2015 */
+    1167264017,  /* 01-01-2017 */
+};
+
 /** GPS time when the utc_leaps table expires 28-12-2023 */
 static const s32 gps_time_utc_leaps_expiry[2] = {2294, 345618};
 
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef LIBSWIFTNAV_NEQUICK_H
+#define LIBSWIFTNAV_NEQUICK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <swiftnav/common.h>
+#include <swiftnav/gnss_time.h>
+#include <swiftnav/signal.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of latitude rows of the wrapped MODIP grid, 5 degree spacing. */
+#define NEQUICK_MODIP_ROWS 39
+/** Number of longitude columns of the wrapped MODIP grid, 10 degree spacing. */
+#define NEQUICK_MODIP_COLS 39
+/** Number of spatial coefficients of the CCIR foF2 map. */
+#define NEQUICK_F2_COEFFS 76
+/** Number of Fourier time coefficients of the CCIR foF2 map. */
+#define NEQUICK_F2_HARMONICS 13
+/** Number of spatial coefficients of the CCIR M(3000)F2 map. */
+#define NEQUICK_FM3_COEFFS 49
+/** Number of Fourier time coefficients of the CCIR M(3000)F2 map. */
+#define NEQUICK_FM3_HARMONICS 9
+
+/** Coefficient tables of the NeQuick-G model.
+ *
+ * The tables are the ones distributed with the Galileo ionospheric correction
+ * algorithm specification: the wrapped modified dip latitude grid
+ * (`modipNeQG_wrapped.asc`) and one CCIR map file per month (`ccir11.asc` for
+ * January to `ccir22.asc` for December). They are too large to compile in and
+ * are loaded with nequick_load_modip() and nequick_load_ccir(), into a zero
+ * initialised structure.
+ */
+typedef struct {
+  /** Modified dip latitude in degrees. Row `i` holds latitude
+   * `5 * (i - 1) - 90` degrees, column `j` longitude `10 * (j - 1) - 180`
+   * degrees. The first and last row and column wrap around the grid. */
+  double modip[NEQUICK_MODIP_ROWS][NEQUICK_MODIP_COLS];
+  /** foF2 map per month, for a 12 month smoothed sunspot number of 0 and
+   * 100. */
+  double f2[12][2][NEQUICK_F2_COEFFS][NEQUICK_F2_HARMONICS];
+  /** M(3000)F2 map per month, for a 12 month smoothed sunspot number of 0
+   * and 100. */
+  double fm3[12][2][NEQUICK_FM3_COEFFS][NEQUICK_FM3_HARMONICS];
+  /** Whether the modified dip latitude grid has been loaded. */
+  bool modip_loaded;
+  /** Whether the maps of each month have been loaded. */
+  bool ccir_loaded[12];
+} nequick_data_t;
+
+/** Galileo broadcast effective ionisation level coefficients. */
+typedef struct {
+  double ai0; /**< Effective ionisation level 1st order [sfu] */
+  double ai1; /**< Effective ionisation level 2nd order [sfu/deg] */
+  double ai2; /**< Effective ionisation level 3rd order [sfu/deg^2] */
+} nequick_coeffs_t;
+
+/** NeQuick-G evaluation state for one receiver and epoch.
+ *
+ * Holds everything that does not depend on the position along the ray: the
+ * solar declination, the effective ionisation level at the receiver and the
+ * CCIR maps evaluated at the epoch. nequick_prepare() only recomputes the
+ * parts invalidated by a change of receiver position or epoch.
+ */
+typedef struct {
+  const nequick_data_t *data;
+  nequick_coeffs_t coeffs;
+  /** Receiver latitude [deg], longitude [deg] and height [km]. */
+  double rx_lat;
+  double rx_lon;
+  double rx_h;
+  /** Month (1 - 12) and universal time [h] of the epoch. */
+  u8 month;
+  double ut;
+  /** Effective ionisation level and effective sunspot number. */
+  double az;
+  double az_r;
+  /** Sine and cosine of the solar declination. */
+  double sin_dec;
+  double cos_dec;
+  /** CCIR maps evaluated at the epoch and effective sunspot number. */
+  double cf2[NEQUICK_F2_COEFFS];
+  double cm3[NEQUICK_FM3_COEFFS];
+} nequick_context_t;
+
+s8 nequick_load_modip(nequick_data_t *data, const char *path);
+s8 nequick_load_ccir(nequick_data_t *data, u8 month, const char *path);
+void nequick_init(nequick_context_t *ctx,
+                  const nequick_data_t *data,
+                  const nequick_coeffs_t *coeffs);
+s8 nequick_prepare(nequick_context_t *ctx,
+                   const utc_tm *t,
+                   double rx_lat_rad,
+                   double rx_lon_rad,
+                   double rx_h);
+double nequick_modip(const nequick_data_t *data,
+                     double lat_deg,
+                     double lon_deg);
+double nequick_electron_density(const nequick_context_t *ctx,
+                                double lat_deg,
+                                double lon_deg,
+                                double h_km);
+s8 nequick_stec(const nequick_context_t *ctx,
+                double sat_lat_rad,
+                double sat_lon_rad,
+                double sat_h,
+                double *stec);
+s8 nequick_delay_batch(const nequick_context_t *ctx,
+                       size_t n,
+                       const double *sat_lat_rad,
+                       const double *sat_lon_rad,
+                       const double *sat_h,
+                       const gnss_signal_t *sids,
+                       double *delay);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBSWIFTNAV_NEQUICK_H */
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef LIBSWIFTNAV_SBAS_H
+#define LIBSWIFTNAV_SBAS_H
+
+#include <stdbool.h>
+#include <swiftnav/common.h>
+#include <swiftnav/gnss_time.h>
+#include <swiftnav/sbas_raw_data.h>
+#include <swiftnav/signal.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Length of an SBAS L1 frame including preamble and CRC in bits. */
+#define SBAS_FRAME_BITS 250
+/** Number of bytes holding an SBAS L1 frame. */
+#define SBAS_FRAME_BYTES 32
+/** Length of the data field of an SBAS L1 frame in bits. */
+#define SBAS_DATA_BITS 212
+/** Number of bits of the PRN mask. */
+#define SBAS_PRN_MASK_BITS 210
+/** Maximum number of satellites in the PRN mask. */
+#define SBAS_MAX_MASK_SATS 51
+/** Number of ionospheric grid point bands. */
+#define SBAS_IGP_BANDS 11
+/** Maximum number of grid points in a band. */
+#define SBAS_IGP_BAND_SIZE 201
+/** Rows of the dense grid point array, 5 degrees from -90 to 90. */
+#define SBAS_IGP_ROWS 37
+/** Columns of the dense grid point array, 5 degrees from -180 to 175. */
+#define SBAS_IGP_COLS 72
+/** UDRE indicator of a satellite that is not monitored. */
+#define SBAS_UDREI_NOT_MONITORED 14
+/** UDRE indicator of a satellite that must not be used. */
+#define SBAS_UDREI_DO_NOT_USE 15
+/** GIVE indicator of a grid point that is not monitored. */
+#define SBAS_GIVEI_NOT_MONITORED 15
+/** Maximum age of fast corrections [s]. */
+#define SBAS_FAST_CORR_TIMEOUT 180
+/** Maximum age of long term corrections [s]. */
+#define SBAS_LONG_TERM_TIMEOUT 360
+/** Maximum age of ionospheric grid point delays [s]. */
+#define SBAS_IONO_TIMEOUT 600
+/** Time for which a type 0 message suspends the corrections [s]. */
+#define SBAS_DO_NOT_USE_TIMEOUT 60
+
+/** Corrections for one satellite of the PRN mask. */
+typedef struct {
+  gnss_signal_t sid;
+  /** Fast corrections have been received. */
+  bool fast_valid;
+  /** Pseudorange correction [m] and its rate of change [m/s]. */
+  double prc;
+  double rrc;
+  /** Time of applicability of `prc`. */
+  gps_time_t t_fast;
+  /** Previous pseudorange correction, used to form `rrc`. */
+  double prc_prev;
+  gps_time_t t_fast_prev;
+  /** Issue of data of the fast corrections. */
+  u8 iodf;
+  /** User differential range error indicator. */
+  u8 udrei;
+  /** Fast correction degradation factor indicator. */
+  u8 ai;
+  /** Long term corrections have been received. */
+  bool long_term_valid;
+  /** Issue of data of the ephemeris the long term corrections apply to. */
+  u8 iode;
+  /** Satellite position [m] and velocity [m/s] corrections, ECEF. */
+  double dpos[3];
+  double dvel[3];
+  /** Satellite clock offset [s] and drift [s/s] corrections. */
+  double daf0;
+  double daf1;
+  /** Time of applicability of the long term corrections. */
+  gps_time_t t_long_term;
+} sbas_sat_corr_t;
+
+/** Ionospheric grid point. */
+typedef struct {
+  /** Vertical delay at L1 [m]. */
+  float delay;
+  /** Grid ionospheric vertical error indicator. */
+  u8 givei;
+  /** The point is in the current mask and its delay has been received. */
+  bool valid;
+  /** Time the delay was received. */
+  gps_time_t t;
+} sbas_igp_t;
+
+/** State of the messages received from one SBAS satellite.
+ *
+ * Satellites and grid points are looked up through dense tables, so the cost
+ * of a correction lookup does not depend on the size of the masks.
+ */
+typedef struct {
+  /** A PRN mask (type 1) has been received. */
+  bool have_prn_mask;
+  /** Issue of data of the PRN mask. */
+  u8 iodp;
+  /** Number of satellites in the PRN mask. */
+  u8 n_sats;
+  sbas_sat_corr_t sats[SBAS_MAX_MASK_SATS];
+  /** Index into `sats` for each PRN mask bit number, -1 if not set. */
+  s8 mask_slot[SBAS_PRN_MASK_BITS + 1];
+  /** Fast correction degradation system latency [s]. */
+  u8 tlat;
+  /** A type 0 message has been received, the data is for testing only. */
+  bool do_not_use;
+  /** Time the last type 0 message was received. */
+  gps_time_t t_do_not_use;
+  /** Number of bands announced in the grid point masks. */
+  u8 n_bands;
+  /** Issue of data of the grid point mask of each band. */
+  u8 band_iodi[SBAS_IGP_BANDS];
+  /** Number of grid points set in the mask of each band. */
+  u8 band_n_igps[SBAS_IGP_BANDS];
+  /** Index into `igps` of each grid point of the mask of each band. */
+  u16 band_igps[SBAS_IGP_BANDS][SBAS_IGP_BAND_SIZE];
+  /** All grid points, indexed by 5 degree latitude row and longitude
+   * column. */
+  sbas_igp_t igps[SBAS_IGP_ROWS * SBAS_IGP_COLS];
+} sbas_decoder_t;
+
+void sbas_decoder_init(sbas_decoder_t *d);
+s8 sbas_decode_frame(sbas_decoder_t *d,
+                     const u8 frame[SBAS_FRAME_BYTES],
+                     const gps_time_t *t);
+s8 sbas_decode_raw(sbas_decoder_t *d, const sbas_raw_data_t *raw);
+s8 sbas_fast_correction(const sbas_decoder_t *d,
+                        gnss_signal_t sid,
+                        const gps_time_t *t,
+                        double *prc,
+                        double *var);
+s8 sbas_long_term_correction(const sbas_decoder_t *d,
+                             gnss_signal_t sid,
+                             u8 iode,
+                             const gps_time_t *t,
+                             double dpos[3],
+                             double *dclk);
+s8 sbas_iono_vertical_delay(const sbas_decoder_t *d,
+                            const gps_time_t *t,
+                            double lat_rad,
+                            double lon_rad,
+                            double *delay,
+                            double *var);
+s8 sbas_iono_delay(const sbas_decoder_t *d,
+                   const gps_time_t *t,
+                   double lat_rad,
+                   double lon_rad,
+                   double az,
+                   double el,
+                   double *delay,
+                   double *var);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBSWIFTNAV_SBAS_H */
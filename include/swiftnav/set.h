@@ -69,6 +69,52 @@ u32 remove_element(
 u32 insert_element(
     u32 na, size_t sa, const void *as, void *a_out, void *b, cmp_fn cmp);
 
+/* Typed versions of the functions above for the common element types.
+ *
+ * The comparisons are inlined, `gnss_signal_t` sets are ordered as by
+ * `cmp_sid_sid()`. The intersections switch to a galloping search when one
+ * set is much larger than the other. Instead of calling a function for each
+ * match the `_index` variants write the indices of the matching elements,
+ * any output may be NULL. Unlike the generic versions, the insert and remove
+ * functions can work in place, `a_out == as`. */
+s32 intersection_sid(u32 na,
+                     const gnss_signal_t *as,
+                     gnss_signal_t *a_out,
+                     u32 nb,
+                     const gnss_signal_t *bs,
+                     gnss_signal_t *b_out);
+s32 intersection_index_sid(u32 na,
+                           const gnss_signal_t *as,
+                           u32 *ia_out,
+                           u32 nb,
+                           const gnss_signal_t *bs,
+                           u32 *ib_out);
+u32 insertion_index_sid(u32 na, const gnss_signal_t *as, gnss_signal_t b);
+u32 remove_element_sid(u32 na,
+                       const gnss_signal_t *as,
+                       gnss_signal_t *a_out,
+                       gnss_signal_t b);
+u32 insert_element_sid(u32 na,
+                       const gnss_signal_t *as,
+                       gnss_signal_t *a_out,
+                       gnss_signal_t b);
+
+s32 intersection_s32(
+    u32 na, const s32 *as, s32 *a_out, u32 nb, const s32 *bs, s32 *b_out);
+s32 intersection_index_s32(
+    u32 na, const s32 *as, u32 *ia_out, u32 nb, const s32 *bs, u32 *ib_out);
+u32 insertion_index_s32(u32 na, const s32 *as, s32 b);
+u32 remove_element_s32(u32 na, const s32 *as, s32 *a_out, s32 b);
+u32 insert_element_s32(u32 na, const s32 *as, s32 *a_out, s32 b);
+
+s32 intersection_u16(
+    u32 na, const u16 *as, u16 *a_out, u32 nb, const u16 *bs, u16 *b_out);
+s32 intersection_index_u16(
+    u32 na, const u16 *as, u32 *ia_out, u32 nb, const u16 *bs, u32 *ib_out);
+u32 insertion_index_u16(u32 na, const u16 *as, u16 b);
+u32 remove_element_u16(u32 na, const u16 *as, u16 *a_out, u16 b);
+u32 insert_element_u16(u32 na, const u16 *as, u16 *a_out, u16 b);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif /* __cplusplus */
@@ -0,0 +1,187 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef LIBSWIFTNAV_SET_HPP
+#define LIBSWIFTNAV_SET_HPP
+
+#include <algorithm>
+#include <assert.h>
+#include <cstddef>
+#include <functional>
+#include <swiftnav/set.h>
+
+/* Header only C++ counterparts of the sorted set functions in set.h.
+ *
+ * The element types and the comparison are template parameters instead of
+ * element sizes and a `cmp_fn`, so the comparisons and the function mapped
+ * over an intersection are inlined. The comparison defaults to `operator<`,
+ * which orders `gnss_signal_t` as `cmp_sid_sid()` does. Call them qualified,
+ * `swiftnav::`.
+ */
+namespace swiftnav {
+
+namespace detail {
+
+/** Size ratio above which an intersection gallops through the larger set
+ * instead of merging. */
+constexpr std::size_t set_gallop_ratio = 8;
+
+/** First element from `first` on not less than `value`, searching in
+ * windows of doubling size. */
+template <typename T, typename V, typename Compare>
+const T *gallop(const T *first, const T *last, const V &value, Compare comp) {
+  std::size_t step = 1;
+  const T *hi = first;
+  while (hi < last && comp(*hi, value)) {
+    first = hi + 1;
+    step *= 2;
+    hi = (static_cast<std::size_t>(last - hi) > step) ? hi + step : last;
+  }
+  return std::lower_bound(first, hi, value, comp);
+}
+
+}  // namespace detail
+
+/** Call `f(a, b)` for each pair of equal elements of two sorted sets, see
+ * `intersection_map()`.
+ *
+ * \return Number of elements in the intersection
+ */
+template <typename A,
+          typename B,
+          typename F,
+          typename Compare = std::less<>>
+std::size_t intersection_map(const A *as,
+                             std::size_t na,
+                             const B *bs,
+                             std::size_t nb,
+                             F &&f,
+                             Compare comp = Compare{}) {
+  std::size_t n = 0;
+  const A *a = as;
+  const A *a_end = as + na;
+  const B *b = bs;
+  const B *b_end = bs + nb;
+  if (nb > detail::set_gallop_ratio * na) {
+    for (; a < a_end && b < b_end; ++a) {
+      b = detail::gallop(b, b_end, *a, comp);
+      if (b < b_end && !comp(*a, *b)) {
+        f(*a, *b++);
+        n++;
+      }
+    }
+  } else if (na > detail::set_gallop_ratio * nb) {
+    for (; b < b_end && a < a_end; ++b) {
+      a = detail::gallop(a, a_end, *b, comp);
+      if (a < a_end && !comp(*b, *a)) {
+        f(*a++, *b);
+        n++;
+      }
+    }
+  } else {
+    while (a < a_end && b < b_end) {
+      if (comp(*a, *b)) {
+        ++a;
+      } else if (comp(*b, *a)) {
+        ++b;
+      } else {
+        f(*a++, *b++);
+        n++;
+      }
+    }
+  }
+  return n;
+}
+
+/** Copy the elements of each set that are in the other, see
+ * `intersection()`. Either output may be null.
+ *
+ * \return Number of elements in the intersection
+ */
+template <typename A, typename B, typename Compare = std::less<>>
+std::size_t intersection(const A *as,
+                         std::size_t na,
+                         A *a_out,
+                         const B *bs,
+                         std::size_t nb,
+                         B *b_out,
+                         Compare comp = Compare{}) {
+  return swiftnav::intersection_map(
+      as,
+      na,
+      bs,
+      nb,
+      [&](const A &a, const B &b) {
+        if (a_out != nullptr) {
+          *a_out++ = a;
+        }
+        if (b_out != nullptr) {
+          *b_out++ = b;
+        }
+      },
+      comp);
+}
+
+/** Index where an element belongs in a sorted set, see
+ * `insertion_index()`. */
+template <typename T, typename Compare = std::less<>>
+std::size_t insertion_index(const T *as,
+                            std::size_t na,
+                            const T &b,
+                            Compare comp = Compare{}) {
+  return static_cast<std::size_t>(std::lower_bound(as, as + na, b, comp) - as);
+}
+
+/** Remove the first element not less than `b`, or the last element if
+ * there is none, see `remove_element()`. `a_out` may be `as`.
+ *
+ * \return Index of the removed element
+ */
+template <typename T, typename Compare = std::less<>>
+std::size_t remove_element(const T *as,
+                           std::size_t na,
+                           T *a_out,
+                           const T &b,
+                           Compare comp = Compare{}) {
+  assert(na > 0);
+  std::size_t index = std::min(swiftnav::insertion_index(as, na, b, comp),
+                               na - 1);
+  if (a_out != as) {
+    std::copy(as, as + index, a_out);
+  }
+  std::copy(as + index + 1, as + na, a_out + index);
+  return index;
+}
+
+/** Insert an element into a sorted set, see `insert_element()`. `a_out`
+ * may be `as`, it must have room for `na + 1` elements.
+ *
+ * \return Index of the inserted element
+ */
+template <typename T, typename Compare = std::less<>>
+std::size_t insert_element(const T *as,
+                           std::size_t na,
+                           T *a_out,
+                           T b,
+                           Compare comp = Compare{}) {
+  std::size_t index = swiftnav::insertion_index(as, na, b, comp);
+  std::copy_backward(as + index, as + na, a_out + na + 1);
+  if (a_out != as) {
+    std::copy(as, as + index, a_out);
+  }
+  a_out[index] = b;
+  return index;
+}
+
+}  // namespace swiftnav
+
+#endif /* LIBSWIFTNAV_SET_HPP */
@@ -31,6 +31,32 @@ u32 sid_set_get_sat_count(const gnss_sid_set_t *sid_set);
 u32 sid_set_get_sig_count(const gnss_sid_set_t *sid_set);
 bool sid_set_contains(const gnss_sid_set_t *sid_set, gnss_signal_t sid);
 
+void sid_set_union(gnss_sid_set_t *result,
+                   const gnss_sid_set_t *a,
+                   const gnss_sid_set_t *b);
+void sid_set_intersection(gnss_sid_set_t *result,
+                          const gnss_sid_set_t *a,
+                          const gnss_sid_set_t *b);
+void sid_set_difference(gnss_sid_set_t *result,
+                        const gnss_sid_set_t *a,
+                        const gnss_sid_set_t *b);
+bool sid_set_is_subset(const gnss_sid_set_t *a, const gnss_sid_set_t *b);
+bool sid_set_is_empty(const gnss_sid_set_t *sid_set);
+
+void sid_set_get_sats(const gnss_sid_set_t *sid_set,
+                      u64 sats[CONSTELLATION_COUNT]);
+bool sid_set_contains_sat(const gnss_sid_set_t *sid_set, gnss_signal_t sid);
+
+/** Iterator over the members of a sid set, see `sid_set_iter_next()`. */
+typedef struct {
+  const gnss_sid_set_t *sid_set;
+  u32 code;
+  u64 remaining;
+} sid_set_iter_t;
+
+void sid_set_iter_init(sid_set_iter_t *iter, const gnss_sid_set_t *sid_set);
+bool sid_set_iter_next(sid_set_iter_t *iter, gnss_signal_t *sid);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -140,6 +140,10 @@ extern "C" {
   (NUM_SIGNALS_GPS + NUM_SIGNALS_SBAS + NUM_SIGNALS_GLO + NUM_SIGNALS_BDS + \
    NUM_SIGNALS_GAL + NUM_SIGNALS_QZS)
 
+/* Number of signals over all codes, the size of an array indexed by
+ * `sid_to_global_index()`. */
+#define SID_GLOBAL_COUNT (NUM_SIGNALS)
+
 #define GPS_FIRST_PRN 1
 #define SBAS_FIRST_PRN 120
 #define GLO_FIRST_PRN 1
@@ -228,11 +232,18 @@ static inline constellation_t char_to_constellation(char cons) {
 const char *constellation_to_string(const constellation_t cons);
 
 constellation_t constellation_string_to_enum(const char *constellation_string);
+constellation_t constellation_string_to_enum_n(const char *str, size_t len);
+constellation_t constellation_string_to_enum_nocase(const char *str,
+                                                    size_t len);
 
 const char *sub_constellation_to_string(const sub_constellation_t sub_cons);
 
 sub_constellation_t sub_constellation_string_to_enum(
     const char *sub_constellation_string);
+sub_constellation_t sub_constellation_string_to_enum_n(const char *str,
+                                                       size_t len);
+sub_constellation_t sub_constellation_string_to_enum_nocase(const char *str,
+                                                           size_t len);
 
 constellation_t sub_constellation_to_constellation(
     const sub_constellation_t sub_constellation);
@@ -308,6 +319,8 @@ typedef enum code_e {
 } code_t;
 
 code_t code_string_to_enum(const char *code_label);
+code_t code_string_to_enum_n(const char *str, size_t len);
+code_t code_string_to_enum_nocase(const char *str, size_t len);
 
 /** GNSS signal identifier. */
 typedef struct {
@@ -340,6 +353,97 @@ typedef enum sbas_system_e {
 
 typedef bool (*sid_eq_fn)(const gnss_signal_t a);
 
+/** Determine if a code is valid.
+ *
+ * \param code    Code to use.
+ * \return true if code is valid, false otherwise
+ */
+static inline bool code_valid(code_t code) {
+  return ((code >= 0) && (code < CODE_COUNT));
+}
+
+/** Properties of a code read on the signal lookup hot paths.
+ *
+ * A subset of the code table in signal.c, packed so that four codes share a
+ * cache line.
+ */
+typedef struct {
+  float chip_rate;
+  u16 sat_start;
+  u16 sat_count;
+  u16 sig_count;
+  u16 prn_period_ms;
+  u16 global_start;
+  s8 constellation;
+} code_props_t;
+
+/** Table of code properties, indexed by code, `CODE_COUNT` holds the
+ * properties of an invalid code. */
+extern const code_props_t code_props[CODE_COUNT + 1];
+
+/** Carrier of a signal. */
+typedef struct {
+  double freq;       /**< Carrier frequency [Hz]. */
+  double lambda;     /**< Wavelength in a vacuum [m]. */
+  double inv_lambda; /**< Reciprocal of the wavelength [1/m]. */
+} sid_carrier_t;
+
+/** Carrier of each signal, located through `sid_carrier_rows`. Entry `code`
+ * is the carrier of a CDMA code or the band centre of a GLONASS FDMA code.
+ * They are followed by a row per GLONASS FDMA band: the band centre and then
+ * the carrier of each frequency slot. */
+extern const sid_carrier_t sid_carrier_table[];
+
+/** Row of each code in `sid_carrier_table`. The low 16 bits are the offset of
+ * the row, the high 16 bits a mask applied to the frequency slot of the
+ * satellite: 0 for CDMA codes, which have a single entry, and all ones for
+ * the GLONASS FDMA codes. */
+extern const u32 sid_carrier_rows[CODE_COUNT + 1];
+
+/** Number of entries of `sid_carrier_glo_fcn`, the satellite number is
+ * masked to it. */
+#define SID_CARRIER_GLO_SLOTS 32
+
+/** Frequency slot of each GLONASS orbital slot as seen by sid_to_carrier(),
+ * `GLO_FCN_UNKNOWN` if none is mapped. Only written by
+ * sid_carrier_set_glo_fcn(). */
+extern u8 sid_carrier_glo_fcn[SID_CARRIER_GLO_SLOTS];
+
+/* Accesses of `sid_carrier_glo_fcn`. A frequency slot is published with a
+ * release store and read with an acquire load, so a reader that sees it also
+ * sees the GLO map entry written before it. */
+#if defined(__GNUC__) || defined(__clang__)
+#define SID_CARRIER_LOAD_FCN(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define SID_CARRIER_STORE_FCN(p, v) \
+  __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+/* Single byte volatile accesses, which MSVC orders as acquire and release. */
+#define SID_CARRIER_LOAD_FCN(p) (*(const volatile u8 *)(p))
+#define SID_CARRIER_STORE_FCN(p, v) (*(volatile u8 *)(p) = (v))
+#endif
+
+/** Carrier of a signal, a single table lookup.
+ *
+ * GLONASS FDMA satellites whose frequency slot is not mapped get the
+ * carrier at the centre of the band.
+ *
+ * \param sid Signal, not checked for validity
+ * \return Carrier frequency and wavelength of `sid`
+ */
+static inline const sid_carrier_t *sid_to_carrier(gnss_signal_t sid) {
+  u32 row = sid_carrier_rows[sid.code];
+  u8 fcn = SID_CARRIER_LOAD_FCN(
+      &sid_carrier_glo_fcn[sid.sat & (SID_CARRIER_GLO_SLOTS - 1)]);
+  return &sid_carrier_table[(row & 0xFFFF) + (fcn & (row >> 16))];
+}
+
+void sid_carrier_set_glo_fcn(u16 glo_slot_id, u16 fcn);
+
+/* The lookups below are inlined reads of `code_props` and
+ * `sid_carrier_table` without asserts. Define
+ * LIBSWIFTNAV_CHECKED_SIGNAL_LOOKUP (CMake option of the same name) to call
+ * the asserting versions in the library instead, which are always built. */
+#ifdef LIBSWIFTNAV_CHECKED_SIGNAL_LOOKUP
 bool is_gps(const code_t code);
 bool is_sbas(const code_t code);
 bool is_glo(const code_t code);
@@ -348,6 +452,85 @@ bool is_gal(const code_t code);
 bool is_qzss(const code_t code);
 
 constellation_t sid_to_constellation(gnss_signal_t sid);
+constellation_t code_to_constellation(code_t code);
+bool sid_valid(gnss_signal_t sid);
+u16 sid_to_code_index(gnss_signal_t sid);
+u16 sid_to_global_index(gnss_signal_t sid);
+double code_to_chip_rate(code_t code);
+u16 code_to_prn_period_ms(code_t code);
+u16 code_to_sig_count(const code_t code);
+double sid_to_carr_freq(gnss_signal_t sid);
+double sid_to_lambda(gnss_signal_t sid);
+#else
+static inline bool is_gps(const code_t code) {
+  return (CONSTELLATION_GPS == code_props[code].constellation);
+}
+
+static inline bool is_sbas(const code_t code) {
+  return (CONSTELLATION_SBAS == code_props[code].constellation);
+}
+
+static inline bool is_glo(const code_t code) {
+  return (CONSTELLATION_GLO == code_props[code].constellation);
+}
+
+static inline bool is_bds2(const code_t code) {
+  return (CONSTELLATION_BDS == code_props[code].constellation);
+}
+
+static inline bool is_gal(const code_t code) {
+  return (CONSTELLATION_GAL == code_props[code].constellation);
+}
+
+static inline bool is_qzss(const code_t code) {
+  return (CONSTELLATION_QZS == code_props[code].constellation);
+}
+
+static inline constellation_t sid_to_constellation(gnss_signal_t sid) {
+  return (constellation_t)code_props[sid.code].constellation;
+}
+
+static inline constellation_t code_to_constellation(code_t code) {
+  return (constellation_t)code_props[code].constellation;
+}
+
+static inline bool sid_valid(gnss_signal_t sid) {
+  if (!code_valid(sid.code)) {
+    return false;
+  }
+  const code_props_t *p = &code_props[sid.code];
+  return (sid.sat >= p->sat_start) && (sid.sat < p->sat_start + p->sat_count);
+}
+
+static inline u16 sid_to_code_index(gnss_signal_t sid) {
+  return (u16)(sid.sat - code_props[sid.code].sat_start);
+}
+
+static inline u16 sid_to_global_index(gnss_signal_t sid) {
+  const code_props_t *p = &code_props[sid.code];
+  return (u16)(p->global_start + sid.sat - p->sat_start);
+}
+
+static inline double code_to_chip_rate(code_t code) {
+  return code_props[code].chip_rate;
+}
+
+static inline u16 code_to_prn_period_ms(code_t code) {
+  return code_props[code].prn_period_ms;
+}
+
+static inline u16 code_to_sig_count(const code_t code) {
+  return code_props[code].sig_count;
+}
+
+static inline double sid_to_carr_freq(gnss_signal_t sid) {
+  return sid_to_carrier(sid)->freq;
+}
+
+static inline double sid_to_lambda(gnss_signal_t sid) {
+  return sid_to_carrier(sid)->lambda;
+}
+#endif /* LIBSWIFTNAV_CHECKED_SIGNAL_LOOKUP */
 
 static inline code_t constellation_to_l1_code(constellation_t constellation) {
   switch (constellation) {
@@ -397,15 +580,6 @@ static inline code_t sid_to_l5_code(gnss_signal_t sid) {
   return constellation_to_l5_code(sid_to_constellation(sid));
 }
 
-/** Determine if a code is valid.
- *
- * \param code    Code to use.
- * \return true if code is valid, false otherwise
- */
-static inline bool code_valid(code_t code) {
-  return ((code >= 0) && (code < CODE_COUNT));
-}
-
 static inline uint32_t sid_hash(const gnss_signal_t sid) {
   // check to make sure all constellations can be represent with uin8_t
   assert(CONSTELLATION_COUNT <= 256);
@@ -570,17 +744,12 @@ gnss_signal_t construct_sid(code_t code, u16 sat);
 int sat_code_to_string(
     char *str_buf, size_t suffix_len, const char *suffix, u16 sat, code_t code);
 int sid_to_string(char *s, int n, const gnss_signal_t sid);
-bool sid_valid(gnss_signal_t sid);
+size_t sid_to_string_n(char *s, size_t n, const gnss_signal_t sid);
 bool constellation_valid(constellation_t constellation);
 gnss_signal_t sid_from_code_index(code_t code, u16 sat_index);
-u16 sid_to_code_index(gnss_signal_t sid);
-constellation_t code_to_constellation(code_t code);
-double sid_to_carr_freq(gnss_signal_t sid);
-double sid_to_lambda(gnss_signal_t sid);
+gnss_signal_t global_index_to_sid(u16 global_index);
 const char *code_to_string(const code_t code);
 u32 code_to_chip_count(code_t code);
-double code_to_chip_rate(code_t code);
-u16 code_to_prn_period_ms(code_t code);
 bool code_requires_direct_acq(code_t code);
 float code_to_sv_doppler_min(code_t code);
 float code_to_sv_doppler_max(code_t code);
@@ -589,7 +758,6 @@ u16 constellation_to_sat_count(constellation_t gnss);
 const u8 *get_sbas_prn_list(sbas_system_t sbas_system);
 sbas_system_t get_sbas_system(const gnss_signal_t sid);
 float code_to_phase_alignment(code_t code);
-u16 code_to_sig_count(const code_t code);
 
 #ifdef __cplusplus
 } /* extern "C" */
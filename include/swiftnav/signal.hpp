@@ -0,0 +1,323 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef LIBSWIFTNAV_SIGNAL_HPP
+#define LIBSWIFTNAV_SIGNAL_HPP
+
+#include <assert.h>
+#include <swiftnav/constants.h>
+#include <swiftnav/signal.h>
+
+/* Header only C++ counterparts of the code table queries in signal.h.
+ *
+ * The functions are constexpr and read a copy of the table built at compile
+ * time from the same code_table.h entries as the C library, so a query on a
+ * constant code folds to a constant. Call them qualified, `swiftnav::`, as
+ * argument dependent lookup also finds the C functions of the same name.
+ */
+namespace swiftnav {
+
+/** Properties of a code, see code_table.h. */
+struct code_info {
+  constellation_t constellation;
+  u16 sat_count;
+  u16 sig_count;
+  u16 sat_start;
+  const char *str;
+  double carr_freq;
+  u32 chip_count;
+  double chip_rate;
+  bool requires_direct_acq;
+  u16 prn_period_ms;
+  float sv_doppler_max;
+  float phase_alignment_cycles;
+  bool requires_data_decoder;
+  /** First global index of the code, see `sid_to_global_index()`. */
+  u16 global_start = 0;
+};
+
+namespace detail {
+
+struct code_info_table {
+  code_info codes[CODE_COUNT + 1];
+};
+
+constexpr code_info_table make_code_info_table() {
+  code_info_table t{};
+  t.codes[CODE_COUNT] = code_info{CONSTELLATION_INVALID,
+                                  0,
+                                  0,
+                                  0,
+                                  "Invalid code",
+                                  0,
+                                  0,
+                                  0,
+                                  false,
+                                  0,
+                                  0.f,
+                                  0.f,
+                                  false};
+#define CODE_TABLE_ENTRY(code, ...) t.codes[code] = code_info{__VA_ARGS__};
+#include <swiftnav/code_table.h>
+  /* Global indices follow the order of code_table.h, as in signal.c. */
+  u16 global_start = 0;
+#define CODE_TABLE_ENTRY(code, ...)                                       \
+  t.codes[code].global_start = global_start;                              \
+  global_start = static_cast<u16>(global_start + t.codes[code].sat_count);
+#include <swiftnav/code_table.h>
+  t.codes[CODE_COUNT].global_start = global_start;
+  return t;
+}
+
+constexpr code_info_table code_infos = make_code_info_table();
+
+static_assert(code_infos.codes[CODE_COUNT].global_start == SID_GLOBAL_COUNT,
+              "SID_GLOBAL_COUNT does not match the code table");
+
+}  // namespace detail
+
+/** Determine if a code is valid. */
+constexpr bool code_valid(code_t code) {
+  return code >= 0 && code < CODE_COUNT;
+}
+
+/** Properties of a code, or of the invalid code for an unknown code. */
+constexpr const code_info &code_to_info(code_t code) {
+  return detail::code_infos.codes[swiftnav::code_valid(code) ? code
+                                                             : CODE_COUNT];
+}
+
+constexpr constellation_t code_to_constellation(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return swiftnav::code_to_info(code).constellation;
+}
+
+constexpr constellation_t sid_to_constellation(gnss_signal_t sid) {
+  return swiftnav::code_to_info(sid.code).constellation;
+}
+
+constexpr bool sid_valid(gnss_signal_t sid) {
+  return swiftnav::code_valid(sid.code) &&
+         sid.sat >= swiftnav::code_to_info(sid.code).sat_start &&
+         sid.sat < swiftnav::code_to_info(sid.code).sat_start +
+                       swiftnav::code_to_info(sid.code).sat_count;
+}
+
+constexpr gnss_signal_t sid_from_code_index(code_t code, u16 sat_index) {
+  assert(swiftnav::code_valid(code));
+  assert(sat_index < swiftnav::code_to_info(code).sat_count);
+  return gnss_signal_t{
+      static_cast<u16>(swiftnav::code_to_info(code).sat_start + sat_index),
+      code};
+}
+
+constexpr u16 sid_to_code_index(gnss_signal_t sid) {
+  assert(swiftnav::sid_valid(sid));
+  return static_cast<u16>(sid.sat - swiftnav::code_to_info(sid.code).sat_start);
+}
+
+constexpr const char *code_to_string(code_t code) {
+  return swiftnav::code_to_info(code).str;
+}
+
+constexpr u32 code_to_chip_count(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return swiftnav::code_to_info(code).chip_count;
+}
+
+constexpr double code_to_chip_rate(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return swiftnav::code_to_info(code).chip_rate;
+}
+
+constexpr u16 code_to_prn_period_ms(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return swiftnav::code_to_info(code).prn_period_ms;
+}
+
+constexpr bool code_requires_direct_acq(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return swiftnav::code_to_info(code).requires_direct_acq;
+}
+
+constexpr float code_to_sv_doppler_min(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return -swiftnav::code_to_info(code).sv_doppler_max;
+}
+
+constexpr float code_to_sv_doppler_max(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return +swiftnav::code_to_info(code).sv_doppler_max;
+}
+
+constexpr bool code_requires_decoder(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return swiftnav::code_to_info(code).requires_data_decoder;
+}
+
+constexpr float code_to_phase_alignment(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return swiftnav::code_to_info(code).phase_alignment_cycles;
+}
+
+constexpr u16 code_to_sig_count(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return swiftnav::code_to_info(code).sig_count;
+}
+
+constexpr code_t constellation_to_l1_code(constellation_t constellation) {
+  switch (constellation) {
+    case CONSTELLATION_GPS:
+      return CODE_GPS_L1CA;
+    case CONSTELLATION_SBAS:
+      return CODE_SBAS_L1CA;
+    case CONSTELLATION_GLO:
+      return CODE_GLO_L1OF;
+    case CONSTELLATION_BDS:
+      return CODE_BDS2_B1;
+    case CONSTELLATION_QZS:
+      return CODE_QZS_L1CA;
+    case CONSTELLATION_GAL:
+      return CODE_GAL_E1B;
+    case CONSTELLATION_INVALID:
+    case CONSTELLATION_COUNT:
+    default:
+      return CODE_INVALID;
+  }
+}
+
+constexpr u16 constellation_to_sat_count(constellation_t gnss) {
+  assert(swiftnav::code_valid(swiftnav::constellation_to_l1_code(gnss)));
+  return swiftnav::code_to_info(swiftnav::constellation_to_l1_code(gnss))
+      .sat_count;
+}
+
+constexpr bool is_gps(code_t code) {
+  return CONSTELLATION_GPS == swiftnav::code_to_info(code).constellation;
+}
+
+constexpr bool is_sbas(code_t code) {
+  return CONSTELLATION_SBAS == swiftnav::code_to_info(code).constellation;
+}
+
+constexpr bool is_glo(code_t code) {
+  return CONSTELLATION_GLO == swiftnav::code_to_info(code).constellation;
+}
+
+constexpr bool is_bds2(code_t code) {
+  return CONSTELLATION_BDS == swiftnav::code_to_info(code).constellation;
+}
+
+constexpr bool is_gal(code_t code) {
+  return CONSTELLATION_GAL == swiftnav::code_to_info(code).constellation;
+}
+
+constexpr bool is_qzss(code_t code) {
+  return CONSTELLATION_QZS == swiftnav::code_to_info(code).constellation;
+}
+
+/** Index of a signal among the signals of all codes, see
+ * `sid_to_global_index()` in signal.h. */
+constexpr u16 sid_to_global_index(gnss_signal_t sid) {
+  assert(swiftnav::sid_valid(sid));
+  return static_cast<u16>(swiftnav::code_to_info(sid.code).global_start +
+                          swiftnav::sid_to_code_index(sid));
+}
+
+/** Signal of a global signal index, see `global_index_to_sid()`. */
+constexpr gnss_signal_t global_index_to_sid(u16 global_index) {
+  assert(global_index < SID_GLOBAL_COUNT);
+  int code = 0;
+  while (global_index < detail::code_infos.codes[code].global_start ||
+         global_index >= detail::code_infos.codes[code].global_start +
+                             detail::code_infos.codes[code].sat_count) {
+    code++;
+  }
+  return swiftnav::sid_from_code_index(
+      static_cast<code_t>(code),
+      static_cast<u16>(global_index -
+                       detail::code_infos.codes[code].global_start));
+}
+
+/** Array holding a `T` for every signal, indexed by `gnss_signal_t`.
+ *
+ * A flat replacement for a map keyed on `sid_hash()`, an element is found
+ * with two loads from the code table instead of a hash lookup. Elements can
+ * also be visited in global index order through `begin()` and `end()`.
+ */
+template <typename T>
+struct sid_array {
+  T values[SID_GLOBAL_COUNT];
+
+  constexpr T &operator[](gnss_signal_t sid) {
+    return values[swiftnav::sid_to_global_index(sid)];
+  }
+
+  constexpr const T &operator[](gnss_signal_t sid) const {
+    return values[swiftnav::sid_to_global_index(sid)];
+  }
+
+  static constexpr u16 size() { return SID_GLOBAL_COUNT; }
+
+  constexpr T *begin() { return values; }
+  constexpr T *end() { return values + SID_GLOBAL_COUNT; }
+  constexpr const T *begin() const { return values; }
+  constexpr const T *end() const { return values + SID_GLOBAL_COUNT; }
+};
+
+/** Nominal carrier frequency of a code [Hz].
+ *
+ * For the GLONASS FDMA codes this is the centre of the band, use
+ * `glo_carr_freq()` or `sid_to_carr_freq()` for a particular satellite.
+ */
+constexpr double code_to_carr_freq(code_t code) {
+  assert(swiftnav::code_valid(code));
+  return swiftnav::code_to_info(code).carr_freq;
+}
+
+/** Nominal carrier wavelength of a code [m], see `code_to_carr_freq()`. */
+constexpr double code_to_lambda(code_t code) {
+  return GPS_C / swiftnav::code_to_carr_freq(code);
+}
+
+/** Carrier frequency of a GLONASS FDMA code on a frequency slot [Hz].
+ *
+ * \param code CODE_GLO_L1OF or CODE_GLO_L2OF
+ * \param fcn Frequency slot, offset by GLO_FCN_OFFSET
+ */
+constexpr double glo_carr_freq(code_t code, u16 fcn) {
+  assert(CODE_GLO_L1OF == code || CODE_GLO_L2OF == code);
+  return CODE_GLO_L1OF == code
+             ? GLO_L1_HZ + (fcn - GLO_FCN_OFFSET) * GLO_L1_DELTA_HZ
+             : GLO_L2_HZ + (fcn - GLO_FCN_OFFSET) * GLO_L2_DELTA_HZ;
+}
+
+/** Carrier frequency of a signal [Hz].
+ *
+ * Only constant for CDMA codes, GLONASS FDMA signals go through the GLO
+ * frequency slot map of the C library.
+ */
+inline double sid_to_carr_freq(gnss_signal_t sid) {
+  if (CODE_GLO_L1OF == sid.code || CODE_GLO_L2OF == sid.code) {
+    return ::sid_to_carr_freq(sid);
+  }
+  return swiftnav::code_to_carr_freq(sid.code);
+}
+
+/** Carrier wavelength of a signal [m], see `sid_to_carr_freq()`. */
+inline double sid_to_lambda(gnss_signal_t sid) {
+  return GPS_C / swiftnav::sid_to_carr_freq(sid);
+}
+
+}  // namespace swiftnav
+
+#endif /* LIBSWIFTNAV_SIGNAL_HPP */
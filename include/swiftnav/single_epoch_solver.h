@@ -18,6 +18,7 @@
 #include <swiftnav/nav_meas.h>
 #include <swiftnav/sid_set.h>
 #include <swiftnav/troposphere.h>
+#include <swiftnav/udu_filter.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -138,6 +139,39 @@ s8 calc_PVT_pred(const u8 n_meas,
                  dops_t *dops,
                  gnss_sid_set_t *raim_removed_sids);
 
+/** Process noise settings of the recursive position filter. */
+typedef struct {
+  /** Receiver acceleration spectral density [m^2/s^3] */
+  double accel_psd;
+  /** Receiver clock bias random walk spectral density [m^2/s] */
+  double clock_bias_psd;
+  /** Receiver clock drift random walk spectral density [m^2/s^3] */
+  double clock_drift_psd;
+} pvt_filter_config_t;
+
+/** State of the recursive position filter, see calc_PVT_filter(). */
+typedef struct {
+  pvt_filter_config_t config;
+  /* Position, per-constellation clock biases, velocity and clock drift */
+  udu_filter_t kf;
+  /* Time of the last update */
+  gps_time_t t;
+  bool initialized;
+  bool clock_initialized[CONSTELLATION_COUNT];
+} pvt_filter_t;
+
+void pvt_filter_init(pvt_filter_t *filter, const pvt_filter_config_t *config);
+void pvt_filter_reset(pvt_filter_t *filter);
+s8 calc_PVT_filter(pvt_filter_t *filter,
+                   const u8 n_meas,
+                   const navigation_measurement_t nav_meas[],
+                   const gps_time_t *tor,
+                   const bool disable_velocity,
+                   const obs_mask_config_t *obs_mask_config,
+                   gnss_solution *soln,
+                   dops_t *dops,
+                   gnss_sid_set_t *rejected_sids);
+
 u8 get_max_channels(void);
 
 #ifdef __cplusplus
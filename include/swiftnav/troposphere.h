@@ -13,6 +13,7 @@
 #ifndef LIBSWIFTNAV_TROPOSPHERE_H
 #define LIBSWIFTNAV_TROPOSPHERE_H
 
+#include <stddef.h>
 #include <swiftnav/gnss_time.h>
 
 #ifdef __cplusplus
@@ -27,7 +28,32 @@ extern "C" {
 /* truncate satellite elevations near or below zero [deg] */
 #define MIN_SAT_ELEVATION 0.1
 
+/** Receiver dependent part of the UNB3m troposphere model, see
+ * calc_troposphere_zenith(). */
+typedef struct {
+  double zhd;     /**< Zenith hydrostatic delay [m] */
+  double zwd;     /**< Zenith wet delay [m] */
+  double mhf_a;   /**< Hydrostatic mapping function coefficient a */
+  double mhf_b;   /**< Hydrostatic mapping function coefficient b */
+  double mhf_c;   /**< Hydrostatic mapping function coefficient c */
+  double mhf_top; /**< Hydrostatic mapping function numerator */
+  double mwf_a;   /**< Wet mapping function coefficient a */
+  double mwf_b;   /**< Wet mapping function coefficient b */
+  double mwf_c;   /**< Wet mapping function coefficient c */
+  double mwf_top; /**< Wet mapping function numerator */
+  double h;       /**< Receiver height, truncated at zero [m] */
+} tropo_zenith_t;
+
 double calc_troposphere(const double doy, double lat, double h, double el);
+void calc_troposphere_zenith(const double doy,
+                             double lat,
+                             double h,
+                             tropo_zenith_t *zenith);
+double calc_troposphere_slant(const tropo_zenith_t *zenith, double el);
+void calc_troposphere_slant_batch(const tropo_zenith_t *zenith,
+                                  size_t n,
+                                  const double *el,
+                                  double *delay);
 
 #ifdef __cplusplus
 } /* extern "C" */
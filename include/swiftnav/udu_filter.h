@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef LIBSWIFTNAV_UDU_FILTER_H
+#define LIBSWIFTNAV_UDU_FILTER_H
+
+#include <swiftnav/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Maximum number of states supported by a UDU filter. */
+#define UDU_FILTER_MAX_STATES 16
+
+/** Maximum number of process noise inputs in a time update. */
+#define UDU_FILTER_MAX_NOISE UDU_FILTER_MAX_STATES
+
+/** Kalman filter with the covariance held in \f$U D U^{T}\f$ factored form.
+ *
+ * All storage, including the scratch space used by the time update, is
+ * preallocated so that a filter can live in static memory. Matrices are
+ * stored row-major with a stride of `n`, i.e. only the first `n * n`
+ * elements of `U` are used.
+ */
+typedef struct {
+  /** Number of states. */
+  u32 n;
+  /** State estimate. */
+  double x[UDU_FILTER_MAX_STATES];
+  /** Unit upper triangular covariance factor. */
+  double U[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+  /** Diagonal covariance factor. */
+  double D[UDU_FILTER_MAX_STATES];
+  /** Scratch space for the time update. */
+  double work[UDU_FILTER_MAX_STATES *
+              (UDU_FILTER_MAX_STATES + UDU_FILTER_MAX_NOISE)];
+} udu_filter_t;
+
+void udu_filter_init(udu_filter_t *f, u32 n, const double *x, const double *P);
+void udu_filter_init_diag(udu_filter_t *f,
+                          u32 n,
+                          const double *x,
+                          const double *P_diag);
+void udu_filter_get_covariance(const udu_filter_t *f, double *P);
+double udu_filter_innovation_variance(const udu_filter_t *f,
+                                      const double *h,
+                                      double r);
+s8 udu_filter_update(udu_filter_t *f, const double *h, double z, double r);
+s8 udu_filter_update_sequential(udu_filter_t *f,
+                                u32 m,
+                                const double *H,
+                                const double *z,
+                                const double *r);
+s8 udu_filter_predict(udu_filter_t *f,
+                      const double *Phi,
+                      u32 p,
+                      const double *G,
+                      const double *Q_diag);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* LIBSWIFTNAV_UDU_FILTER_H */
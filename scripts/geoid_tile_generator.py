@@ -0,0 +1,99 @@
+#!/usr/bin/python3
+
+"""Rearrange a compiled in geoid table into the tiled layout read by
+src/geoid_model.c.
+
+The input is one of the src/geoid_model_*.inc tables written by
+gtx_convert.pl, GEOID[N_LON + 1][N_LAT] stored by longitude. The output holds
+the same heights
+
+- padded with the wrapped around columns x = -1 and x = N_LON..N_LON+2, so
+  that any 4x4 bicubic stencil can be read without wrapping the longitude, and
+- split into 8x8 tiles stored contiguously, each by latitude, so that a
+  stencil inside a tile occupies four consecutive 32 byte rows.
+
+The height literals are copied as text, so the tiled table is bit identical
+to the original one.
+"""
+
+import re
+import sys
+
+HEADER = """/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/******************************************************************************
+ * Automatically generated from scripts/geoid_tile_generator.py. Please do    *
+ * not hand edit!                                                             *
+ ******************************************************************************/
+"""
+
+TILE_SHIFT = 3
+TILE_SIZE = 1 << TILE_SHIFT
+PAD_WEST = 1
+PAD_EAST = 3
+
+
+def read_table(path):
+    text = open(path).read()
+    spacing = re.findall(r"static const float \w+_GRID_SPACING_DEG = .*;", text)
+    decl = re.search(r"static const float GEOID\[(\d+)\]\[(\d+)\] = \{", text)
+    n_lon = int(decl.group(1)) - 1
+    n_lat = int(decl.group(2))
+    columns = [
+        [v.strip() for v in row.split(",")]
+        for row in re.findall(r"\{([^{}]*)\}", text[decl.end():])
+    ]
+    if len(columns) != n_lon + 1 or any(len(c) != n_lat for c in columns):
+        raise ValueError("%s: GEOID is not %d by %d" % (path, n_lon + 1, n_lat))
+    return spacing, n_lon, n_lat, columns
+
+
+def main():
+    if len(sys.argv) != 3:
+        print("error: usage <input table> <output file location>",
+              file=sys.stderr)
+        exit(1)
+
+    spacing, n_lon, n_lat, columns = read_table(sys.argv[1])
+    tiles_x = -(-(n_lon + PAD_WEST + PAD_EAST) // TILE_SIZE)
+    tiles_y = -(-n_lat // TILE_SIZE)
+
+    out = [HEADER]
+    out.extend(spacing)
+    out.append("")
+    out.append("static const int GEOID_TILE_SHIFT = %d;" % TILE_SHIFT)
+    out.append("static const int GEOID_PAD_WEST = %d;" % PAD_WEST)
+    out.append("static const int GEOID_TILES_X = %d;" % tiles_x)
+    out.append("")
+    out.append("static const float GEOID_TILES[%d] = {" %
+               (tiles_x * tiles_y * TILE_SIZE * TILE_SIZE))
+    for ty in range(tiles_y):
+        for tx in range(tiles_x):
+            out.append("    /* tile (%d, %d) */" % (tx, ty))
+            for y in range(ty * TILE_SIZE, (ty + 1) * TILE_SIZE):
+                row = []
+                for px in range(tx * TILE_SIZE, (tx + 1) * TILE_SIZE):
+                    x = px - PAD_WEST
+                    if y < n_lat and x < n_lon + PAD_EAST:
+                        row.append(columns[(x + n_lon) % n_lon][y])
+                    else:
+                        row.append("0.0f")
+                out.append("    " + ", ".join(row) + ",")
+    out.append("};")
+
+    with open(sys.argv[2], "w") as f:
+        f.write("\n".join(out) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -6,6 +6,13 @@
 # 1. geoid_model_1_degree.inc: Downsampled geoid data (1 x 1 degree gid)
 # 2. geoid_model_15_minute.inc: Full resolution geoid data (0.25 x 0.25 degree grid)
 #
+# and a compact binary grid which can be loaded at runtime with
+# geoid_grid_map_file():
+#
+# 3. geoid_model_15_minute.bin: Full resolution geoid data
+# 4. geoid_model_15_minute_tiled.bin: Full resolution geoid data, quantized
+#    into delta coded tiles
+#
 # See https://vdatum.noaa.gov/docs/gtx_info.html#dev_gtx_binary for details
 # of the VDatum file format.
 #
@@ -13,11 +20,23 @@
 #
 
 use strict;
+use POSIX qw(floor);
 
 # file names
 use constant INPUT_DATA    => "egm08_25.gtx";
 use constant OUTPUT_LO_RES => "geoid_model_1_degree.inc";
 use constant OUTPUT_HI_RES => "geoid_model_15_minute.inc";
+use constant OUTPUT_BINARY => "geoid_model_15_minute.bin";
+use constant OUTPUT_TILED  => "geoid_model_15_minute_tiled.bin";
+
+# compact binary format, see src/geoid_grid.c
+use constant BINARY_MAGIC   => "LSNGEOID";
+use constant BINARY_VERSION => 1;
+use constant TILED_VERSION  => 2;
+use constant TILE_SIZE      => 32;
+use constant TILE_ENCODING_DELTA => 1;
+use constant TILE_RESOLUTION => 0.001;
+use constant GEOID_MODEL_EGM2008 => 2;
 
 # boundaries
 use constant MIN_LON => 0;
@@ -150,6 +169,113 @@ END
 }
 
 
+# write geoid data with '$spacing' (in degrees) to '$outfile' in the compact
+# binary format: a little endian header followed by little endian float
+# heights, row by row from south to north, each row from west to east
+sub write_binary_file($$) {
+    my($outfile, $spacing) = @_;
+
+    open(FILE, ">$outfile") || die "Cannot open $outfile for writing";
+    binmode FILE;
+
+    my $n_lat = (MAX_LAT - MIN_LAT) / $spacing + 1;
+    my $n_lon = (MAX_LON - MIN_LON) / $spacing;
+
+    print FILE pack("a8 V V d< d< d< d< V V",
+                    BINARY_MAGIC, BINARY_VERSION, GEOID_MODEL_EGM2008,
+                    MIN_LAT, MIN_LON, $spacing, $spacing, $n_lat, $n_lon);
+
+    for(my $lat = MIN_LAT; $lat <= MAX_LAT; $lat += $spacing) {
+        for(my $lon = MIN_LON; $lon < MAX_LON; $lon += $spacing) {
+            print FILE pack("f<", get_height($lat, $lon));
+        }
+    }
+    close(FILE);
+}
+
+
+sub min($$) {
+    return $_[0] < $_[1] ? $_[0] : $_[1];
+}
+
+
+# round to single precision
+sub to_float($) {
+    return unpack("f", pack("f", $_[0]));
+}
+
+
+# write geoid data with '$spacing' (in degrees) to '$outfile' in the tiled
+# binary format: heights are split into TILE_SIZE square tiles, quantized to
+# 16 bits per tile and delta coded as zigzag varints
+sub write_tiled_file($$) {
+    my($outfile, $spacing) = @_;
+
+    open(FILE, ">$outfile") || die "Cannot open $outfile for writing";
+    binmode FILE;
+
+    my $n_lat = (MAX_LAT - MIN_LAT) / $spacing + 1;
+    my $n_lon = (MAX_LON - MIN_LON) / $spacing;
+    my $tile_rows = int(($n_lat + TILE_SIZE - 1) / TILE_SIZE);
+    my $tile_cols = int(($n_lon + TILE_SIZE - 1) / TILE_SIZE);
+
+    my $index = "";
+    my $data = "";
+    for my $tile_row (0..$tile_rows-1) {
+        for my $tile_col (0..$tile_cols-1) {
+            my @heights;
+            for my $row ($tile_row * TILE_SIZE ..
+                         min(($tile_row + 1) * TILE_SIZE, $n_lat) - 1) {
+                for my $col ($tile_col * TILE_SIZE ..
+                             min(($tile_col + 1) * TILE_SIZE, $n_lon) - 1) {
+                    push @heights, get_height(MIN_LAT + $row * $spacing,
+                                              MIN_LON + $col * $spacing);
+                }
+            }
+
+            my($lo, $hi) = ($heights[0], $heights[0]);
+            for my $h (@heights) {
+                $lo = $h if($h < $lo);
+                $hi = $h if($h > $hi);
+            }
+            my $base = to_float($lo);
+            my $scale = ($hi - $base) / 65535;
+            $scale = TILE_RESOLUTION if($scale < TILE_RESOLUTION);
+            $scale = to_float($scale);
+
+            my $tile = "";
+            my $prev = 0;
+            for my $h (@heights) {
+                my $q = floor(($h - $base) / $scale + 0.5);
+                $q = 0 if($q < 0);
+                $q = 65535 if($q > 65535);
+                my $d = $q - $prev;
+                my $z = $d >= 0 ? 2 * $d : -2 * $d - 1;
+                do {
+                    $tile .= pack("C", ($z & 0x7F) | ($z > 0x7F ? 0x80 : 0));
+                    $z >>= 7;
+                } while($z > 0);
+                $prev = $q;
+            }
+
+            $index .= pack("V V f< f<", length($data), length($tile),
+                           $base, $scale);
+            $data .= $tile;
+        }
+    }
+
+    print FILE pack("a8 V V d< d< d< d< V V V V",
+                    BINARY_MAGIC, TILED_VERSION, GEOID_MODEL_EGM2008,
+                    MIN_LAT, MIN_LON, $spacing, $spacing, $n_lat, $n_lon,
+                    TILE_SIZE, TILE_ENCODING_DELTA);
+    print FILE $index;
+    print FILE $data;
+    close(FILE);
+}
+
+
 read_file(INPUT_DATA);
 write_geoid_file(OUTPUT_LO_RES, 1);
 write_geoid_file(OUTPUT_HI_RES, 0.25);
+write_binary_file(OUTPUT_BINARY, 0.25);
+write_tiled_file(OUTPUT_TILED, 0.25);
@@ -53,6 +53,18 @@ static const s32 utc_leaps[][3] = {
 {%- endfor -%}
 };
 
+/**
+ * Start times of the UTC leap second events of `utc_leaps` in seconds since
+ * the GPS epoch, for searching the table without forming `gps_time_t`s.
+ */
+static const s64 utc_leap_secs[] = {
+{% for utc_leap_item in utc_leap_list %}
+{%- if utc_leap_item.to_gps_clock().seconds_since_epoch() >= 0 -%}
+  {{utc_leap_item.to_gps_clock().offset_seconds(-1).seconds_since_epoch()}}, /* {{utc_leap_item.to_date_string()}} */
+{% endif %}
+{%- endfor -%}
+};
+
 /** GPS time when the utc_leaps table expires {{utc_leap_list_expires.to_date_string()}} */
 static const s32 gps_time_utc_leaps_expiry[2] = { {{utc_leap_list_expires.to_gps_clock().wn()}}, {{utc_leap_list_expires.to_gps_clock().tow()}} };
 
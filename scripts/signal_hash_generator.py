@@ -0,0 +1,122 @@
+#!/usr/bin/python3
+
+"""Generate the perfect hash tables used to parse code and constellation labels.
+
+The labels are read from include/swiftnav/code_table.h and src/signal.c. For
+each set of labels a seed is searched for such that the FNV-1a hash of the
+upper cased label, seeded with it, sends every label to its own slot. The
+same table then serves the exact and the case insensitive lookups.
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+
+HEADER = """/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/******************************************************************************
+ * Automatically generated from scripts/signal_hash_generator.py. Please do   *
+ * not hand edit!                                                             *
+ ******************************************************************************/
+"""
+
+FNV_PRIME = 16777619
+
+
+def label_hash(label, seed, bits):
+    h = seed
+    for c in label.upper().encode("ascii"):
+        h = ((h ^ c) * FNV_PRIME) & 0xFFFFFFFF
+    return h >> (32 - bits)
+
+
+def find_seed(labels, bits):
+    folded = [l.upper() for l in labels]
+    if len(set(folded)) != len(folded):
+        raise ValueError("labels are not unique ignoring case")
+    for seed in range(2166136261, 2166136261 + (1 << 24)):
+        slots = {label_hash(l, seed, bits) for l in labels}
+        if len(slots) == len(labels):
+            return seed
+    raise ValueError("no perfect hash seed found")
+
+
+def code_labels():
+    text = open(os.path.join(ROOT, "include/swiftnav/code_table.h")).read()
+    labels = []
+    for entry in re.finditer(r"CODE_TABLE_ENTRY\((CODE_\w+),(.*?)\)\n", text,
+                             re.S):
+        args = re.sub(r"/\*.*?\*/", "", entry.group(2)).split(",")
+        labels.append((entry.group(1), args[4].strip().strip('"')))
+    return labels
+
+
+def string_table_labels(name):
+    text = open(os.path.join(ROOT, "src/signal.c")).read()
+    body = re.search(name + r"\[\w+\] = \{(.*?)\};", text, re.S).group(1)
+    return re.findall(r"\[(\w+)\] = \"([^\"]*)\"", body)
+
+
+def emit_table(out, prefix, labels, bits):
+    seed = find_seed([l for _, l in labels], bits)
+    slots = ["-1"] * (1 << bits)
+    for enum, label in labels:
+        slots[label_hash(label, seed, bits)] = enum
+    out.append("#define %s_HASH_SEED %dU" % (prefix.upper(), seed))
+    out.append("#define %s_HASH_BITS %d" % (prefix.upper(), bits))
+    out.append("")
+    decl = "static const s8 %s_hash_table[1 << %s_HASH_BITS] = {" % (
+        prefix, prefix.upper())
+    indent = "   "
+    if len(decl) > 80:
+        decl = decl.replace("s8 ", "s8\n    ", 1)
+        indent = "       "
+    out.append(decl)
+    line = indent
+    for slot in slots:
+        if len(line) + len(slot) + 2 > 80:
+            out.append(line)
+            line = indent
+        line += " %s," % slot
+    out.append(line)
+    out.append("};")
+    out.append("")
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("error: usage <output file location>", file=sys.stderr)
+        exit(1)
+
+    codes = code_labels()
+    out = [HEADER]
+    emit_table(out, "code", codes, 8)
+    out.append("static const u8 code_label_len[CODE_COUNT + 1] = {")
+    for enum, label in codes:
+        out.append("    [%s] = %d," % (enum, len(label)))
+    out.append("    [CODE_COUNT] = 0,")
+    out.append("};")
+    out.append("")
+    emit_table(out, "constellation",
+               string_table_labels("constellation_table"), 4)
+    emit_table(out, "sub_constellation",
+               string_table_labels("sub_constellation_table"), 4)
+
+    with open(sys.argv[1], "w") as f:
+        f.write("\n".join(out).rstrip("\n") + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -59,6 +59,28 @@ u16 bytes_interleave(const u8 x, const u8 y) {
   return z;
 }
 
+/* Load `n <= 8` bytes as a big endian word, reading no further. */
+static inline u64 load_be(const u8 *buff, u32 n) {
+  u64 word = 0;
+  for (u32 i = 0; i < n; i++) {
+    word = (word << 8) | buff[i];
+  }
+  return word;
+}
+
+/* Store the low `n <= 8` bytes of a word big endian. */
+static inline void store_be(u8 *buff, u32 n, u64 word) {
+  for (u32 i = n; i > 0; i--) {
+    buff[i - 1] = (u8)word;
+    word >>= 8;
+  }
+}
+
+/* Mask of the low `len` bits, 0 < len <= 64. */
+static inline u64 low_mask(u32 len) {
+  return ~UINT64_C(0) >> (64 - len);
+}
+
 /** Get bit field from buffer as an unsigned integer.
  * Unpacks `len` bits at bit position `pos` from the start of the buffer.
  * Maximum bit field length is 32 bits, i.e. `len <= 32`.
@@ -69,32 +91,43 @@ u16 bytes_interleave(const u8 x, const u8 y) {
  * \return Bit field as an unsigned value.
  */
 u32 getbitu(const u8 *buff, u32 pos, u8 len) {
-  u32 bits = 0;
-
-  for (u32 i = pos; i < pos + len; i++) {
-    bits = (bits << 1) + ((buff[i / 8] >> (7 - i % 8)) & 1u);
-  }
-
-  return bits;
+  return (u32)getbitul(buff, pos, len);
 }
 
 /** Get bit field from buffer as an unsigned long integer.
  * Unpacks `len` bits at bit position `pos` from the start of the buffer.
  * Maximum bit field length is 64 bits, i.e. `len <= 64`.
  *
+ * The bytes spanned by the field are loaded into a word at once and the
+ * field is shifted and masked out of it. Only those bytes are read, the
+ * buffer may end right after the field.
+ *
  * \param buff
  * \param pos Position in buffer of start of bit field in bits.
  * \param len Length of bit field in bits.
  * \return Bit field as an unsigned value.
  */
 u64 getbitul(const u8 *buff, u32 pos, u8 len) {
-  u64 bits = 0;
+  if ((len == 0) || (64 < len)) {
+    return 0;
+  }
+
+  /* skip untouched bytes */
+  buff += pos / 8;
 
-  for (u32 i = pos; i < pos + len; i++) {
-    bits = (bits << 1) + ((buff[i / 8] >> (7 - i % 8)) & 1u);
+  /* bits from the start of the first byte to the end of the field */
+  u32 end = (pos % 8) + len;
+  u32 n_bytes = (end + 7) / 8;
+
+  if (n_bytes > 8) {
+    /* the field spans nine bytes, take the bits of the first one and the
+     * remaining field from the following eight */
+    u32 len_tail = end - 8;
+    u64 head = buff[0] & (0xFFu >> (pos % 8));
+    return (head << len_tail) | getbitul(buff + 1, 0, (u8)len_tail);
   }
 
-  return bits;
+  return (load_be(buff, n_bytes) >> (8 * n_bytes - end)) & low_mask(len);
 }
 
 /** Get bit field from buffer as a signed integer.
@@ -147,71 +180,24 @@ s64 getbitsl(const u8 *buff, u32 pos, u8 len) {
  * \param pos Position in buffer of start of bit field in bits.
  * \param len Length of bit field in bits.
  * \param data Unsigned integer to be packed into bit field.
- *
- * Note: the naive implementation of this function would be to set
- * each bit in the output individually, e.g.:
- *
- *  for (u32 i = pos; i < pos + len; i++, mask >>= 1) {
- *    if (data & mask) {
- *      buff[i / 8] |= 1u << (7 - i % 8);
- *    } else {
- *      buff[i / 8] &= ~(1u << (7 - i % 8));
- *    }
- *  }
- *
- * However this approach would read and write to memory 'len' times.
- * The approach used here updates the output byte-wise, meaning that a
- * maximum of 5 read/writes to memory are needed.
  */
 void setbitu(u8 *buff, u32 pos, u32 len, u32 data) {
   if (len <= 0 || 32 < len) {
     return;
   }
-
-  /* skip untouched bytes */
-  buff += pos / 8;
-
-  /* number of bits remaining in pos + len */
-  u8 shift = (pos % 8) + len;
-  /* round up to get total number of bits we are interested in */
-  u8 count = ((shift + 7) >> 3) << 3;
-  /* compute difference to nearest multiple of 8 */
-  shift = count - shift;
-
-  /* mask of bits to take from 'data' */
-  u32 data_mask = (len == 32 ? ~0 : ((1 << len) - 1));
-  /* in case 'data' has more bits than specified in 'len' */
-  data &= data_mask;
-
-  /* special handling for the case where a fifth output byte is needed
-   * (needed to prevent bits from being lost during shift left) */
-  if (count == 40) {
-    count -= 8;
-
-    u8 mask = data_mask >> (count - shift);
-    u8 bits = data >> (count - shift);
-
-    *buff = (*buff & ~mask) | bits;
-    buff++;
-  }
-
-  /* main loop: compute a mask of bits to clear and bits to set, then
-   * apply the mask and bits in-place */
-  while (count) {
-    count -= 8;
-
-    u8 mask = (data_mask << shift) >> count;
-    u8 bits = (data << shift) >> count;
-
-    *buff = (*buff & ~mask) | bits;
-    buff++;
-  }
+  setbitul(buff, pos, len, data);
 }
 
 /** Set bit field in buffer from an
  * unsigned integer. Packs `len` bits into bit position `pos` from the start of
  * the buffer. Maximum bit field length is 64 bits, i.e. `len <= 64`.
  *
+ * Note: the naive implementation of this function would be to set
+ * each bit in the output individually, reading and writing to memory 'len'
+ * times. Instead the bytes spanned by the field are loaded into a word at
+ * once, the field is replaced in the word and the bytes are written back.
+ * Only those bytes are read and written, bits around the field are kept.
+ *
  * \param buff
  * \param pos Position in buffer of start of bit field in bits.
  * \param len Length of bit field in bits.
@@ -225,41 +211,25 @@ void setbitul(u8 *buff, u32 pos, u32 len, u64 data) {
   /* skip untouched bytes */
   buff += pos / 8;
 
-  /* number of bits remaining in pos + len */
-  u8 shift = (uint8_t)((pos % 8) + len);
-  /* round up to get total number of bits we are interested in */
-  u8 count = (uint8_t)(((shift + 7) >> 3) << 3);
-  /* compute difference to nearest multiple of 8 */
-  shift = count - shift;
-
-  /* mask of bits to take from 'data' */
-  u64 data_mask = (len == 64 ? ~UINT64_C(0) : ((UINT64_C(1) << len) - 1));
-  /* in case 'data' has more bits than specified in 'len' */
-  data &= data_mask;
-
-  /* special handling for the case where a ninth output byte is needed
-   * (needed to prevent bits from being lost during shift left) */
-  if (count == 72) {
-    count -= 8;
-
-    u8 mask = (uint8_t)(data_mask >> (count - shift));
-    u8 bits = (uint8_t)(data >> (count - shift));
-
-    *buff = (*buff & ~mask) | bits;
-    buff++;
+  /* bits from the start of the first byte to the end of the field */
+  u32 end = (pos % 8) + len;
+  u32 n_bytes = (end + 7) / 8;
+
+  if (n_bytes > 8) {
+    /* the field spans nine bytes, set the bits of the first one and the
+     * remaining field in the following eight */
+    u32 len_tail = end - 8;
+    u8 mask = (u8)(0xFFu >> (pos % 8));
+    buff[0] = (u8)((buff[0] & ~mask) | ((data >> len_tail) & mask));
+    setbitul(buff + 1, 0, len_tail, data);
+    return;
   }
 
-  /* main loop: compute a mask of bits to clear and bits to set, then
-   * apply the mask and bits in-place */
-  while (count) {
-    count -= 8;
-
-    u8 mask = (uint8_t)((data_mask << shift) >> count);
-    u8 bits = (uint8_t)((data << shift) >> count);
-
-    *buff = (*buff & ~mask) | bits;
-    buff++;
-  }
+  u32 shift = 8 * n_bytes - end;
+  u64 mask = low_mask(len) << shift;
+  u64 word = load_be(buff, n_bytes);
+  word = (word & ~mask) | ((data << shift) & mask);
+  store_be(buff, n_bytes, word);
 }
 
 /** Set bit field in buffer from a signed integer.
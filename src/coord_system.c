@@ -10,7 +10,10 @@
  * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
  */
 
+#include <float.h>
 #include <math.h>
+#include <string.h>
+#include <swiftnav/common.h>
 #include <swiftnav/constants.h>
 #include <swiftnav/coord_system.h>
 #include <swiftnav/float_equality.h>
@@ -217,6 +220,385 @@ void wgsecef2llh(const double ecef[3], double llh[3]) {
            sqrt(e_c * e_c * C * C + S * S);
 }
 
+/** Converts from WGS84 Earth Centered, Earth Fixed (ECEF) Cartesian
+ * coordinates into WGS84 geodetic coordinates using a closed form solution.
+ *
+ * Implements the non-iterative method of Vermeille (2004). The solution
+ * requires a single cube root and no loop. Close to the evolute of the
+ * ellipse, within a few tens of kilometres of the geocenter, the closed form
+ * loses precision and eventually breaks down, so points within 0.1 of an
+ * equatorial radius (638 km) of the geocenter are converted with
+ * \ref wgsecef2llh instead. This is the only data dependent branch.
+ *
+ * Over heights from -10 km to geostationary orbit the result agrees with a
+ * high precision reference to better than \f$10^{-15}\f$ rad in latitude
+ * and 20 nm in height, the same as \ref wgsecef2llh and at the limit set by
+ * double precision input. It is typically 20-30% faster than the iterative
+ * method, see `bench/bench_coord_system.c`.
+ *
+ * References:
+ *   -# "Direct transformation from geocentric coordinates to geodetic
+ *      coordinates", H. Vermeille (2002), Journal of Geodesy 76(8).
+ *   -# "Computing geodetic coordinates from geocentric coordinates",
+ *      H. Vermeille (2004), Journal of Geodesy 78(1).
+ *
+ * \param ecef Cartesian coordinates to be converted, passed as [X, Y, Z],
+ *             all in meters.
+ * \param llh  Converted geodetic coordinates are written into this array as
+ *             [lat, lon, height] in [radians, radians, meters].
+ */
+void wgsecef2llh_closed_form(const double ecef[3], double llh[3]) {
+  const double e2 = WGS84_E * WGS84_E;
+  const double e4 = e2 * e2;
+  const double x = ecef[0];
+  const double y = ecef[1];
+  const double z = ecef[2];
+  const double rho2 = x * x + y * y;
+  const double rho = sqrt(rho2);
+
+  const double p = rho2 / (WGS84_A * WGS84_A);
+  const double q = (1 - e2) / (WGS84_A * WGS84_A) * z * z;
+
+  if (p + q < 1e-2) {
+    wgsecef2llh(ecef, llh);
+    return;
+  }
+
+  const double r = (p + q - e4) / 6;
+  const double s = e4 * p * q / (4 * r * r * r);
+  const double t = cbrt(1 + s + sqrt(s * (2 + s)));
+  const double u = r * (1 + t + 1 / t);
+  const double v = sqrt(u * u + e4 * q);
+  const double w = e2 * (u + v - q) / (2 * v);
+  /* Equivalent to sqrt(u + v + w^2) - w without the cancellation. */
+  const double k = (u + v) / (sqrt(w * w + u + v) + w);
+  const double D = k * rho / (k + e2);
+  const double Dz = sqrt(D * D + z * z);
+
+  llh[0] = 2 * atan2(z, D + Dz);
+  llh[1] = (rho > 0) ? atan2(y, x) : 0;
+  llh[2] = (k + e2 - 1) / k * Dz;
+}
+
+/** Converts from WGS84 ECEF coordinates into WGS84 geodetic coordinates using
+ * the selected algorithm.
+ *
+ * \param ecef   Cartesian coordinates to be converted, passed as [X, Y, Z],
+ *               all in meters.
+ * \param llh    Converted geodetic coordinates are written into this array as
+ *               [lat, lon, height] in [radians, radians, meters].
+ * \param method Conversion algorithm.
+ */
+void wgsecef2llh_method(const double ecef[3],
+                        double llh[3],
+                        wgsecef2llh_method_t method) {
+  switch (method) {
+    case WGSECEF2LLH_CLOSED_FORM:
+      wgsecef2llh_closed_form(ecef, llh);
+      break;
+    case WGSECEF2LLH_ITERATIVE:
+    default:
+      wgsecef2llh(ecef, llh);
+      break;
+  }
+}
+
+/** Converts an array of WGS84 geodetic coordinates into WGS84 ECEF
+ * coordinates.
+ *
+ * Batched, structure-of-arrays equivalent of \ref wgsllh2ecef, giving
+ * identical results. Each output array may be the same as the corresponding
+ * input array, e.g. `lat` and `x`, to convert in place.
+ *
+ * \param n      Number of points.
+ * \param lat    Latitudes in radians, length `n`.
+ * \param lon    Longitudes in radians, length `n`.
+ * \param height Heights above the ellipsoid in meters, length `n`.
+ * \param x      Output ECEF X coordinates in meters, length `n`.
+ * \param y      Output ECEF Y coordinates in meters, length `n`.
+ * \param z      Output ECEF Z coordinates in meters, length `n`.
+ */
+void wgsllh2ecef_batch(size_t n,
+                       const double *lat,
+                       const double *lon,
+                       const double *height,
+                       double *x,
+                       double *y,
+                       double *z) {
+  const double e2 = WGS84_E * WGS84_E;
+  for (size_t i = 0; i < n; i++) {
+    const double sin_lat = sin(lat[i]);
+    const double cos_lat = cos(lat[i]);
+    const double sin_lon = sin(lon[i]);
+    const double cos_lon = cos(lon[i]);
+    const double h = height[i];
+    const double d = WGS84_E * sin_lat;
+    const double N = WGS84_A / sqrt(1. - d * d);
+
+    x[i] = (N + h) * cos_lat * cos_lon;
+    y[i] = (N + h) * cos_lat * sin_lon;
+    z[i] = ((1 - e2) * N + h) * sin_lat;
+  }
+}
+
+/** Number of points converted together by \ref wgsecef2llh_batch. Each block
+ * is staged through local arrays so that its loops have a fixed trip count
+ * and no aliasing, which lets the compiler vectorise them. */
+#define COORD_BATCH_BLOCK 16
+
+/** Number of Halley steps taken by \ref wgsecef2llh_batch. Two are enough to
+ * reach double precision outside of 0.1 equatorial radii of the geocenter. */
+#define COORD_BATCH_ITERATIONS 2
+
+/** Square root of `v >= 0` to within an ulp, without a libm call. sqrt()
+ * may set errno, which stops the compiler from vectorising a loop calling
+ * it, so start from the bit level estimate of \f$1/\sqrt{v}\f$ and refine
+ * it with Newton's method. */
+static inline double batch_sqrt(double v) {
+  u64 bits;
+  double r;
+  memcpy(&bits, &v, sizeof(bits));
+  bits = 0x5FE6EB50C7B537A9ULL - (bits >> 1);
+  memcpy(&r, &bits, sizeof(r));
+  r = r * (1.5 - 0.5 * v * r * r);
+  r = r * (1.5 - 0.5 * v * r * r);
+  r = r * (1.5 - 0.5 * v * r * r);
+  r = r * (1.5 - 0.5 * v * r * r);
+  const double s = v * r;
+  return s + 0.5 * r * (v - s * s);
+}
+
+/** Angle \f$\arctan(a / b)\f$ in \f$[0, \pi/2]\f$ for `a, b >= 0`, given
+ * \f$r = \sqrt{a^2 + b^2}\f$, without a libm call or a branch.
+ *
+ * Three applications of the half angle formula
+ * \f$\arctan(t) = 2 \arctan(t / (1 + \sqrt{1 + t^2}))\f$, the first one in
+ * terms of `a`, `b` and `r`, reduce the argument below \f$\tan(\pi/16)\f$.
+ * Terms of the Taylor series up to \f$u^{23}\f$ then leave a truncation
+ * error below \f$2 \times 10^{-18}\f$. Both `a` and `b` zero gives zero. */
+static inline double batch_atan2_positive(double a, double b, double r) {
+  double u = a / (b + r + DBL_MIN);
+  u = u / (1 + batch_sqrt(1 + u * u));
+  u = u / (1 + batch_sqrt(1 + u * u));
+  const double u2 = u * u;
+  double poly = 1. / 23;
+  poly = 1. / 21 - u2 * poly;
+  poly = 1. / 19 - u2 * poly;
+  poly = 1. / 17 - u2 * poly;
+  poly = 1. / 15 - u2 * poly;
+  poly = 1. / 13 - u2 * poly;
+  poly = 1. / 11 - u2 * poly;
+  poly = 1. / 9 - u2 * poly;
+  poly = 1. / 7 - u2 * poly;
+  poly = 1. / 5 - u2 * poly;
+  poly = 1. / 3 - u2 * poly;
+  poly = 1. - u2 * poly;
+  return 8 * u * poly;
+}
+
+/** Convert one block of `COORD_BATCH_BLOCK` points with a fixed number of
+ * Fukushima steps. Every loop is branch free and calls no libm function
+ * which may set errno. */
+static void ecef2llh_block(const double *x,
+                           const double *y,
+                           const double *z,
+                           double *lat,
+                           double *lon,
+                           double *height) {
+  const double e2 = WGS84_E * WGS84_E;
+  const double e_c = sqrt(1. - e2);
+
+  double p[COORD_BATCH_BLOCK];
+  double P[COORD_BATCH_BLOCK];
+  double Z[COORD_BATCH_BLOCK];
+  double S[COORD_BATCH_BLOCK];
+  double C[COORD_BATCH_BLOCK];
+
+  for (int j = 0; j < COORD_BATCH_BLOCK; j++) {
+    p[j] = batch_sqrt(x[j] * x[j] + y[j] * y[j]);
+    P[j] = p[j] / WGS84_A;
+    Z[j] = fabs(z[j]) * e_c / WGS84_A;
+    S[j] = Z[j];
+    C[j] = e_c * P[j];
+  }
+
+  for (int i = 0; i < COORD_BATCH_ITERATIONS; i++) {
+    for (int j = 0; j < COORD_BATCH_BLOCK; j++) {
+      const double s = S[j];
+      const double c = C[j];
+      const double A = batch_sqrt(s * s + c * c);
+      const double A3 = A * A * A;
+      const double D = Z[j] * A3 + e2 * s * s * s;
+      const double F = P[j] * A3 - e2 * c * c * c;
+      /* Halley's correction as in Fukushima (2006). wgsecef2llh() uses e in
+       * place of e^2 here, which keeps the solution but makes the
+       * convergence linear rather than cubic. */
+      const double B =
+          1.5 * e2 * s * c * c * (A * (P[j] * s - Z[j] * c) - e2 * s * c);
+      const double s_new = D * F - B * s;
+      const double c_new = F * F - B * c;
+      /* Rescale so that the larger of S and C is unity, see wgsecef2llh(). */
+      const double scale = 1.0 / (s_new > c_new ? s_new : c_new);
+      S[j] = s_new * scale;
+      C[j] = c_new * scale;
+    }
+  }
+
+  for (int j = 0; j < COORD_BATCH_BLOCK; j++) {
+    const double s = S[j];
+    const double c = C[j];
+    const double A = batch_sqrt(s * s + c * c);
+    const double r = batch_sqrt(e_c * e_c * c * c + s * s);
+    height[j] = (p[j] * e_c * c + fabs(z[j]) * s - WGS84_A * e_c * A) / r;
+    lat[j] = copysign(batch_atan2_positive(s, e_c * c, r), z[j]);
+    /* Quadrant of the longitude from the signs of x and y. Adding zero
+     * turns x = -0 into +0, so that the polar axis gives zero. */
+    const double sx = copysign(1.0, x[j] + 0.0);
+    const double lon_abs = batch_atan2_positive(fabs(y[j]), fabs(x[j]), p[j]);
+    lon[j] = copysign((1 - sx) * M_PI_2 + sx * lon_abs, y[j]);
+  }
+}
+
+/** Converts an array of WGS84 ECEF coordinates into WGS84 geodetic
+ * coordinates.
+ *
+ * Batched, structure-of-arrays equivalent of \ref wgsecef2llh. Points are
+ * converted in blocks of `COORD_BATCH_BLOCK` with two steps of Fukushima's
+ * iteration, using Halley's correction so that convergence is cubic, and
+ * square roots and arctangents evaluated without libm. The loops over a
+ * block have a fixed trip count, no branches and no calls, so the compiler
+ * vectorises them, GCC already at -O2.
+ *
+ * Over heights from -10 km to geostationary orbit the results agree with
+ * \ref wgsecef2llh to within \f$2 \times 10^{-15}\f$ rad (13 nm) and
+ * 0.1 micrometres in height, at the limit set by double precision input.
+ * Points within 0.1 of an equatorial radius (638 km) of the geocenter are
+ * converted with \ref wgsecef2llh instead, like
+ * \ref wgsecef2llh_closed_form does, and so are points on the polar axis.
+ *
+ * Converting each point with \ref wgsecef2llh takes 2.1 times as long on
+ * x86-64 with SSE2, and 3.5 to 4.5 times as long where AVX2 is enabled, see
+ * `bench/bench_coord_system.c`.
+ *
+ * Each output array may be the same as the corresponding input array, e.g.
+ * `x` and `lat`, to convert in place.
+ *
+ * \param n      Number of points.
+ * \param x      ECEF X coordinates in meters, length `n`.
+ * \param y      ECEF Y coordinates in meters, length `n`.
+ * \param z      ECEF Z coordinates in meters, length `n`.
+ * \param lat    Output latitudes in radians, length `n`.
+ * \param lon    Output longitudes in radians, length `n`.
+ * \param height Output heights above the ellipsoid in meters, length `n`.
+ */
+void wgsecef2llh_batch(size_t n,
+                       const double *x,
+                       const double *y,
+                       const double *z,
+                       double *lat,
+                       double *lon,
+                       double *height) {
+  /* Points closer to the geocenter, where two steps are not enough, or to
+   * the polar axis, where the iteration is singular, use wgsecef2llh(). */
+  const double r2_min = 0.01 * WGS84_A * WGS84_A;
+  const double p2_min = 1e-32 * WGS84_A * WGS84_A;
+  double bx[COORD_BATCH_BLOCK];
+  double by[COORD_BATCH_BLOCK];
+  double bz[COORD_BATCH_BLOCK];
+  double blat[COORD_BATCH_BLOCK];
+  double blon[COORD_BATCH_BLOCK];
+  double bheight[COORD_BATCH_BLOCK];
+
+  for (size_t i = 0; i < n; i += COORD_BATCH_BLOCK) {
+    const size_t m = MIN(COORD_BATCH_BLOCK, n - i);
+    /* Pad a partial block with a point on the equator. */
+    for (size_t j = 0; j < COORD_BATCH_BLOCK; j++) {
+      bx[j] = (j < m) ? x[i + j] : WGS84_A;
+      by[j] = (j < m) ? y[i + j] : 0;
+      bz[j] = (j < m) ? z[i + j] : 0;
+    }
+    ecef2llh_block(bx, by, bz, blat, blon, bheight);
+    for (size_t j = 0; j < m; j++) {
+      const double p2 = bx[j] * bx[j] + by[j] * by[j];
+      if (p2 + bz[j] * bz[j] < r2_min || p2 < p2_min) {
+        const double ecef[3] = {bx[j], by[j], bz[j]};
+        double llh[3];
+        wgsecef2llh(ecef, llh);
+        blat[j] = llh[0];
+        blon[j] = llh[1];
+        bheight[j] = llh[2];
+      }
+      lat[i + j] = blat[j];
+      lon[i + j] = blon[j];
+      height[i + j] = bheight[j];
+    }
+  }
+}
+
+/** Converts an array of WGS84 ECEF coordinates into WGS84 geodetic
+ * coordinates with reduced precision.
+ *
+ * Uses a single, non-iterative step of Bowring's method, which needs a few
+ * square roots and two arctangents per point instead of the iteration of
+ * \ref wgsecef2llh. It is 2.2 to 2.4 times faster than converting each
+ * point with \ref wgsecef2llh, but only gains on \ref wgsecef2llh_batch
+ * without wide vectors, see `bench/bench_coord_system.c`.
+ *
+ * Compared with \ref wgsecef2llh the latitude error is below
+ * \f$2 \times 10^{-11}\f$ rad (0.15 mm on the ground) for heights between
+ * -10 km and 100 km, and below \f$10^{-8}\f$ rad (7 cm) for heights up to
+ * 10000 km. The height error is below a micrometre over both ranges and
+ * longitude is exact. Points closer than half an Earth radius to the
+ * geocenter should use the full precision routine.
+ *
+ * References:
+ *   -# "Transformation from spatial to geographical coordinates", B. R.
+ *      Bowring (1976), Survey Review 23(181).
+ *
+ * \param n      Number of points.
+ * \param x      ECEF X coordinates in meters, length `n`.
+ * \param y      ECEF Y coordinates in meters, length `n`.
+ * \param z      ECEF Z coordinates in meters, length `n`.
+ * \param lat    Output latitudes in radians, length `n`.
+ * \param lon    Output longitudes in radians, length `n`.
+ * \param height Output heights above the ellipsoid in meters, length `n`.
+ */
+void wgsecef2llh_batch_fast(size_t n,
+                            const double *x,
+                            const double *y,
+                            const double *z,
+                            double *lat,
+                            double *lon,
+                            double *height) {
+  const double e2 = WGS84_E * WGS84_E;
+  const double ep2 = e2 / (1 - e2);
+  for (size_t i = 0; i < n; i++) {
+    const double xi = x[i];
+    const double yi = y[i];
+    const double zi = z[i];
+    const double p = sqrt(xi * xi + yi * yi);
+
+    /* Parametric latitude from the zero height solution. At the geocenter
+     * every direction is equally valid, pick the pole like wgsecef2llh(). */
+    double sin_u = zi * WGS84_A;
+    double cos_u = p * WGS84_B;
+    const double r_u = sqrt(sin_u * sin_u + cos_u * cos_u);
+    sin_u = (r_u > 0) ? sin_u / r_u : 1;
+    cos_u = (r_u > 0) ? cos_u / r_u : 0;
+
+    const double num = zi + ep2 * WGS84_B * sin_u * sin_u * sin_u;
+    const double den = p - e2 * WGS84_A * cos_u * cos_u * cos_u;
+    const double r_phi = sqrt(num * num + den * den);
+    const double sin_phi = num / r_phi;
+    const double cos_phi = den / r_phi;
+
+    lat[i] = atan2(num, den);
+    lon[i] = (p > 0) ? atan2(yi, xi) : 0;
+    height[i] = p * cos_phi + zi * sin_phi -
+                WGS84_A * sqrt(1 - e2 * sin_phi * sin_phi);
+  }
+}
+
 /** Populates a provided 3x3 matrix with the appropriate rotation
  * matrix to transform from ECEF to NED coordinates, given the
  * provided LLH reference vector.
@@ -386,4 +768,179 @@ void wgsecef2azel(const double ecef[3],
   *elevation = asin(-ned[2] / vector_norm(3, ned));
 }
 
+/** Initialises a local North, East, Down frame from a reference point given
+ * in WGS84 ECEF coordinates.
+ *
+ * \param frame    Frame to initialise.
+ * \param ref_ecef Cartesian coordinates of the reference point, passed as
+ *                 [X, Y, Z], all in meters.
+ */
+void ned_frame_init_ecef(ned_frame_t *frame, const double ref_ecef[3]) {
+  double ref_llh[3];
+  wgsecef2llh(ref_ecef, ref_llh);
+  for (int i = 0; i < 3; i++) {
+    frame->ref_ecef[i] = ref_ecef[i];
+    frame->ref_llh[i] = ref_llh[i];
+  }
+  wgs_ecef2ned_matrix(ref_llh, frame->M);
+}
+
+/** Initialises a local North, East, Down frame from a reference point given
+ * in WGS84 geodetic coordinates.
+ *
+ * \param frame   Frame to initialise.
+ * \param ref_llh Geodetic coordinates of the reference point, passed as
+ *                [lat, lon, height] in [radians, radians, meters].
+ */
+void ned_frame_init_llh(ned_frame_t *frame, const double ref_llh[3]) {
+  double ref_ecef[3];
+  wgsllh2ecef(ref_llh, ref_ecef);
+  for (int i = 0; i < 3; i++) {
+    frame->ref_ecef[i] = ref_ecef[i];
+    frame->ref_llh[i] = ref_llh[i];
+  }
+  wgs_ecef2ned_matrix(ref_llh, frame->M);
+}
+
+/** Rotates a vector in ECEF coordinates into the frame, as would be
+ * appropriate for e.g. a velocity vector.
+ *
+ * \see wgsecef2ned.
+ *
+ * \param frame Local frame.
+ * \param ecef  Vector in ECEF coordinates [X, Y, Z].
+ * \param ned   The rotated vector is written into this array as [N, E, D].
+ */
+void ned_frame_ecef2ned(const ned_frame_t *frame,
+                        const double ecef[3],
+                        double ned[3]) {
+  const double(*M)[3] = frame->M;
+  const double x = ecef[0], y = ecef[1], z = ecef[2];
+  ned[0] = M[0][0] * x + M[0][1] * y + M[0][2] * z;
+  ned[1] = M[1][0] * x + M[1][1] * y + M[1][2] * z;
+  ned[2] = M[2][0] * x + M[2][1] * y + M[2][2] * z;
+}
+
+/** Returns the vector to a point given in ECEF coordinates from the frame's
+ * reference point, in the local North, East, Down frame.
+ *
+ * \see wgsecef2ned_d.
+ *
+ * \param frame Local frame.
+ * \param ecef  Cartesian coordinates of the point [X, Y, Z] in meters.
+ * \param ned   The North, East, Down vector is written into this array as
+ *              [N, E, D], all in meters.
+ */
+void ned_frame_ecef2ned_d(const ned_frame_t *frame,
+                          const double ecef[3],
+                          double ned[3]) {
+  double d[3];
+  vector_subtract(3, ecef, frame->ref_ecef, d);
+  ned_frame_ecef2ned(frame, d, ned);
+}
+
+/** Rotates a vector in the local North, East, Down frame into ECEF
+ * coordinates, as would be appropriate for e.g. a velocity vector.
+ *
+ * \see wgsned2ecef.
+ *
+ * \param frame Local frame.
+ * \param ned   Vector in the local frame [N, E, D].
+ * \param ecef  The rotated vector is written into this array as [X, Y, Z].
+ */
+void ned_frame_ned2ecef(const ned_frame_t *frame,
+                        const double ned[3],
+                        double ecef[3]) {
+  const double(*M)[3] = frame->M;
+  const double n = ned[0], e = ned[1], d = ned[2];
+  ecef[0] = M[0][0] * n + M[1][0] * e + M[2][0] * d;
+  ecef[1] = M[0][1] * n + M[1][1] * e + M[2][1] * d;
+  ecef[2] = M[0][2] * n + M[1][2] * e + M[2][2] * d;
+}
+
+/** Returns the ECEF position of a point given in the local North, East, Down
+ * frame of the reference point.
+ *
+ * \see wgsned2ecef_d.
+ *
+ * \param frame Local frame.
+ * \param ned   Position relative to the reference point [N, E, D] in meters.
+ * \param ecef  Cartesian coordinates of the point written into this array,
+ *              [X, Y, Z], all in meters.
+ */
+void ned_frame_ned2ecef_d(const ned_frame_t *frame,
+                          const double ned[3],
+                          double ecef[3]) {
+  double d[3];
+  ned_frame_ned2ecef(frame, ned, d);
+  vector_add(3, d, frame->ref_ecef, ecef);
+}
+
+/** Determine the azimuth and elevation of a point given in ECEF coordinates
+ * as seen from the frame's reference point.
+ *
+ * \see wgsecef2azel.
+ *
+ * \param frame     Local frame.
+ * \param ecef      Cartesian coordinates of the point [X, Y, Z] in meters.
+ * \param azimuth   Azimuth in radians in the range [0, 2pi).
+ * \param elevation Elevation in radians in the range [-pi/2, pi/2].
+ */
+void ned_frame_ecef2azel(const ned_frame_t *frame,
+                         const double ecef[3],
+                         double *azimuth,
+                         double *elevation) {
+  ned_frame_ecef2azel_batch(frame, 1, ecef, azimuth, elevation);
+}
+
+/** Converts several points given in ECEF coordinates into the local North,
+ * East, Down frame of the reference point.
+ *
+ * \param frame Local frame.
+ * \param n     Number of points.
+ * \param ecef  `n` x 3 array of Cartesian coordinates of the points, each
+ *              row [X, Y, Z] in meters.
+ * \param ned   Output `n` x 3 array of vectors from the reference point, each
+ *              row [N, E, D] in meters. May be the same array as `ecef`.
+ */
+void ned_frame_ecef2ned_d_batch(const ned_frame_t *frame,
+                                size_t n,
+                                const double *ecef,
+                                double *ned) {
+  for (size_t i = 0; i < n; i++) {
+    ned_frame_ecef2ned_d(frame, &ecef[3 * i], &ned[3 * i]);
+  }
+}
+
+/** Determine the azimuth and elevation of several points, for example all
+ * satellites in view, as seen from the frame's reference point.
+ *
+ * \param frame     Local frame.
+ * \param n         Number of points.
+ * \param ecef      `n` x 3 array of Cartesian coordinates of the points,
+ *                  each row [X, Y, Z] in meters.
+ * \param azimuth   Output azimuths in radians in the range [0, 2pi),
+ *                  length `n`.
+ * \param elevation Output elevations in radians, length `n`.
+ */
+void ned_frame_ecef2azel_batch(const ned_frame_t *frame,
+                               size_t n,
+                               const double *ecef,
+                               double *azimuth,
+                               double *elevation) {
+  for (size_t i = 0; i < n; i++) {
+    double ned[3];
+    ned_frame_ecef2ned_d(frame, &ecef[3 * i], ned);
+
+    double az = atan2(ned[1], ned[0]);
+    /* atan2 returns angle in range [-pi, pi], usually azimuth is defined in
+     * the range [0, 2pi]. */
+    if (az < 0) {
+      az += 2 * M_PI;
+    }
+    azimuth[i] = az;
+    elevation[i] = asin(-ned[2] / vector_norm(3, ned));
+  }
+}
+
 /** \} */
@@ -0,0 +1,716 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/* mmap() and friends are POSIX rather than C99. */
+#if !defined(_POSIX_C_SOURCE) && !defined(_WIN32)
+#define _POSIX_C_SOURCE 200112L
+#endif
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include <swiftnav/bits.h>
+#include <swiftnav/constants.h>
+#include <swiftnav/geoid_grid.h>
+#include <swiftnav/logging.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define GEOID_GRID_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#include "thread_local.h"
+
+/** \defgroup geoid_grid Geoid grids
+ * Geoid undulation grids loaded at runtime.
+ *
+ * As an alternative to the geoid model compiled into the library, a grid of
+ * any resolution and extent can be read from a buffer or memory mapped from
+ * a file. Three file formats are understood:
+ *
+ *   -# NOAA VDatum GTX files: a 40 byte big endian header holding the
+ *      south-west corner, spacing and dimensions followed by big endian
+ *      float heights.
+ *      See https://vdatum.noaa.gov/docs/gtx_info.html#dev_gtx_binary
+ *   -# The compact format written by `scripts/gtx_convert.pl`: the magic
+ *      `LSNGEOID`, a little endian header adding a format version and the
+ *      geoid model identifier, then little endian float heights in the same
+ *      order as GTX.
+ *   -# The tiled compact format (version 2), which splits the grid into
+ *      square tiles and quantizes the heights of each tile to 16 bits with a
+ *      per tile offset and scale, at most 1 mm per step. The header adds the
+ *      tile size and encoding, and is followed by a directory holding the
+ *      offset, length, offset height and scale of each tile. Tiles may be
+ *      stored raw or delta coded, see geoid_tile_encoding_t.
+ *
+ * Memory mapping lets every process on a host share one page cached copy of
+ * the grid, and only the pages around the queried locations are ever read.
+ * Tiles of a tiled grid are decoded on first use into a small least recently
+ * used cache, so a 15 minute global model needs less than half the file size
+ * of the float format and a few tens of kB of decoded data.
+ * \{ */
+
+/* The default tile cache is per thread, so that threads can query a shared
+ * grid concurrently. Without thread local storage tiles of grids without
+ * their own cache are decoded on every access. */
+#if defined(SWIFTNAV_THREAD_LOCAL) && \
+    !defined(LIBSWIFTNAV_DISABLE_GEOID_TILE_CACHE)
+#define GEOID_TILE_CACHE_TLS SWIFTNAV_THREAD_LOCAL
+#endif
+
+#ifdef GEOID_TILE_CACHE_TLS
+/* Cache used by grids without their own, see geoid_grid_set_cache(). */
+static GEOID_TILE_CACHE_TLS geoid_tile_cache_t default_tile_cache;
+#endif
+
+/* Last identifier handed out to a grid by geoid_grid_init(). */
+static u32 last_grid_id;
+
+static u32 read_u32(const u8 *p, bool big_endian) {
+  u32 v;
+  memcpy(&v, p, sizeof(v));
+  return big_endian ? betoh_32(v) : letoh_32(v);
+}
+
+static double read_double(const u8 *p, bool big_endian) {
+  u64 bits;
+  double v;
+  memcpy(&bits, p, sizeof(bits));
+  bits = big_endian ? betoh_64(bits) : letoh_64(bits);
+  memcpy(&v, &bits, sizeof(v));
+  return v;
+}
+
+static float read_float(const u8 *p, bool big_endian) {
+  u32 bits = read_u32(p, big_endian);
+  float v;
+  memcpy(&v, &bits, sizeof(v));
+  return v;
+}
+
+static void write_u32(u8 *p, u32 v) {
+  v = htole_32(v);
+  memcpy(p, &v, sizeof(v));
+}
+
+static void write_double(u8 *p, double d) {
+  u64 v;
+  memcpy(&v, &d, sizeof(v));
+  v = htole_64(v);
+  memcpy(p, &v, sizeof(v));
+}
+
+static void write_float(u8 *p, float f) {
+  u32 v;
+  memcpy(&v, &f, sizeof(v));
+  write_u32(p, v);
+}
+
+/* Cache of a grid, NULL if tiles have to be decoded on every access. */
+static geoid_tile_cache_t *grid_cache(const geoid_grid_t *grid) {
+  if (NULL != grid->cache) {
+    return grid->cache;
+  }
+#ifdef GEOID_TILE_CACHE_TLS
+  return &default_tile_cache;
+#else
+  return NULL;
+#endif
+}
+
+/* Identifier for a newly initialised grid, unique among the grids whose
+ * tiles may still be held in a cache. */
+static u32 new_grid_id(void) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __atomic_add_fetch(&last_grid_id, 1, __ATOMIC_RELAXED);
+#elif defined(_MSC_VER)
+  return (u32)_InterlockedIncrement((volatile long *)&last_grid_id);
+#else
+  return ++last_grid_id;
+#endif
+}
+
+/* Number of tiles needed to cover `n` posts. */
+static u32 tile_count(u32 n, u32 tile_size) {
+  return (u32)(((u64)n + tile_size - 1) / tile_size);
+}
+
+/* Validate the directory of a tiled grid whose tile data is `data_len`
+ * bytes long. */
+static s8 check_tile_index(const geoid_grid_t *grid,
+                           u32 n_tiles,
+                           u64 data_len) {
+  for (u32 t = 0; t < n_tiles; t++) {
+    const u8 *entry = &grid->tile_index[t * GEOID_GRID_TILE_ENTRY_LEN];
+    u64 offset = read_u32(&entry[0], false);
+    u64 length = read_u32(&entry[4], false);
+    float base = read_float(&entry[8], false);
+    float scale = read_float(&entry[12], false);
+    if (offset + length > data_len || !isfinite(base) || !(scale > 0) ||
+        !isfinite(scale)) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+/** Number of columns after which longitude wraps, 0 for a regional grid.
+ * Global grids may or may not repeat the first column at the end. */
+static u32 lon_period(double dlon_deg, u32 n_lon) {
+  const double tol = 1e-6 * dlon_deg;
+  if (fabs(n_lon * dlon_deg - 360.0) < tol) {
+    return n_lon;
+  }
+  if (fabs((n_lon - 1) * dlon_deg - 360.0) < tol) {
+    return n_lon - 1;
+  }
+  return 0;
+}
+
+/** Initialise a geoid grid from a GTX or compact format buffer.
+ *
+ * The buffer is referenced, not copied, and must outlive the grid.
+ *
+ * \param grid Grid to initialise.
+ * \param buf  Grid file contents.
+ * \param len  Length of `buf` in bytes.
+ *
+ * \return 0 on success, -1 if the buffer is not a valid grid.
+ */
+s8 geoid_grid_init(geoid_grid_t *grid, const void *buf, size_t len) {
+  const u8 *p = (const u8 *)buf;
+  memset(grid, 0, sizeof(*grid));
+
+  size_t header_len;
+  u32 version = 0;
+  if (len >= GEOID_GRID_HEADER_LEN &&
+      0 == memcmp(p, GEOID_GRID_MAGIC, GEOID_GRID_MAGIC_LEN)) {
+    version = read_u32(&p[8], false);
+    if (GEOID_GRID_VERSION == version) {
+      header_len = GEOID_GRID_HEADER_LEN;
+    } else if (GEOID_GRID_VERSION_TILED == version &&
+               len >= GEOID_GRID_TILED_HEADER_LEN) {
+      header_len = GEOID_GRID_TILED_HEADER_LEN;
+      grid->tile_size = read_u32(&p[56], false);
+      grid->tile_encoding = (geoid_tile_encoding_t)read_u32(&p[60], false);
+    } else {
+      return -1;
+    }
+    grid->model = (geoid_model_t)read_u32(&p[12], false);
+    grid->lat0_deg = read_double(&p[16], false);
+    grid->lon0_deg = read_double(&p[24], false);
+    grid->dlat_deg = read_double(&p[32], false);
+    grid->dlon_deg = read_double(&p[40], false);
+    grid->n_lat = read_u32(&p[48], false);
+    grid->n_lon = read_u32(&p[52], false);
+    grid->big_endian = false;
+  } else if (len >= GEOID_GRID_GTX_HEADER_LEN) {
+    grid->model = GEOID_MODEL_NONE;
+    grid->lat0_deg = read_double(&p[0], true);
+    grid->lon0_deg = read_double(&p[8], true);
+    grid->dlat_deg = read_double(&p[16], true);
+    grid->dlon_deg = read_double(&p[24], true);
+    grid->n_lat = read_u32(&p[32], true);
+    grid->n_lon = read_u32(&p[36], true);
+    grid->big_endian = true;
+    header_len = GEOID_GRID_GTX_HEADER_LEN;
+  } else {
+    return -1;
+  }
+
+  if (!isfinite(grid->lat0_deg) || !isfinite(grid->lon0_deg) ||
+      !(grid->dlat_deg > 0) || !(grid->dlon_deg > 0) || grid->n_lat < 2 ||
+      grid->n_lon < 2) {
+    return -1;
+  }
+
+  if (GEOID_GRID_VERSION_TILED == version) {
+    if (grid->tile_size < 1 || grid->tile_size > GEOID_GRID_MAX_TILE_SIZE ||
+        (u32)grid->tile_encoding >= GEOID_TILE_ENCODING_COUNT) {
+      return -1;
+    }
+    grid->n_tile_cols = tile_count(grid->n_lon, grid->tile_size);
+    /* Both counts are below 2^32, so their product fits. Tiles are numbered
+     * with 32 bits and the directory must fit in the buffer, check both
+     * before multiplying any further. */
+    const u64 n_tiles =
+        (u64)tile_count(grid->n_lat, grid->tile_size) * grid->n_tile_cols;
+    if (n_tiles > UINT32_MAX ||
+        n_tiles > (u64)(len - header_len) / GEOID_GRID_TILE_ENTRY_LEN) {
+      return -1;
+    }
+    const u64 index_len = n_tiles * GEOID_GRID_TILE_ENTRY_LEN;
+    grid->tile_index = &p[header_len];
+    grid->data = &p[header_len + index_len];
+    const u64 data_len = len - header_len - index_len;
+    if (check_tile_index(grid, (u32)n_tiles, data_len) != 0) {
+      return -1;
+    }
+    /* Caches may hold tiles of a grid previously held in this buffer, tell
+     * them apart by the grid identifier. */
+    grid->id = new_grid_id();
+  } else {
+    /* Bound the number of posts by division, their size can overflow. */
+    const u64 max_posts = (u64)(len - header_len) / sizeof(float);
+    if ((u64)grid->n_lat * grid->n_lon > max_posts) {
+      return -1;
+    }
+    /* GTX has no magic so insist on an exact size match. */
+    const u64 data_len = (u64)grid->n_lat * grid->n_lon * sizeof(float);
+    if ((u64)(len - header_len) < data_len ||
+        (grid->big_endian && (u64)(len - header_len) != data_len)) {
+      return -1;
+    }
+    grid->data = &p[header_len];
+  }
+
+  grid->lon_period = lon_period(grid->dlon_deg, grid->n_lon);
+  return 0;
+}
+
+/** Memory map a GTX or compact format geoid grid file.
+ *
+ * Only available on POSIX platforms. Release the mapping with
+ * geoid_grid_unmap_file().
+ *
+ * \param grid Grid to initialise.
+ * \param path Path of the grid file.
+ *
+ * \return 0 on success, -1 if the file could not be mapped or is not a valid
+ *         grid.
+ */
+s8 geoid_grid_map_file(geoid_grid_t *grid, const char *path) {
+  memset(grid, 0, sizeof(*grid));
+#ifdef GEOID_GRID_HAVE_MMAP
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    log_error("Unable to open geoid grid %s", path);
+    return -1;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    log_error("Unable to read geoid grid %s", path);
+    return -1;
+  }
+  size_t len = (size_t)st.st_size;
+  void *mapping = mmap(NULL, len, PROT_READ, MAP_SHARED, fd, 0);
+  /* The mapping stays valid after the descriptor is closed. */
+  close(fd);
+  if (MAP_FAILED == mapping) {
+    log_error("Unable to map geoid grid %s", path);
+    return -1;
+  }
+  if (geoid_grid_init(grid, mapping, len) != 0) {
+    munmap(mapping, len);
+    log_error("Invalid geoid grid %s", path);
+    return -1;
+  }
+  grid->mapping = mapping;
+  grid->mapping_len = len;
+  return 0;
+#else
+  log_error("Memory mapped geoid grids are not supported, cannot load %s",
+            path);
+  return -1;
+#endif
+}
+
+/** Release a grid created with geoid_grid_map_file().
+ *
+ * \param grid Grid to release, it may not be used afterwards.
+ */
+void geoid_grid_unmap_file(geoid_grid_t *grid) {
+#ifdef GEOID_GRID_HAVE_MMAP
+  if (NULL != grid->mapping) {
+    munmap(grid->mapping, grid->mapping_len);
+  }
+#endif
+  memset(grid, 0, sizeof(*grid));
+}
+
+/** Use a dedicated cache to decode the tiles of a tiled grid.
+ *
+ * By default tiled grids share a cache per thread, so a grid may be queried
+ * from several threads at once. A dedicated cache is not thread safe, only
+ * one thread at a time may query grids using it.
+ *
+ * \param grid  Geoid grid.
+ * \param cache Cache to use, or NULL for the per thread default cache. It
+ *              must outlive its use by the grid.
+ */
+void geoid_grid_set_cache(geoid_grid_t *grid, geoid_tile_cache_t *cache) {
+  grid->cache = cache;
+  if (NULL != cache) {
+    geoid_tile_cache_reset(cache);
+  }
+}
+
+/** Discard all tiles held in a tile cache.
+ *
+ * \param cache Tile cache.
+ */
+void geoid_tile_cache_reset(geoid_tile_cache_t *cache) {
+  cache->clock = 0;
+  cache->mru = 0;
+  for (u32 i = 0; i < GEOID_GRID_TILE_CACHE_SLOTS; i++) {
+    cache->slots[i].tile = NULL;
+    cache->slots[i].grid_id = 0;
+    cache->slots[i].last_used = 0;
+  }
+}
+
+/* Dimensions of tile `t`, edge tiles may be smaller than the tile size. */
+static void tile_dims(const geoid_grid_t *grid, u32 t, u32 *rows, u32 *cols) {
+  const u32 ts = grid->tile_size;
+  *rows = MIN(ts, grid->n_lat - (t / grid->n_tile_cols) * ts);
+  *cols = MIN(ts, grid->n_lon - (t % grid->n_tile_cols) * ts);
+}
+
+/* Decode tile `t` into `posts`, with a row stride of the tile size. Posts of
+ * a corrupt tile are set to NaN. */
+static void decode_tile(const geoid_grid_t *grid, u32 t, float *posts) {
+  const u8 *entry = &grid->tile_index[t * GEOID_GRID_TILE_ENTRY_LEN];
+  const u8 *p = &grid->data[read_u32(&entry[0], false)];
+  const u8 *end = p + read_u32(&entry[4], false);
+  const double base = read_float(&entry[8], false);
+  const double scale = read_float(&entry[12], false);
+  const u32 ts = grid->tile_size;
+  u32 rows, cols;
+  tile_dims(grid, t, &rows, &cols);
+
+  s32 q = 0;
+  for (u32 r = 0; r < rows; r++) {
+    for (u32 c = 0; c < cols; c++) {
+      if (GEOID_TILE_ENCODING_RAW == grid->tile_encoding) {
+        if (end - p < 2) {
+          goto corrupt;
+        }
+        q = p[0] | (p[1] << 8);
+        p += 2;
+      } else {
+        /* Zigzag coded little endian base 128 varint. */
+        u32 z = 0;
+        u32 shift = 0;
+        do {
+          if (p == end || shift > 14) {
+            goto corrupt;
+          }
+          z |= (u32)(*p & 0x7F) << shift;
+          shift += 7;
+        } while (*p++ & 0x80);
+        q += (z & 1) ? -(s32)(z >> 1) - 1 : (s32)(z >> 1);
+        if (q < 0 || q > UINT16_MAX) {
+          goto corrupt;
+        }
+      }
+      posts[r * ts + c] = (float)(base + scale * q);
+    }
+  }
+  return;
+
+corrupt:
+  for (u32 i = 0; i < ts * ts; i++) {
+    posts[i] = NAN;
+  }
+}
+
+/* Decoded posts of tile `t`, from the cache if possible. Without a cache the
+ * tile is decoded into `scratch`. */
+static const float *tile_posts(const geoid_grid_t *grid,
+                               u32 t,
+                               float *scratch) {
+  geoid_tile_cache_t *cache = grid_cache(grid);
+  if (NULL == cache) {
+    decode_tile(grid, t, scratch);
+    return scratch;
+  }
+  const u8 *key = &grid->tile_index[t * GEOID_GRID_TILE_ENTRY_LEN];
+
+  if (++cache->clock == 0) {
+    /* Keep the recency order valid across clock wrap around. */
+    for (u32 i = 0; i < GEOID_GRID_TILE_CACHE_SLOTS; i++) {
+      cache->slots[i].last_used = 0;
+    }
+    cache->clock = 1;
+  }
+
+  geoid_tile_slot_t *slot = &cache->slots[cache->mru];
+  if (slot->tile != key || slot->grid_id != grid->id) {
+    u32 lru = 0;
+    u32 i;
+    for (i = 0; i < GEOID_GRID_TILE_CACHE_SLOTS; i++) {
+      if (cache->slots[i].tile == key &&
+          cache->slots[i].grid_id == grid->id) {
+        break;
+      }
+      if (cache->slots[i].last_used < cache->slots[lru].last_used) {
+        lru = i;
+      }
+    }
+    if (i == GEOID_GRID_TILE_CACHE_SLOTS) {
+      i = lru;
+      decode_tile(grid, t, cache->slots[i].posts);
+      cache->slots[i].tile = key;
+      cache->slots[i].grid_id = grid->id;
+    }
+    cache->mru = i;
+    slot = &cache->slots[i];
+  }
+  slot->last_used = cache->clock;
+  return slot->posts;
+}
+
+/** Height of a single grid post.
+ *
+ * \param grid Geoid grid.
+ * \param row  Row index, counted from the south.
+ * \param col  Column index, counted from the west.
+ *
+ * \return Geoid height in meters.
+ */
+float geoid_grid_post(const geoid_grid_t *grid, u32 row, u32 col) {
+  assert(row < grid->n_lat && col < grid->n_lon);
+  const u32 ts = grid->tile_size;
+  if (ts > 0) {
+    float scratch[GEOID_GRID_MAX_TILE_SIZE * GEOID_GRID_MAX_TILE_SIZE];
+    const float *posts =
+        tile_posts(grid, row / ts * grid->n_tile_cols + col / ts, scratch);
+    return posts[(row % ts) * ts + col % ts];
+  }
+  const size_t i = (size_t)row * grid->n_lon + col;
+  return read_float(&grid->data[i * sizeof(float)], grid->big_endian);
+}
+
+/* Post at a column index which may lie outside the grid on a global grid. */
+static double post_wrapped(const geoid_grid_t *grid, u32 row, s64 col) {
+  if (grid->lon_period > 0) {
+    col %= grid->lon_period;
+    if (col < 0) {
+      col += grid->lon_period;
+    }
+  }
+  return geoid_grid_post(grid, row, (u32)col);
+}
+
+/* Catmull-Rom cubic through p[0..3] evaluated between p[1] and p[2], as used
+ * by the compiled in geoid model. */
+static double cubic_interpolation(const double p[4], double x) {
+  return p[1] + 0.5 * x *
+                    (p[2] - p[0] +
+                     x * (2. * p[0] - 5. * p[1] + 4. * p[2] - p[3] +
+                          x * (3. * (p[1] - p[2]) + p[3] - p[0])));
+}
+
+/** Interpolate the geoid height at a location.
+ *
+ * Uses bicubic interpolation where the full 4x4 stencil of posts is
+ * available, and bilinear interpolation in the outermost cells of the grid.
+ * Longitude wraps around on grids that cover the whole globe. Longitudes of
+ * any range are accepted, so a regional grid starting at 250 degrees covers
+ * a query at -105 degrees.
+ *
+ * \param grid    Geoid grid.
+ * \param lat_rad Latitude in radians.
+ * \param lon_rad Longitude in radians.
+ * \param offset  Geoid height above the ellipsoid in meters.
+ *
+ * \return 0 on success, -1 if the location is not covered by the grid.
+ */
+s8 geoid_grid_offset(const geoid_grid_t *grid,
+                     double lat_rad,
+                     double lon_rad,
+                     float *offset) {
+  const u32 n_lat = grid->n_lat;
+  const u32 n_lon = grid->n_lon;
+  const u32 period = grid->lon_period;
+
+  /* Degrees east of the westernmost column, in [0, 360). */
+  double east_deg = fmod(R2D * lon_rad - grid->lon0_deg, 360.0);
+  if (east_deg < 0) {
+    east_deg += 360.0;
+  }
+  if (east_deg >= 360.0) {
+    /* A tiny negative remainder rounds to 360 when wrapped. */
+    east_deg = 0;
+  }
+  double y = (R2D * lat_rad - grid->lat0_deg) / grid->dlat_deg;
+  double x = east_deg / grid->dlon_deg;
+  if (!(y >= 0 && y <= n_lat - 1)) {
+    return -1;
+  }
+  if (0 == period && !(x >= 0 && x <= n_lon - 1)) {
+    return -1;
+  }
+
+  u32 iy = MIN((u32)y, n_lat - 2);
+  u32 ix = (u32)x;
+  if (period > 0) {
+    ix = MIN(ix, period - 1);
+  } else {
+    ix = MIN(ix, n_lon - 2);
+  }
+  const double fy = y - iy;
+  const double fx = x - ix;
+
+  const bool cubic_y = iy >= 1 && iy + 2 < n_lat;
+  const bool cubic_x = period > 0 || (ix >= 1 && ix + 2 < n_lon);
+  if (cubic_x && cubic_y) {
+    double rows[4];
+    for (u32 j = 0; j < 4; j++) {
+      double p[4];
+      for (s64 i = 0; i < 4; i++) {
+        p[i] = post_wrapped(grid, iy - 1 + j, (s64)ix - 1 + i);
+      }
+      rows[j] = cubic_interpolation(p, fx);
+    }
+    *offset = (float)cubic_interpolation(rows, fy);
+    /* Corrupt tiles decode to NaN. */
+    return isnan(*offset) ? -1 : 0;
+  }
+
+  const double sw = post_wrapped(grid, iy, ix);
+  const double se = post_wrapped(grid, iy, (s64)ix + 1);
+  const double nw = post_wrapped(grid, iy + 1, ix);
+  const double ne = post_wrapped(grid, iy + 1, (s64)ix + 1);
+  *offset = (float)((1 - fy) * ((1 - fx) * sw + fx * se) +
+                    fy * ((1 - fx) * nw + fx * ne));
+  return isnan(*offset) ? -1 : 0;
+}
+
+/* Append the zigzag varint coding of `d` at `*pos`. */
+static s8 put_varint(u8 *buf, size_t len, size_t *pos, s32 d) {
+  u32 z = d >= 0 ? 2 * (u32)d : 2 * (u32)(-(d + 1)) + 1;
+  do {
+    if (*pos >= len) {
+      return -1;
+    }
+    buf[(*pos)++] = (u8)((z & 0x7F) | (z > 0x7F ? 0x80 : 0));
+    z >>= 7;
+  } while (z > 0);
+  return 0;
+}
+
+/** Convert a geoid grid to the tiled, quantized format.
+ *
+ * Heights are quantized to 16 bits per tile, with a step of
+ * `GEOID_GRID_TILE_RESOLUTION` unless the height range within the tile
+ * requires a coarser step.
+ *
+ * \param src       Grid to convert, in any format.
+ * \param tile_size Tile edge length in posts, at most
+ *                  `GEOID_GRID_MAX_TILE_SIZE`.
+ * \param encoding  Encoding of the quantized heights.
+ * \param buf       Output buffer.
+ * \param len       Size of `buf` on input, length of the encoded grid on
+ *                  output.
+ *
+ * \return 0 on success, -1 if the parameters are invalid, the source grid
+ *         contains non finite heights or the output buffer is too small.
+ */
+s8 geoid_grid_encode_tiled(const geoid_grid_t *src,
+                           u32 tile_size,
+                           geoid_tile_encoding_t encoding,
+                           u8 *buf,
+                           size_t *len) {
+  if (tile_size < 1 || tile_size > GEOID_GRID_MAX_TILE_SIZE ||
+      (u32)encoding >= GEOID_TILE_ENCODING_COUNT) {
+    return -1;
+  }
+
+  geoid_grid_t dst;
+  memset(&dst, 0, sizeof(dst));
+  dst.n_lat = src->n_lat;
+  dst.n_lon = src->n_lon;
+  dst.tile_size = tile_size;
+  dst.n_tile_cols = tile_count(src->n_lon, tile_size);
+  const u64 n_tiles = (u64)tile_count(src->n_lat, tile_size) * dst.n_tile_cols;
+  const u64 data_start =
+      GEOID_GRID_TILED_HEADER_LEN + n_tiles * GEOID_GRID_TILE_ENTRY_LEN;
+  if (data_start > *len) {
+    return -1;
+  }
+
+  memcpy(buf, GEOID_GRID_MAGIC, GEOID_GRID_MAGIC_LEN);
+  write_u32(&buf[8], GEOID_GRID_VERSION_TILED);
+  write_u32(&buf[12], (u32)src->model);
+  write_double(&buf[16], src->lat0_deg);
+  write_double(&buf[24], src->lon0_deg);
+  write_double(&buf[32], src->dlat_deg);
+  write_double(&buf[40], src->dlon_deg);
+  write_u32(&buf[48], src->n_lat);
+  write_u32(&buf[52], src->n_lon);
+  write_u32(&buf[56], tile_size);
+  write_u32(&buf[60], (u32)encoding);
+
+  size_t pos = (size_t)data_start;
+  for (u32 t = 0; t < n_tiles; t++) {
+    const u32 row0 = t / dst.n_tile_cols * tile_size;
+    const u32 col0 = t % dst.n_tile_cols * tile_size;
+    u32 rows, cols;
+    tile_dims(&dst, t, &rows, &cols);
+
+    double lo = INFINITY;
+    double hi = -INFINITY;
+    for (u32 r = 0; r < rows; r++) {
+      for (u32 c = 0; c < cols; c++) {
+        double v = geoid_grid_post(src, row0 + r, col0 + c);
+        if (!isfinite(v)) {
+          return -1;
+        }
+        lo = MIN(lo, v);
+        hi = MAX(hi, v);
+      }
+    }
+    const double base = (float)lo;
+    const double scale =
+        (float)MAX(GEOID_GRID_TILE_RESOLUTION, (hi - base) / UINT16_MAX);
+
+    u8 *entry = &buf[GEOID_GRID_TILED_HEADER_LEN +
+                     (size_t)t * GEOID_GRID_TILE_ENTRY_LEN];
+    const size_t tile_start = pos;
+    s32 prev = 0;
+    for (u32 r = 0; r < rows; r++) {
+      for (u32 c = 0; c < cols; c++) {
+        double v = geoid_grid_post(src, row0 + r, col0 + c);
+        s32 q = (s32)floor((v - base) / scale + 0.5);
+        q = MAX(0, MIN(q, UINT16_MAX));
+        if (GEOID_TILE_ENCODING_RAW == encoding) {
+          if (*len - pos < 2) {
+            return -1;
+          }
+          buf[pos++] = (u8)(q & 0xFF);
+          buf[pos++] = (u8)(q >> 8);
+        } else if (put_varint(buf, *len, &pos, q - prev) != 0) {
+          return -1;
+        }
+        prev = q;
+      }
+    }
+    write_u32(&entry[0], (u32)(tile_start - data_start));
+    write_u32(&entry[4], (u32)(pos - tile_start));
+    write_float(&entry[8], (float)base);
+    write_float(&entry[12], (float)scale);
+  }
+
+  *len = pos;
+  return 0;
+}
+
+/** \} */
@@ -14,6 +14,7 @@
 #include <swiftnav/common.h>
 #include <swiftnav/constants.h>
 #include <swiftnav/float_equality.h>
+#include <swiftnav/geoid_grid.h>
 #include <swiftnav/geoid_model.h>
 #include <swiftnav/logging.h>
 
@@ -23,13 +24,31 @@
 #define MIN_LAT (-90)
 #define MAX_LAT 90
 
-#ifdef GEOID_MODEL_15_MINUTE_RESOLUTION
+#if defined(GEOID_MODEL_NO_BUILTIN_GRID)
+/* No compiled in geoid, heights are only available from a grid loaded at
+ * runtime with set_geoid_grid(). */
+#elif defined(GEOID_MODEL_FLAT_LAYOUT)
+#if defined(GEOID_MODEL_15_MINUTE_RESOLUTION)
 /* Geoid model with geoid heights derived from EGM2008 (0.25 x 0.25 deg grid) */
 #include "geoid_model_15_minute.inc"
 #else
 /* Geoid model with geoid heights derived from EGM2008 (1 x 1 deg grid) */
 #include "geoid_model_1_degree.inc"
 #endif /* GEOID_MODEL_15_MINUTE_RESOLUTION */
+#elif defined(GEOID_MODEL_15_MINUTE_RESOLUTION)
+/* The 0.25 x 0.25 deg model tiled at build time, see get_geoid_val() */
+#include "geoid_model_15_minute_tiled.inc"
+#else
+/* The 1 x 1 deg model tiled at build time, see get_geoid_val() */
+#include "geoid_model_1_degree_tiled.inc"
+#endif /* GEOID_MODEL_NO_BUILTIN_GRID */
+
+/* Grid loaded at runtime which takes precedence over the compiled in one. */
+static const geoid_grid_t *active_geoid_grid = NULL;
+
+#ifndef GEOID_MODEL_NO_BUILTIN_GRID
+
+#ifdef GEOID_MODEL_FLAT_LAYOUT
 
 /*
  * Get GEOID[x][y], accounting for wrap-around of longitude values
@@ -44,6 +63,35 @@ static inline float get_geoid_val(int x, int y) {
   return GEOID[x][y];
 }
 
+#else /* GEOID_MODEL_FLAT_LAYOUT */
+
+/*
+ * GEOID is stored by longitude, so the four rows of a 4x4 stencil lie a
+ * whole meridian apart, and every lookup has to wrap the longitude. Unless
+ * GEOID_MODEL_FLAT_LAYOUT is defined, the heights are instead read from
+ * GEOID_TILES, which scripts/geoid_tile_generator.py builds from GEOID at
+ * build time. It is
+ *
+ * - padded with the wrapped around columns x = -1 and x = N_LON..N_LON+2,
+ *   so that any stencil can be read without wrapping, and
+ * - split into 8x8 tiles stored contiguously, each by latitude, so that a
+ *   stencil inside a tile occupies four consecutive 32 byte rows.
+ *
+ * GEOID_TILES replaces GEOID and is only slightly larger, by the padding.
+ * Get GEOID[x][y] for x in [-1, N_LON + 2], without branches.
+ */
+static inline float get_geoid_val(int x, int y) {
+  const unsigned px = (unsigned)(x + GEOID_PAD_WEST);
+  const unsigned py = (unsigned)y;
+  const unsigned mask = (1U << GEOID_TILE_SHIFT) - 1;
+  const size_t tile = (py >> GEOID_TILE_SHIFT) * (unsigned)GEOID_TILES_X +
+                      (px >> GEOID_TILE_SHIFT);
+  return GEOID_TILES[(tile << (2 * GEOID_TILE_SHIFT)) +
+                     ((py & mask) << GEOID_TILE_SHIFT) + (px & mask)];
+}
+
+#endif /* GEOID_MODEL_FLAT_LAYOUT */
+
 /*
  * Perform bilinear interpolation of the height values in a single geoid cell
  * where the corners are located at:
@@ -81,15 +129,54 @@ static double cubic_interpolation(double p[4], double x) {
                      x * (2. * p[0] - 5. * p[1] + 4. * p[2] - p[3] +
                           x * (3. * (p[1] - p[2]) + p[3] - p[0])));
 }
-geoid_model_t get_geoid_model(void) { return GEOID_MODEL_EGM2008; }
+#endif /* GEOID_MODEL_NO_BUILTIN_GRID */
 
-/* Return the geoid offset */
-float get_geoid_offset(double lat_rad, double lon_rad) {
+/* Select a runtime loaded geoid grid, NULL for the compiled in model */
+void set_geoid_grid(const geoid_grid_t *grid) { active_geoid_grid = grid; }
+
+geoid_model_t get_geoid_model(void) {
+  if (NULL != active_geoid_grid) {
+    return active_geoid_grid->model;
+  }
+#ifdef GEOID_MODEL_NO_BUILTIN_GRID
+  return GEOID_MODEL_NONE;
+#else
+  return GEOID_MODEL_EGM2008;
+#endif
+}
+
+#ifndef GEOID_MODEL_NO_BUILTIN_GRID
+
+/* Number of posts in a column of GEOID, and of distinct longitudes */
+#define GEOID_N_LAT ((int)((MAX_LAT - MIN_LAT) / LAT_GRID_SPACING_DEG) + 1)
+#define GEOID_N_LON ((int)((MAX_LON - MIN_LON) / LON_GRID_SPACING_DEG))
+
+/* Number of cell stencils cached by get_geoid_offset_batch() */
+#define GEOID_BATCH_STENCILS 16
+
+/* How the height is interpolated within a cell of the compiled in model */
+typedef enum {
+  GEOID_CELL_INVALID,
+  GEOID_CELL_POLE,
+  GEOID_CELL_BICUBIC,
+  GEOID_CELL_BILINEAR,
+} geoid_cell_t;
+
+/*
+ * Find the cell of the compiled in model containing a location, with the
+ * fractional offset of the location from the (ix,iy) corner of the cell.
+ */
+static geoid_cell_t geoid_cell(double lat_rad,
+                               double lon_rad,
+                               int *ix,
+                               int *iy,
+                               float *fx,
+                               float *fy) {
   /* Convert to degrees, returning 0.0 if out of bounds */
   float lat_deg = (float)(R2D * lat_rad);
   if (lat_deg > MAX_LAT || lat_deg < MIN_LAT) {
     log_error("Invalid latitude passed to get_geoid_offset: %lf", lat_rad);
-    return 0.0;
+    return GEOID_CELL_INVALID;
   }
 
   float lon_deg = (float)(R2D * lon_rad);
@@ -98,104 +185,208 @@ float get_geoid_offset(double lat_rad, double lon_rad) {
   }
   if (lon_deg > MAX_LON || lon_deg < MIN_LON) {
     log_error("Invalid longitude passed to get_geoid_offset: %lf", lon_rad);
-    return 0.0;
+    return GEOID_CELL_INVALID;
   }
 
-  float fx, fy;    // fractional offset from cell corners
   float ixf, iyf;  // integer offset of cell corners
 
-  fy = modff((lat_deg - MIN_LAT) / LAT_GRID_SPACING_DEG, &iyf);
-  fx = modff((lon_deg - MIN_LON) / LON_GRID_SPACING_DEG, &ixf);
+  *fy = modff((lat_deg - MIN_LAT) / LAT_GRID_SPACING_DEG, &iyf);
+  *fx = modff((lon_deg - MIN_LON) / LON_GRID_SPACING_DEG, &ixf);
 
-  int ix = (int)ixf;
-  int iy = (int)iyf;
+  *ix = (int)ixf;
+  *iy = (int)iyf;
 
   /*
    * Special Case 1: if lat is +90 then use the geoid value directly (note:
    * at this latitude, height is same regardless of value of x)
    */
-  if (iy == (int)((MAX_LAT - MIN_LAT) / LAT_GRID_SPACING_DEG)) {
-    return GEOID[ix][iy];
+  if (*iy == GEOID_N_LAT - 1) {
+    return GEOID_CELL_POLE;
   }
 
-  /*
-   * The general idea for performing bicubic interpolation is as follows:
-   *
-   * Given a grid of points:
-   *
-   * p03 p13 p23 p33
-   * p02 p12 p22 p32
-   * p01 p11 p21 p31
-   * p00 p10 p20 p30
-   *
-   * We can perform interpolation in the region bounded by p11, p12, p21 and
-   * p22 using:
-   *
-   * g(x,y) = f(f(p00,p01,p02,p03,y), f(p10,p11,p12,p13,y),
-   *            f(p20,p21,p22,p23,y), f(p30,p31,p32,p33,y), x)
-   *
-   * We want to perform interpolation on the cell starting at (ix,iy), meaning
-   * that we need the heights from the following locations:
-   *
-   * (ix-1,iy+2) (ix  ,iy+2) (ix+1,iy+2) (ix+2,iy+2)
-   * (ix-1,iy+1) (ix  ,iy+1) (ix+1,iy+1) (ix+2,iy+1)
-   * (ix-1,iy  ) (ix  ,iy  ) (ix+1,iy  ) (ix+2,iy  )
-   * (ix-1,iy-1) (ix  ,iy-1) (ix+1,iy-1) (ix+2,iy-1)
-   */
-  if (iy > 0 && iy < (MAX_LAT - MIN_LAT) / LAT_GRID_SPACING_DEG - 1) {
-    int y0, y1, y2, y3;
-
-    if (iy == (int)((MAX_LAT - MIN_LAT) / LAT_GRID_SPACING_DEG - 2)) {
-      /*
-       * Special Case 2: for latitudes in range
-       * [90 - 2 * LAT_GRID_SPACING, 90 - LAT_GRID_SPACING)
-       * we flip the Y indices and the fractional offset so that
-       * the height values correspond to:
-       *
-       * (ix-1,iy-1) (ix  ,iy-1) (ix+1,iy-1) (ix+2,iy-1)
-       * (ix-1,iy  ) (ix  ,iy  ) (ix+1,iy  ) (ix+2,iy  )
-       * (ix-1,iy+1) (ix  ,iy+1) (ix+1,iy+1) (ix+2,iy+1)
-       * (ix-1,iy+2) (ix  ,iy+2) (ix+1,iy+2) (ix+2,iy+2)
-       */
-      y0 = iy + 2;
-      y1 = iy + 1;
-      y2 = iy;
-      y3 = iy - 1;
-
-      fy = 1.f - fy;
-    } else {
-      y0 = iy - 1;
-      y1 = iy;
-      y2 = iy + 1;
-      y3 = iy + 2;
+  if (*iy > 0 && *iy < GEOID_N_LAT - 2) {
+    if (*iy == GEOID_N_LAT - 3) {
+      /* Special Case 2, see load_stencil() */
+      *fy = 1.f - *fy;
+    }
+    return GEOID_CELL_BICUBIC;
+  }
+
+  /* Special Case 3: perform bilinear interpolation if latitude is in range
+   * [-90,-90 + LAT_GRID_SPACING_DEG) or [90 - LAT_GRID_SPACING, 90) */
+  return GEOID_CELL_BILINEAR;
+}
+
+/*
+ * The general idea for performing bicubic interpolation is as follows:
+ *
+ * Given a grid of points:
+ *
+ * p03 p13 p23 p33
+ * p02 p12 p22 p32
+ * p01 p11 p21 p31
+ * p00 p10 p20 p30
+ *
+ * We can perform interpolation in the region bounded by p11, p12, p21 and
+ * p22 using:
+ *
+ * g(x,y) = f(f(p00,p01,p02,p03,y), f(p10,p11,p12,p13,y),
+ *            f(p20,p21,p22,p23,y), f(p30,p31,p32,p33,y), x)
+ *
+ * We want to perform interpolation on the cell starting at (ix,iy), meaning
+ * that we need the heights from the following locations, which are stored
+ * in 'stencil' by row (y) so that the four y interpolations can be evaluated
+ * side by side:
+ *
+ * (ix-1,iy+2) (ix  ,iy+2) (ix+1,iy+2) (ix+2,iy+2)
+ * (ix-1,iy+1) (ix  ,iy+1) (ix+1,iy+1) (ix+2,iy+1)
+ * (ix-1,iy  ) (ix  ,iy  ) (ix+1,iy  ) (ix+2,iy  )
+ * (ix-1,iy-1) (ix  ,iy-1) (ix+1,iy-1) (ix+2,iy-1)
+ */
+static void load_stencil(int ix, int iy, double stencil[4][4]) {
+  int y[4];
+
+  if (iy == GEOID_N_LAT - 3) {
+    /*
+     * Special Case 2: for latitudes in range
+     * [90 - 2 * LAT_GRID_SPACING, 90 - LAT_GRID_SPACING)
+     * we flip the Y indices and the fractional offset so that
+     * the height values correspond to:
+     *
+     * (ix-1,iy-1) (ix  ,iy-1) (ix+1,iy-1) (ix+2,iy-1)
+     * (ix-1,iy  ) (ix  ,iy  ) (ix+1,iy  ) (ix+2,iy  )
+     * (ix-1,iy+1) (ix  ,iy+1) (ix+1,iy+1) (ix+2,iy+1)
+     * (ix-1,iy+2) (ix  ,iy+2) (ix+1,iy+2) (ix+2,iy+2)
+     */
+    y[0] = iy + 2;
+    y[1] = iy + 1;
+    y[2] = iy;
+    y[3] = iy - 1;
+  } else {
+    y[0] = iy - 1;
+    y[1] = iy;
+    y[2] = iy + 1;
+    y[3] = iy + 2;
+  }
+
+  for (int j = 0; j < 4; j++) {
+    for (int i = 0; i < 4; i++) {
+      stencil[j][i] = get_geoid_val(ix - 1 + i, y[j]);
     }
+  }
+}
+
+/*
+ * Bicubic interpolation within a stencil loaded by load_stencil(). The four
+ * cubics in y are independent and written lane by lane so that the compiler
+ * can evaluate them with vector instructions.
+ */
+static float bicubic_interpolation(const double stencil[4][4],
+                                   double fx,
+                                   double fy) {
+  const double *p0 = stencil[0];
+  const double *p1 = stencil[1];
+  const double *p2 = stencil[2];
+  const double *p3 = stencil[3];
+  double arr[4];
+
+  for (int i = 0; i < 4; i++) {
+    arr[i] = p1[i] + 0.5 * fy *
+                         (p2[i] - p0[i] +
+                          fy * (2. * p0[i] - 5. * p1[i] + 4. * p2[i] - p3[i] +
+                                fy * (3. * (p1[i] - p2[i]) + p3[i] - p0[i])));
+  }
+  return (float)cubic_interpolation(arr, fx);
+}
+
+/* Height at a location found with geoid_cell() */
+static float cell_offset(geoid_cell_t cell,
+                         int ix,
+                         int iy,
+                         float fx,
+                         float fy) {
+  switch (cell) {
+    case GEOID_CELL_POLE:
+      return get_geoid_val(ix, iy);
+    case GEOID_CELL_BICUBIC: {
+      double stencil[4][4];
+      load_stencil(ix, iy, stencil);
+      return bicubic_interpolation(stencil, fx, fy);
+    }
+    case GEOID_CELL_BILINEAR:
+      return bilinear_interpolation(ix, iy, fx, fy);
+    case GEOID_CELL_INVALID:
+    default:
+      return 0.0;
+  }
+}
 
-    double heights[4][4] = {{get_geoid_val(ix - 1, y0),
-                             get_geoid_val(ix - 1, y1),
-                             get_geoid_val(ix - 1, y2),
-                             get_geoid_val(ix - 1, y3)},
-                            {get_geoid_val(ix, y0),
-                             get_geoid_val(ix, y1),
-                             get_geoid_val(ix, y2),
-                             get_geoid_val(ix, y3)},
-                            {get_geoid_val(ix + 1, y0),
-                             get_geoid_val(ix + 1, y1),
-                             get_geoid_val(ix + 1, y2),
-                             get_geoid_val(ix + 1, y3)},
-                            {get_geoid_val(ix + 2, y0),
-                             get_geoid_val(ix + 2, y1),
-                             get_geoid_val(ix + 2, y2),
-                             get_geoid_val(ix + 2, y3)}};
-
-    double arr[4] = {cubic_interpolation(heights[0], fy),
-                     cubic_interpolation(heights[1], fy),
-                     cubic_interpolation(heights[2], fy),
-                     cubic_interpolation(heights[3], fy)};
-    return (float)cubic_interpolation(arr, fx);
-
-  } /* else Special Case 3: perform bilinear interpolation if latitude
-     * is in range [-90,-90 + LAT_GRID_SPACING_DEG) or
-     * [90 - LAT_GRID_SPACING, 90) */
-
-  return bilinear_interpolation(ix, iy, fx, fy);
+#endif /* GEOID_MODEL_NO_BUILTIN_GRID */
+
+/* Return the geoid offset */
+float get_geoid_offset(double lat_rad, double lon_rad) {
+  if (NULL != active_geoid_grid) {
+    float offset;
+    if (geoid_grid_offset(active_geoid_grid, lat_rad, lon_rad, &offset) == 0) {
+      return offset;
+    }
+    /* Outside a regional grid, fall back to the compiled in model. */
+  }
+
+#ifdef GEOID_MODEL_NO_BUILTIN_GRID
+  return 0.0;
+#else
+  int ix, iy;
+  float fx, fy;
+  geoid_cell_t cell = geoid_cell(lat_rad, lon_rad, &ix, &iy, &fx, &fy);
+  return cell_offset(cell, ix, iy, fx, fy);
+#endif /* GEOID_MODEL_NO_BUILTIN_GRID */
+}
+
+/*
+ * Return the geoid offsets of 'n' locations, equivalent to calling
+ * get_geoid_offset() for each of them.
+ *
+ * The 4x4 stencils of recently visited cells are kept in a small cache
+ * indexed by cell, so consecutive points of a track which fall in the same
+ * cell, or come back to it, reuse the stencil instead of looking up all 16
+ * heights again.
+ */
+void get_geoid_offset_batch(size_t n,
+                            const double *lat_rad,
+                            const double *lon_rad,
+                            float *offset) {
+#ifndef GEOID_MODEL_NO_BUILTIN_GRID
+  if (NULL == active_geoid_grid) {
+    int keys[GEOID_BATCH_STENCILS];
+    double stencils[GEOID_BATCH_STENCILS][4][4];
+    for (int k = 0; k < GEOID_BATCH_STENCILS; k++) {
+      keys[k] = -1;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+      int ix, iy;
+      float fx, fy;
+      geoid_cell_t cell =
+          geoid_cell(lat_rad[i], lon_rad[i], &ix, &iy, &fx, &fy);
+      if (GEOID_CELL_BICUBIC != cell) {
+        offset[i] = cell_offset(cell, ix, iy, fx, fy);
+        continue;
+      }
+      /* ix may be one past the last column at 360 degrees */
+      const int key = iy * (GEOID_N_LON + 1) + ix;
+      const int slot = key % GEOID_BATCH_STENCILS;
+      if (keys[slot] != key) {
+        keys[slot] = key;
+        load_stencil(ix, iy, stencils[slot]);
+      }
+      offset[i] = bicubic_interpolation(stencils[slot], fx, fy);
+    }
+    return;
+  }
+#endif /* GEOID_MODEL_NO_BUILTIN_GRID */
+
+  for (size_t i = 0; i < n; i++) {
+    offset[i] = get_geoid_offset(lat_rad[i], lon_rad[i]);
+  }
 }
@@ -78,6 +78,7 @@ void glo_map_set_slot_id(u16 fcn, u16 glo_slot_id) {
 
   glo_map_lock();
   glo_sv_id_fcn_map[glo_slot_id] = fcn;
+  sid_carrier_set_glo_fcn(glo_slot_id, fcn);
   glo_map_unlock();
 }
 
@@ -106,6 +107,7 @@ void glo_map_clear_slot_id(u16 glo_slot_id) {
 
   glo_map_lock();
   glo_sv_id_fcn_map[glo_slot_id] = GLO_FCN_UNKNOWN;
+  sid_carrier_set_glo_fcn(glo_slot_id, GLO_FCN_UNKNOWN);
   glo_map_unlock();
 }
 
@@ -122,6 +124,7 @@ void glo_map_clear_all(void) {
 void glo_map_fill_dummy_data(void) {
   for (u16 i = 1; i < NUM_GLO_MAP_INDICES; ++i) {
     glo_sv_id_fcn_map[i] = -1;
+    sid_carrier_set_glo_fcn(i, glo_sv_id_fcn_map[i]);
   }
 }
 
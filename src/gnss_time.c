@@ -19,6 +19,8 @@
 #include <swiftnav/constants.h>
 #include <swiftnav/gnss_time.h>
 
+#include "thread_local.h"
+
 /** \defgroup time Time functions
  * Functions to handle GPS and UTC time values.
  * \{ */
@@ -298,6 +300,166 @@ void make_utc_tm(const gps_time_t *t, utc_tm *u) {
   u->week_day = days_since_1601 % 7 + 1;
 }
 
+/** Write `n` decimal digits of `value`, zero padded. */
+static void write_digits(char *buf, u32 value, u32 n) {
+  for (u32 i = n; i > 0; i--) {
+    buf[i - 1] = (char)('0' + value % 10);
+    value /= 10;
+  }
+}
+
+/** Write the date of a UTC time as ISO 8601, "YYYY-MM-DDT". */
+static void write_iso8601_date(char *buf, const utc_tm *u) {
+  write_digits(&buf[0], u->year, 4);
+  buf[4] = '-';
+  write_digits(&buf[5], u->month, 2);
+  buf[7] = '-';
+  write_digits(&buf[8], u->month_day, 2);
+  buf[10] = 'T';
+}
+
+/** Convert a GPS time to UTC with `gps2utc()` and cache its UTC day.
+ *
+ * The day is only cached if the UTC offset is constant throughout it, so
+ * that every time in the day is its start plus the seconds of the day. Days
+ * that start or end with a leap second event are cached without the event.
+ */
+static void utc_formatter_fill(utc_formatter_t *f,
+                               const gps_time_t *t,
+                               utc_tm *u) {
+  const utc_params_t *p = f->has_params ? &f->params : NULL;
+  gps2utc(t, u, p);
+  f->valid = false;
+
+  /* a drifting UTC offset moves the time of day against GPS time */
+  if (p != NULL && (fabs(p->a1) * DAY_SECS > 1e-9 || fabs(p->a2) > 0)) {
+    return;
+  }
+  /* during a leap second the time of day is past the end of the day */
+  if (u->second_int >= MINUTE_SECS) {
+    return;
+  }
+
+  f->day_start = *t;
+  f->day_start.tow -= u->second_frac;
+  add_secs(&f->day_start,
+           -(double)(u->hour * HOUR_SECS + u->minute * MINUTE_SECS +
+                     u->second_int));
+
+  /* the day must not contain a change of the UTC offset, a leap second event
+   * at its end starts exactly one day after its start */
+  gps_time_t last = f->day_start;
+  add_secs(&last, DAY_SECS - 1);
+  if (fabs(get_gps_utc_offset(&last, p) -
+           get_gps_utc_offset(&f->day_start, p)) > 0.5 ||
+      is_leap_second_event(&last, p)) {
+    return;
+  }
+
+  f->day = *u;
+  write_iso8601_date(f->date_str, u);
+  f->date_str[11] = '\0';
+  f->valid = true;
+}
+
+/** Initialize a UTC formatter.
+ *
+ * \param f Formatter
+ * \param p UTC parameters structure (optional), copied into the formatter
+ */
+void utc_formatter_init(utc_formatter_t *f, const utc_params_t *p) {
+  assert(f != NULL);
+  memset(f, 0, sizeof(*f));
+  if (p != NULL && p->t_lse.wn > 0) {
+    f->params = *p;
+    f->has_params = true;
+  }
+}
+
+/** Convert a GPS time to UTC, as `gps2utc()`.
+ *
+ * Within the cached UTC day the time of day is found from the time since the
+ * start of the day. Otherwise the full conversion is done and its day is
+ * cached.
+ *
+ * \param f Formatter
+ * \param t GPS time
+ * \param u UTC time
+ */
+void utc_formatter_tm(utc_formatter_t *f, const gps_time_t *t, utc_tm *u) {
+  assert(gps_time_valid(t));
+  assert(u != NULL);
+
+  if (f->valid) {
+    double dt = gpsdifftime(t, &f->day_start);
+    if (dt >= 0 && dt < DAY_SECS) {
+      u32 sod = (u32)dt;
+      *u = f->day;
+      u->second_frac = dt - sod;
+      u->hour = (u8)(sod / HOUR_SECS);
+      sod -= u->hour * HOUR_SECS;
+      u->minute = (u8)(sod / MINUTE_SECS);
+      u->second_int = (u8)(sod - u->minute * MINUTE_SECS);
+      return;
+    }
+  }
+
+  utc_formatter_fill(f, t, u);
+}
+
+/** Format a GPS time as an ISO 8601 UTC time, "YYYY-MM-DDTHH:MM:SS.sssZ".
+ *
+ * The fractional seconds are truncated so that the string never rounds up
+ * into the next second.
+ *
+ * \param f Formatter
+ * \param t GPS time
+ * \param decimals Number of decimals of the seconds, at most
+ *                 `UTC_ISO8601_MAX_DECIMALS`
+ * \param buf Output buffer, null terminated
+ * \param len Size of `buf`
+ * \return Length of the string, 0 if it does not fit in `buf`
+ */
+size_t utc_formatter_iso8601(utc_formatter_t *f,
+                             const gps_time_t *t,
+                             u8 decimals,
+                             char *buf,
+                             size_t len) {
+  static const u32 pow10[UTC_ISO8601_MAX_DECIMALS + 1] = {
+      1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+      1000000000};
+  assert(decimals <= UTC_ISO8601_MAX_DECIMALS);
+
+  size_t n = UTC_ISO8601_LEN + (decimals > 0 ? decimals + 1u : 0u);
+  if (len < n + 1) {
+    return 0;
+  }
+
+  utc_tm u;
+  utc_formatter_tm(f, t, &u);
+  if (f->valid) {
+    memcpy(buf, f->date_str, 11);
+  } else {
+    write_iso8601_date(buf, &u);
+  }
+
+  write_digits(&buf[11], u.hour, 2);
+  buf[13] = ':';
+  write_digits(&buf[14], u.minute, 2);
+  buf[16] = ':';
+  write_digits(&buf[17], u.second_int, 2);
+  char *end = &buf[19];
+  if (decimals > 0) {
+    u32 frac = (u32)(u.second_frac * pow10[decimals]);
+    *end++ = '.';
+    write_digits(end, MIN(frac, pow10[decimals] - 1), decimals);
+    end += decimals;
+  }
+  end[0] = 'Z';
+  end[1] = '\0';
+  return n;
+}
+
 /** Convert a `gps_time_t` GPS time to a Unix `time_t`.
  * \note Adjusts for leap seconds using the hard-coded table.
  * \note Deprecated, use gps2utc instead
@@ -676,6 +838,92 @@ glo_time_t gps2glo(const gps_time_t *gps_t, const utc_params_t *utc_params) {
   return glo_t;
 }
 
+/** Convert a GPS time to integer nanoseconds since the GPS epoch.
+ *
+ * The whole seconds are converted exactly and the fraction is rounded to the
+ * nearest nanosecond, so converting the result back with `ns2gps()` and
+ * again with this function gives the same value.
+ *
+ * \param t GPS time, need not be normalized
+ * \return Nanoseconds since the GPS epoch, or `GPS_TIME_NS_UNKNOWN` if the
+ *         week number is unknown or the time cannot be represented
+ */
+gps_time_ns_t gps2ns(const gps_time_t *t) {
+  if (t->wn < 0 || t->wn > GPS_TIME_NS_MAX_WN || !isfinite(t->tow) ||
+      fabs(t->tow) > 100.0 * WEEK_SECS) {
+    return GPS_TIME_NS_UNKNOWN;
+  }
+  double secs = floor(t->tow);
+  s64 whole = (s64)t->wn * WEEK_SECS + (s64)secs;
+  gps_time_ns_t r = {whole * SECS_NS_INT + llround((t->tow - secs) * SECS_NS)};
+  return r;
+}
+
+/** Convert integer nanoseconds since the GPS epoch to a GPS time.
+ *
+ * \param t Nanoseconds since the GPS epoch
+ * \return Normalized GPS time, or `GPS_TIME_UNKNOWN` if `t` is unknown
+ */
+gps_time_t ns2gps(gps_time_ns_t t) {
+  if (!gps_time_ns_valid(t)) {
+    return GPS_TIME_UNKNOWN;
+  }
+  s64 wn = t.ns / WEEK_NS_INT;
+  s64 ns = t.ns % WEEK_NS_INT;
+  if (ns < 0) {
+    ns += WEEK_NS_INT;
+    wn -= 1;
+  }
+  gps_time_t r;
+  r.wn = (s16)wn;
+  /* whole and fractional seconds separately, both divisions are exact or
+   * correctly rounded */
+  r.tow = (double)(ns / SECS_NS_INT) + (double)(ns % SECS_NS_INT) / SECS_NS;
+  return r;
+}
+
+/** Convert a GLO time to integer nanoseconds since the GPS epoch.
+ *
+ * The fraction of the GLO seconds is carried separately from the whole
+ * seconds so it is not rounded by the conversion through GPS time.
+ *
+ * \param glo_t GLO time
+ * \param utc_params UTC parameters, see `glo2gps()`
+ * \return Nanoseconds since the GPS epoch, or `GPS_TIME_NS_UNKNOWN` if the GLO
+ *         time is not valid
+ */
+gps_time_ns_t glo2ns(const glo_time_t *glo_t, const utc_params_t *utc_params) {
+  glo_time_t whole = *glo_t;
+  whole.s = floor(glo_t->s);
+  gps_time_t t = glo2gps(&whole, utc_params);
+  if (!gps_time_valid(&t)) {
+    return GPS_TIME_NS_UNKNOWN;
+  }
+  gps_time_ns_t r = gps2ns(&t);
+  if (!gps_time_ns_valid(r)) {
+    return r;
+  }
+  return gps_time_ns_add(r, llround((glo_t->s - whole.s) * SECS_NS));
+}
+
+/** Convert integer nanoseconds since the GPS epoch to a GLO time.
+ *
+ * \param t Nanoseconds since the GPS epoch, not before the GLO epoch
+ * \param utc_params UTC parameters, see `gps2glo()`
+ * \return GLO time
+ */
+glo_time_t ns2glo(gps_time_ns_t t, const utc_params_t *utc_params) {
+  assert(gps_time_ns_valid(t));
+  s64 ns = t.ns % SECS_NS_INT;
+  if (ns < 0) {
+    ns += SECS_NS_INT;
+  }
+  gps_time_t whole = ns2gps(gps_time_ns_add(t, -ns));
+  glo_time_t glo_t = gps2glo(&whole, utc_params);
+  glo_t.s += (double)ns / SECS_NS;
+  return glo_t;
+}
+
 /** GPS time to day of year.
  * \note Adjusts for leap seconds using the hard-coded table.
  *
@@ -796,6 +1044,20 @@ bool decode_utc_parameters_with_wn_ref(const u32 words[8],
   return retval;
 }
 
+/** Modified Julian day number of a calendar date, see date2mjd(). */
+static s32 date2mjd_days(s32 year, s32 month, s32 day) {
+  return 367 * year - 7 * (year + (month + 9) / 12) / 4 -
+         3 * ((year + (month - 9) / 7) / 100 + 1) / 4 + 275 * month / 9 + day +
+         1721028 - 2400000;
+}
+
+/** Fraction of the day of a time of day. */
+static double date2mjd_frac(s32 hour, s32 min, double sec) {
+  return (double)hour / (double)DAY_HOURS +
+         (double)min / (double)(DAY_HOURS * HOUR_MINUTES) +
+         sec / (double)DAY_SECS;
+}
+
 /* Taken with permission from http://www.leapsecond.com/tools/gpsdate.c */
 /*
  * Return Modified Julian Day given calendar year,
@@ -806,13 +1068,8 @@ bool decode_utc_parameters_with_wn_ref(const u32 words[8],
 /* NOTE: This function will be inaccurate by up to a second on the day of a leap
  * second. */
 double date2mjd(s32 year, s32 month, s32 day, s32 hour, s32 min, double sec) {
-  s32 full_days = 367 * year - 7 * (year + (month + 9) / 12) / 4 -
-                  3 * ((year + (month - 9) / 7) / 100 + 1) / 4 +
-                  275 * month / 9 + day + 1721028 - 2400000;
-  double frac_days = (double)hour / (double)DAY_HOURS +
-                     (double)min / (double)(DAY_HOURS * HOUR_MINUTES) +
-                     sec / (double)DAY_SECS;
-  return (double)full_days + frac_days;
+  s32 full_days = date2mjd_days(year, month, day);
+  return (double)full_days + date2mjd_frac(hour, min, sec);
 }
 
 /* Taken with permission from http://www.leapsecond.com/tools/gpsdate.c */
@@ -987,6 +1244,104 @@ u8 days_in_month(u16 year, u8 month) {
   return days_in_month_lookup[month];
 }
 
+/* Thread local storage specifier for the leap second interval caches. The
+ * caches are left out if the compiler offers none or the platform cannot use
+ * it, in which case every lookup is a binary search. */
+#if defined(SWIFTNAV_THREAD_LOCAL) && !defined(LIBSWIFTNAV_DISABLE_LEAP_CACHE)
+#define LEAP_CACHE_TLS SWIFTNAV_THREAD_LOCAL
+#endif
+
+/** Number of rows in the leap second table. */
+#define N_UTC_LEAPS ((u32)ARRAY_SIZE(utc_leap_secs))
+
+/** The leap second table searched for GPS or for UTC times. */
+typedef enum {
+  LEAP_SEARCH_GPS = 0,
+  LEAP_SEARCH_UTC,
+  LEAP_SEARCH_N
+} leap_search_t;
+
+/** Range of whole seconds since the GPS epoch with a constant UTC offset. */
+typedef struct {
+  /** First second of the range. */
+  s64 start;
+  /** First second past the range. */
+  s64 end;
+  /** GPS - UTC offset in the range [s]. */
+  s32 offset;
+} leap_interval_t;
+
+/** Time from which the offset of a leap second table row is in effect, in
+ * seconds since the GPS epoch of the searched time scale. */
+static s64 leap_threshold(u32 i, leap_search_t search) {
+  /* The new offset takes effect one second after the start of the event, or
+   * in UTC after the offset has been taken out. */
+  s64 start = utc_leap_secs[i] + 1;
+  return (LEAP_SEARCH_UTC == search) ? start - utc_leaps[i][2] : start;
+}
+
+/** Binary search of the leap second table for the interval containing `secs`.
+ *
+ * \param secs Whole seconds since the GPS epoch
+ * \param search Whether `secs` is a GPS or a UTC time
+ * \param iv Interval containing `secs`
+ */
+static void leap_interval(s64 secs,
+                          leap_search_t search,
+                          leap_interval_t *iv) {
+  /* Number of rows in effect at `secs`. */
+  u32 lo = 0;
+  u32 hi = N_UTC_LEAPS;
+  while (lo < hi) {
+    u32 mid = (lo + hi) / 2;
+    if (secs >= leap_threshold(mid, search)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  iv->start = (lo > 0) ? leap_threshold(lo - 1, search) : INT64_MIN;
+  iv->end = (lo < N_UTC_LEAPS) ? leap_threshold(lo, search) : INT64_MAX;
+  iv->offset = (lo > 0) ? utc_leaps[lo - 1][2] : 0;
+}
+
+/** Interval of the leap second table containing a time.
+ *
+ * Times are compared in whole seconds, which gives the same result as
+ * comparing with the fractional part since all the table entries are whole
+ * seconds. Each thread remembers the last interval it looked up so repeated
+ * lookups in the same interval need no search.
+ *
+ * \param t GPS or UTC time with a known week number and finite time of week
+ * \param search Whether `t` is a GPS or a UTC time
+ * \param secs Whole seconds of `t` since the GPS epoch
+ * \return Interval containing `secs`
+ */
+static leap_interval_t leap_table_interval(const gps_time_t *t,
+                                           leap_search_t search,
+                                           s64 *secs) {
+  *secs = (s64)t->wn * WEEK_SECS + (s64)floor(t->tow);
+#ifdef LEAP_CACHE_TLS
+  static LEAP_CACHE_TLS leap_interval_t cache[LEAP_SEARCH_N];
+  leap_interval_t *iv = &cache[search];
+  /* A zeroed interval is empty, so the first lookup always searches. */
+  if (*secs < iv->start || *secs >= iv->end) {
+    leap_interval(*secs, search, iv);
+  }
+  return *iv;
+#else
+  leap_interval_t iv;
+  leap_interval(*secs, search, &iv);
+  return iv;
+#endif
+}
+
+/** Tell whether the leap second table can be searched for a time. */
+static bool leap_table_searchable(const gps_time_t *t) {
+  /* Bound the time of week so the seconds since the epoch cannot overflow. */
+  return t->wn >= 0 && isfinite(t->tow) && fabs(t->tow) < 1e15;
+}
+
 /** Difference between GPS and UTC time. Use UTC params struct if given,
  * otherwise use the hard-coded table.
  *
@@ -1014,8 +1369,13 @@ double get_gps_utc_offset(const gps_time_t *t, const utc_params_t *p) {
     return dt_utc;
   }
 
-  /* utc_params not given, so iterate through the leap second table,
-   * starting from latest */
+  /* utc_params not given, so look up the leap second table */
+  if (leap_table_searchable(t)) {
+    s64 secs;
+    return leap_table_interval(t, LEAP_SEARCH_GPS, &secs).offset;
+  }
+
+  /* without a week number iterate through the table, starting from latest */
   for (s16 i = ARRAY_SIZE(utc_leaps) - 1; i >= 0; i--) {
     gps_time_t t_leap = {.wn = utc_leaps[i][0], .tow = (double)utc_leaps[i][1]};
     /* the UTC offset takes effect exactly 1 second after the start of
@@ -1054,6 +1414,12 @@ double get_utc_gps_offset(const gps_time_t *utc_time, const utc_params_t *p) {
     return -dt_utc;
   }
 
+  if (leap_table_searchable(utc_time)) {
+    s64 secs;
+    return -leap_table_interval(utc_time, LEAP_SEARCH_UTC, &secs).offset;
+  }
+
+  /* without a week number iterate through the table, starting from latest */
   for (s16 i = ARRAY_SIZE(utc_leaps) - 1; i >= 0; i--) {
     gps_time_t t_leap = {.wn = utc_leaps[i][0], .tow = (double)utc_leaps[i][1]};
     /* the new UTC offset takes effect after the leap second event */
@@ -1087,7 +1453,15 @@ bool is_leap_second_event(const gps_time_t *t, const utc_params_t *p) {
     return false;
   }
 
-  /* iterate through the leap second table, starting from latest */
+  /* the event is the last second before the offset of the next interval of
+   * the leap second table takes effect */
+  if (leap_table_searchable(t)) {
+    s64 secs;
+    leap_interval_t iv = leap_table_interval(t, LEAP_SEARCH_GPS, &secs);
+    return iv.end != INT64_MAX && secs == iv.end - 1;
+  }
+
+  /* without a week number iterate through the table, starting from latest */
   for (s16 i = ARRAY_SIZE(utc_leaps) - 1; i >= 0; i--) {
     gps_time_t t_leap = {.wn = utc_leaps[i][0], .tow = utc_leaps[i][1]};
 
@@ -1106,6 +1480,160 @@ bool is_leap_second_event(const gps_time_t *t, const utc_params_t *p) {
   return false;
 }
 
+/** State of a batch conversion, carried from one time to the next. Input
+ * times are usually ordered, so consecutive times mostly share a day and a
+ * leap second interval. */
+typedef struct {
+  /** Last date converted to MJD and its day number. */
+  s32 year;
+  s32 month;
+  s32 day;
+  s32 mjd_days;
+  /** Last leap second interval found. */
+  leap_interval_t leap;
+} time_batch_t;
+
+/** `utc2mjd()` reusing the day number of the previous date. */
+static double batch_utc2mjd(time_batch_t *b, const utc_tm *u) {
+  if (u->year != b->year || u->month != b->month || u->month_day != b->day) {
+    b->year = u->year;
+    b->month = u->month;
+    b->day = u->month_day;
+    b->mjd_days = date2mjd_days(b->year, b->month, b->day);
+  }
+  double secs = (double)u->second_int + u->second_frac;
+  return (double)b->mjd_days + date2mjd_frac(u->hour, u->minute, secs);
+}
+
+/** `mjd2gps()` searching the leap second table only when leaving the
+ * interval of the previous time. */
+static gps_time_t batch_mjd2gps(time_batch_t *b, double mjd) {
+  double utc_days = mjd - MJD_JAN_6_1980;
+  gps_time_t t;
+  t.wn = (s16)(utc_days / WEEK_DAYS);
+  t.tow = (utc_days - t.wn * WEEK_DAYS) * (double)DAY_SECS;
+  if (!leap_table_searchable(&t)) {
+    add_secs(&t, -get_utc_gps_offset(&t, NULL));
+    return t;
+  }
+  s64 secs = (s64)t.wn * WEEK_SECS + (s64)floor(t.tow);
+  if (secs < b->leap.start || secs >= b->leap.end) {
+    leap_interval(secs, LEAP_SEARCH_UTC, &b->leap);
+  }
+  add_secs(&t, (double)b->leap.offset);
+  return t;
+}
+
+/** Convert an array of UTC times to MJD, as `utc2mjd()`.
+ *
+ * \param n Number of times
+ * \param utc UTC times
+ * \param mjd Modified Julian dates
+ */
+void utc2mjd_batch(size_t n, const utc_tm *utc, double *mjd) {
+  time_batch_t b = {0};
+  for (size_t i = 0; i < n; i++) {
+    mjd[i] = batch_utc2mjd(&b, &utc[i]);
+  }
+}
+
+/** Convert an array of MJDs to GPS times, as `mjd2gps_params()`.
+ *
+ * The leap second table is only searched when a time is outside the leap
+ * second interval of the previous one, so ordered input costs about one
+ * search per leap second crossed.
+ *
+ * \param n Number of times
+ * \param mjd Modified Julian dates
+ * \param p UTC parameters structure (optional)
+ * \param gps GPS times
+ */
+void mjd2gps_batch(size_t n,
+                   const double *mjd,
+                   const utc_params_t *p,
+                   gps_time_t *gps) {
+  if (p != NULL && p->t_lse.wn > 0) {
+    for (size_t i = 0; i < n; i++) {
+      gps[i] = mjd2gps_params(mjd[i], p);
+    }
+    return;
+  }
+  time_batch_t b = {0};
+  for (size_t i = 0; i < n; i++) {
+    gps[i] = batch_mjd2gps(&b, mjd[i]);
+  }
+}
+
+/** Convert an array of UTC times to GPS times, as `utc2gps()`.
+ *
+ * \param n Number of times
+ * \param utc UTC times
+ * \param p UTC parameters structure (optional)
+ * \param gps GPS times
+ */
+void utc2gps_batch(size_t n,
+                   const utc_tm *utc,
+                   const utc_params_t *p,
+                   gps_time_t *gps) {
+  if (p != NULL && p->t_lse.wn > 0) {
+    for (size_t i = 0; i < n; i++) {
+      utc2gps(&utc[i], &gps[i], p);
+    }
+    return;
+  }
+  time_batch_t b = {0};
+  for (size_t i = 0; i < n; i++) {
+    gps[i] = batch_mjd2gps(&b, batch_utc2mjd(&b, &utc[i]));
+    /* see utc2gps() */
+    if (utc[i].second_int >= 60) {
+      add_secs(&gps[i], -1.0);
+    }
+  }
+}
+
+/** Convert an array of GPS times to MJD, as `gps2mjd_params()`.
+ *
+ * The MJD is formed directly from the UTC seconds since the GPS epoch
+ * instead of through the calendar date, and the leap second table is only
+ * searched when a time is outside the leap second interval of the previous
+ * one. Times during a leap second event take the scalar path.
+ *
+ * \param n Number of times
+ * \param gps GPS times
+ * \param p UTC parameters structure (optional)
+ * \param mjd Modified Julian dates
+ */
+void gps2mjd_batch(size_t n,
+                   const gps_time_t *gps,
+                   const utc_params_t *p,
+                   double *mjd) {
+  if (p != NULL && p->t_lse.wn > 0) {
+    for (size_t i = 0; i < n; i++) {
+      mjd[i] = gps2mjd_params(&gps[i], p);
+    }
+    return;
+  }
+  leap_interval_t leap = {0};
+  for (size_t i = 0; i < n; i++) {
+    const gps_time_t *t = &gps[i];
+    assert(gps_time_valid(t));
+    double whole = floor(t->tow);
+    s64 secs = (s64)t->wn * WEEK_SECS + (s64)whole;
+    if (secs < leap.start || secs >= leap.end) {
+      leap_interval(secs, LEAP_SEARCH_GPS, &leap);
+    }
+    if (leap.end != INT64_MAX && secs == leap.end - 1) {
+      mjd[i] = gps2mjd_params(t, NULL);
+      continue;
+    }
+    s64 utc_secs = secs - leap.offset;
+    s64 days = utc_secs / DAY_SECS;
+    s64 sod = utc_secs - days * DAY_SECS;
+    mjd[i] = (double)(MJD_JAN_6_1980 + days) +
+             ((double)sod + (t->tow - whole)) / (double)DAY_SECS;
+  }
+}
+
 /** Given a gps time, return the gps time of the nearest solution epoch
  * \param time time to round
  * \param soln_freq solution frequency
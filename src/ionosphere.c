@@ -24,44 +24,28 @@
  * Implemenations of ionospheric delay correction models.
  * \{ */
 
-/** Calculate ionospheric delay using Klobuchar model.
+/** Klobuchar model vertical delay mapped to the line of sight, in seconds
+ * at the GPS L1 frequency.
  *
- * References:
- *   -# IS-GPS-200H, Section 20.3.3.5.2.5 and Figure 20-4
- *
- * \param t_gps GPS time at which to calculate the ionospheric delay
- * \param lat_u Latitude of the receiver [rad]
- * \param lon_u Longitude of the receiver [rad]
+ * \param lat_u Latitude of the receiver [semicircles]
+ * \param lon_u Longitude of the receiver [semicircles]
+ * \param tow GPS time of week [s]
  * \param a Azimuth of the satellite, clockwise positive from North [rad]
- * \param e Elevation of the satellite [rad]
+ * \param e Elevation of the satellite [semicircles]
  * \param i Ionosphere parameters struct from GPS NAV data
- *
- * \return Ionospheric delay distance for GPS L1 frequency [m]
  */
-double calc_ionosphere(const gps_time_t *t_gps,
-                       double lat_u,
-                       double lon_u,
-                       double a,
-                       double e,
-                       const ionosphere_t *i) {
-  /* Convert inputs from radians to semicircles */
-  /* All calculations are in semicircles */
-  lat_u = lat_u / M_PI;
-  lon_u = lon_u / M_PI;
-  /* a can remain in radians */
-  e = e / M_PI;
-
+static inline double klobuchar_delay(double lat_u,
+                                     double lon_u,
+                                     double tow,
+                                     double a,
+                                     double e,
+                                     const ionosphere_t *i) {
   /* Calculate the earth-centered angle */
   double psi = 0.0137 / (e + 0.11) - 0.022;
 
   /* Compute the latitude of the Ionospheric Pierce Point */
   double lat_i = lat_u + psi * cos(a);
-  if (lat_i > 0.416) {
-    lat_i = 0.416;
-  }
-  if (lat_i < -0.416) {
-    lat_i = -0.416;
-  }
+  lat_i = MAX(MIN(lat_i, 0.416), -0.416);
 
   /* Compute the longitude of the IPP */
   double lon_i = lon_u + (psi * sin(a)) / cos(lat_i * M_PI);
@@ -70,26 +54,16 @@ double calc_ionosphere(const gps_time_t *t_gps,
   double lat_m = lat_i + 0.064 * cos((lon_i - 1.617) * M_PI);
 
   /* Find the local time at the IPP */
-  double t = 43200.0 * lon_i + t_gps->tow;
-  t = fmod(t, DAY_SECS);
-  if (t > DAY_SECS) {
-    t -= DAY_SECS;
-  }
-  if (t < 0.0) {
-    t += DAY_SECS;
-  }
+  double t = fmod(43200.0 * lon_i + tow, DAY_SECS);
+  t += (t < 0.0) ? DAY_SECS : 0.0;
 
   /* Compute the amplitude of ionospheric delay */
   double amp = i->a0 + lat_m * (i->a1 + lat_m * (i->a2 + i->a3 * lat_m));
-  if (amp < 0.0) {
-    amp = 0.0;
-  }
+  amp = MAX(amp, 0.0);
 
   /* Compute the period of ionospheric delay */
   double per = i->b0 + lat_m * (i->b1 + lat_m * (i->b2 + i->b3 * lat_m));
-  if (per < 72000.0) {
-    per = 72000.0;
-  }
+  per = MAX(per, 72000.0);
 
   /* Compute the phase of ionospheric delay */
   double x = 2.0 * M_PI * (t - 50400.0) / per;
@@ -98,18 +72,87 @@ double calc_ionosphere(const gps_time_t *t_gps,
   double temp = 0.53 - e;
   double sf = 1.0 + 16.0 * temp * temp * temp;
 
-  /* Compute the ionospheric time delay */
-  double d_l1;
-  if (fabs(x) >= 1.57) {
-    d_l1 = sf * 5e-9;
-  } else {
-    double x_2 = x * x;
-    d_l1 = sf * (5e-9 + amp * (1.0 - x_2 / 2.0 + x_2 * x_2 / 24.0));
-  }
+  /* Compute the ionospheric time delay, the cosine term only applies during
+   * the day */
+  double x_2 = x * x;
+  double day = amp * (1.0 - x_2 / 2.0 + x_2 * x_2 / 24.0);
+  return sf * (5e-9 + ((fabs(x) >= 1.57) ? 0.0 : day));
+}
 
-  d_l1 *= GPS_C;
+/** Calculate ionospheric delay using Klobuchar model.
+ *
+ * References:
+ *   -# IS-GPS-200H, Section 20.3.3.5.2.5 and Figure 20-4
+ *
+ * \param t_gps GPS time at which to calculate the ionospheric delay
+ * \param lat_u Latitude of the receiver [rad]
+ * \param lon_u Longitude of the receiver [rad]
+ * \param a Azimuth of the satellite, clockwise positive from North [rad]
+ * \param e Elevation of the satellite [rad]
+ * \param i Ionosphere parameters struct from GPS NAV data
+ *
+ * \return Ionospheric delay distance for GPS L1 frequency [m]
+ */
+double calc_ionosphere(const gps_time_t *t_gps,
+                       double lat_u,
+                       double lon_u,
+                       double a,
+                       double e,
+                       const ionosphere_t *i) {
+  /* Convert inputs from radians to semicircles */
+  /* All calculations are in semicircles */
+  /* a can remain in radians */
+  return klobuchar_delay(
+             lat_u / M_PI, lon_u / M_PI, t_gps->tow, a, e / M_PI, i) *
+         GPS_C;
+}
+
+/** Calculate ionospheric delays of several signals from one receiver using
+ * the Klobuchar model.
+ *
+ * The receiver terms are computed once, and the pierce points and delays of
+ * all satellites in a single pass. Each delay is scaled from GPS L1 to the
+ * carrier frequency of its signal.
+ *
+ * References:
+ *   -# IS-GPS-200H, Section 20.3.3.5.2.5 and Figure 20-4
+ *
+ * \param t_gps GPS time at which to calculate the ionospheric delay
+ * \param lat_u Latitude of the receiver [rad]
+ * \param lon_u Longitude of the receiver [rad]
+ * \param i Ionosphere parameters struct from GPS NAV data
+ * \param n Number of signals
+ * \param a Azimuths of the satellites, clockwise positive from North [rad]
+ * \param e Elevations of the satellites [rad]
+ * \param sids Signals, or NULL for delays at the GPS L1 frequency. GLONASS
+ *             signals must have a known frequency slot.
+ * \param delay Ionospheric delay distances [m]
+ */
+void calc_ionosphere_batch(const gps_time_t *t_gps,
+                           double lat_u,
+                           double lon_u,
+                           const ionosphere_t *i,
+                           size_t n,
+                           const double *a,
+                           const double *e,
+                           const gnss_signal_t *sids,
+                           double *delay) {
+  const double lat_sc = lat_u / M_PI;
+  const double lon_sc = lon_u / M_PI;
+  const double tow = t_gps->tow;
+
+  for (size_t k = 0; k < n; k++) {
+    delay[k] =
+        klobuchar_delay(lat_sc, lon_sc, tow, a[k], e[k] / M_PI, i) * GPS_C;
+  }
 
-  return d_l1;
+  if (NULL != sids) {
+    /* The delay is inversely proportional to the square of the frequency */
+    for (size_t k = 0; k < n; k++) {
+      const double ratio = GPS_L1_HZ / sid_to_carr_freq(sids[k]);
+      delay[k] *= ratio * ratio;
+    }
+  }
 }
 
 /**
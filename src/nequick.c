@@ -0,0 +1,816 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <swiftnav/constants.h>
+#include <swiftnav/nequick.h>
+
+/** \defgroup nequick NeQuick-G
+ * Galileo single frequency ionospheric correction.
+ *
+ * The slant total electron content is the integral of the NeQuick electron
+ * density along the straight line between receiver and satellite. Every
+ * density evaluation needs the ionospheric profile at the point, so the cost
+ * is dominated by the number of integration points and the work per profile.
+ * To keep that down:
+ *
+ *   - Everything that only depends on the receiver and the epoch (effective
+ *     ionisation level, solar declination, CCIR maps evaluated in time) is
+ *     computed once by nequick_prepare() and cached in the context.
+ *   - The integral is evaluated with adaptive Gauss-Kronrod G7/K15 quadrature
+ *     which stops refining an interval as soon as the G7 and K15 estimates
+ *     agree, so smooth parts of the ray cost 15 evaluations.
+ *   - Near vertical rays reuse the profile at the receiver for every height.
+ *
+ * \note The unit tests use synthetic coefficient tables only. The model has
+ *       not yet been checked against the reference slant TEC vectors of the
+ *       specification, which need the official MODIP and CCIR files.
+ *
+ * References:
+ *   -# European GNSS (Galileo) Open Service, Ionospheric Correction Algorithm
+ *      for Galileo Single Frequency Users, Issue 1.2, September 2016.
+ * \{ */
+
+/** Mean Earth radius used by the model [km]. */
+#define NEQUICK_RE_KM 6371.2
+/** Rays with a perigee radius below this are treated as vertical [km]. */
+#define NEQUICK_VERTICAL_RP_KM 0.1
+/** Integration breakpoints [km]. */
+#define NEQUICK_H_A_KM 1000.0
+#define NEQUICK_H_B_KM 2000.0
+/** Relative integration tolerance below and above `NEQUICK_H_A_KM`. */
+#define NEQUICK_TOL_LOW 0.001
+#define NEQUICK_TOL_HIGH 0.01
+/** Density evaluations of one G7/K15 quadrature. */
+#define NEQUICK_KRONROD_EVALS 15
+/** Maximum number of density evaluations per integration segment. */
+#define NEQUICK_MAX_EVALS (512 * NEQUICK_KRONROD_EVALS)
+/** Solar zenith angle at which the effective angle is joined [deg]. */
+#define NEQUICK_CHI0_DEG 86.23292796211615
+/** Electron density units of the profile parameters [m^-3]. */
+#define NEQUICK_DENSITY_UNIT 1e11
+/** Integral of density [m^-3] over distance [km] to TECU. */
+#define NEQUICK_TECU_PER_KM 1e-13
+/** Ionospheric delay per TECU times frequency squared [m Hz^2]. */
+#define NEQUICK_DELAY_PER_TECU 40.3e16
+
+/** Number of coefficients per order of the CCIR foF2 Legendre expansion. */
+static const u8 f2_terms[9] = {12, 12, 9, 5, 2, 1, 1, 1, 1};
+/** Number of coefficients per order of the CCIR M(3000)F2 expansion. */
+static const u8 fm3_terms[7] = {7, 8, 6, 3, 2, 1, 1};
+
+/** Ionospheric profile at one location. Densities in units of 1e11 m^-3,
+ * heights and thicknesses in km. */
+typedef struct {
+  double hm_e;
+  double hm_f1;
+  double hm_f2;
+  double b2_bot;
+  double b1_top;
+  double b1_bot;
+  double be_top;
+  double be_bot;
+  double a1;
+  double a2;
+  double a3;
+  double nm_f2;
+  double h0;
+} nequick_profile_t;
+
+/** Straight ray between receiver and satellite, parameterised by the signed
+ * distance `s` from the point closest to the Earth's centre. */
+typedef struct {
+  const nequick_context_t *ctx;
+  /** Profile used for every point of a vertical ray, otherwise NULL. */
+  const nequick_profile_t *vertical;
+  double p[3];
+  double u[3];
+  double rp;
+} nequick_ray_t;
+
+/** Exponential clipped to avoid overflow and underflow. */
+static double clip_exp(double x) {
+  if (x > 80) {
+    return 5.5406e34;
+  }
+  if (x < -80) {
+    return 1.8049e-35;
+  }
+  return exp(x);
+}
+
+/** Smoothly join `f1` for `x` > 0 and `f2` for `x` < 0. */
+static double join(double f1, double f2, double alpha, double x) {
+  double ee = clip_exp(alpha * x);
+  return (f1 * ee + f2) / (ee + 1);
+}
+
+/** Epstein function with peak amplitude `x`, thickness `y`, peak height `z`
+ * evaluated at height `w`. */
+static double epstein(double x, double y, double z, double w) {
+  double ee = clip_exp((w - z) / y);
+  return x * ee / ((1 + ee) * (1 + ee));
+}
+
+/** Four point cubic interpolation between `z[1]` (`x` = 0) and `z[2]`
+ * (`x` = 1) on equally spaced nodes. */
+static double interpolate(const double z[4], double x) {
+  if (fabs(x) < 1e-10) {
+    return z[1];
+  }
+  double d = 2 * x - 1;
+  double g1 = z[2] + z[1];
+  double g2 = z[2] - z[1];
+  double g3 = z[3] + z[0];
+  double g4 = (z[3] - z[0]) / 3;
+  double a0 = 9 * g1 - g3;
+  double a1 = 9 * g2 - g4;
+  double a2 = g3 - g1;
+  double a3 = g4 - g2;
+  return (a0 + d * (a1 + d * (a2 + d * a3))) / 16;
+}
+
+/** Read `n` whitespace separated numbers from a text file.
+ *
+ * \return 0 on success, -1 if the file can not be read or does not contain
+ *         exactly `n` numbers.
+ */
+static s8 read_numbers(const char *path, size_t n, double *out) {
+  FILE *f = fopen(path, "r");
+  if (NULL == f) {
+    return -1;
+  }
+  size_t i = 0;
+  while (i < n && 1 == fscanf(f, "%lf", &out[i])) {
+    i++;
+  }
+  char c;
+  s8 ret = (i == n && 1 != fscanf(f, " %c", &c)) ? 0 : -1;
+  fclose(f);
+  return ret;
+}
+
+/** Load the modified dip latitude grid.
+ *
+ * \param data   Tables to fill.
+ * \param path   Path of `modipNeQG_wrapped.asc`: 39 rows of 39 values, from
+ *               south to north, each row from west to east.
+ *
+ * \return 0 on success, -1 on error in which case `data` is unchanged.
+ */
+s8 nequick_load_modip(nequick_data_t *data, const char *path) {
+  double modip[NEQUICK_MODIP_ROWS][NEQUICK_MODIP_COLS];
+  size_t n = NEQUICK_MODIP_ROWS * NEQUICK_MODIP_COLS;
+  if (read_numbers(path, n, &modip[0][0]) < 0) {
+    return -1;
+  }
+  memcpy(data->modip, modip, sizeof(modip));
+  data->modip_loaded = true;
+  return 0;
+}
+
+/** Load the CCIR foF2 and M(3000)F2 maps of one month.
+ *
+ * \param data   Tables to fill.
+ * \param month  Month of the year (1 - 12).
+ * \param path   Path of the CCIR file of the month, `ccir11.asc` for January
+ *               to `ccir22.asc` for December.
+ *
+ * \return 0 on success, -1 on error in which case `data` is unchanged.
+ */
+s8 nequick_load_ccir(nequick_data_t *data, u8 month, const char *path) {
+  enum {
+    N_F2 = 2 * NEQUICK_F2_COEFFS * NEQUICK_F2_HARMONICS,
+    N_FM3 = 2 * NEQUICK_FM3_COEFFS * NEQUICK_FM3_HARMONICS,
+  };
+  double buf[N_F2 + N_FM3];
+  if (month < 1 || month > 12 || read_numbers(path, N_F2 + N_FM3, buf) < 0) {
+    return -1;
+  }
+  memcpy(data->f2[month - 1], buf, N_F2 * sizeof(double));
+  memcpy(data->fm3[month - 1], &buf[N_F2], N_FM3 * sizeof(double));
+  data->ccir_loaded[month - 1] = true;
+  return 0;
+}
+
+/** Initialise an evaluation context.
+ *
+ * \param ctx    Context to initialise.
+ * \param data   Coefficient tables, must outlive the context.
+ * \param coeffs Broadcast effective ionisation level coefficients.
+ */
+void nequick_init(nequick_context_t *ctx,
+                  const nequick_data_t *data,
+                  const nequick_coeffs_t *coeffs) {
+  memset(ctx, 0, sizeof(*ctx));
+  ctx->data = data;
+  ctx->coeffs = *coeffs;
+  ctx->rx_lat = NAN;
+  ctx->rx_lon = NAN;
+  ctx->rx_h = NAN;
+  ctx->ut = NAN;
+  ctx->az_r = NAN;
+}
+
+/** Exact comparison of cache keys, NaN only matches the same NaN. */
+static bool same_bits(double a, double b) {
+  return 0 == memcmp(&a, &b, sizeof(a));
+}
+
+/** Modified dip latitude.
+ *
+ * \param data    Coefficient tables.
+ * \param lat_deg Latitude [deg].
+ * \param lon_deg Longitude [deg].
+ *
+ * \return Modified dip latitude [deg].
+ */
+double nequick_modip(const nequick_data_t *data,
+                     double lat_deg,
+                     double lon_deg) {
+  if (lat_deg <= -90) {
+    return -90;
+  }
+  if (lat_deg >= 90) {
+    return 90;
+  }
+  lon_deg = fmod(lon_deg + 180, 360);
+  if (lon_deg < 0) {
+    lon_deg += 360;
+  }
+
+  /* Fractional grid indices, rows and columns 0 and 38 are wrap around. */
+  double y = lat_deg / 5 + 19;
+  double x = lon_deg / 10 + 1;
+  int i = MIN((int)y, NEQUICK_MODIP_ROWS - 3);
+  int j = MIN((int)x, NEQUICK_MODIP_COLS - 3);
+
+  double z[4];
+  for (int k = 0; k < 4; k++) {
+    double col[4];
+    for (int l = 0; l < 4; l++) {
+      col[l] = data->modip[i - 1 + l][j - 1 + k];
+    }
+    z[k] = interpolate(col, y - i);
+  }
+  return interpolate(z, x - j);
+}
+
+/** Update the cached receiver and epoch dependent parameters.
+ *
+ * Only the parameters invalidated since the previous call are recomputed, so
+ * calling this every epoch for a static receiver is cheap.
+ *
+ * \param ctx        Context.
+ * \param t          Epoch, UTC.
+ * \param rx_lat_rad Receiver latitude [rad].
+ * \param rx_lon_rad Receiver longitude [rad].
+ * \param rx_h       Receiver height [m].
+ *
+ * \return 0 on success, -1 if the epoch is invalid, or the modified dip
+ *         latitude grid or the CCIR maps of its month have not been loaded.
+ */
+s8 nequick_prepare(nequick_context_t *ctx,
+                   const utc_tm *t,
+                   double rx_lat_rad,
+                   double rx_lon_rad,
+                   double rx_h) {
+  if (t->month < 1 || t->month > 12 || !ctx->data->modip_loaded ||
+      !ctx->data->ccir_loaded[t->month - 1]) {
+    return -1;
+  }
+  double lat = rx_lat_rad * R2D;
+  double lon = rx_lon_rad * R2D;
+  double ut = t->hour + t->minute / 60.0 +
+              (t->second_int + t->second_frac) / HOUR_SECS;
+  ctx->rx_h = rx_h / 1000;
+
+  if (!same_bits(lat, ctx->rx_lat) || !same_bits(lon, ctx->rx_lon)) {
+    ctx->rx_lat = lat;
+    ctx->rx_lon = lon;
+    const nequick_coeffs_t *c = &ctx->coeffs;
+    double az = 63.7;
+    if (fabs(c->ai0) + fabs(c->ai1) + fabs(c->ai2) > 0) {
+      double mu = nequick_modip(ctx->data, lat, lon);
+      az = c->ai0 + (c->ai1 + c->ai2 * mu) * mu;
+    }
+    ctx->az = MIN(MAX(az, 0.0), 400.0);
+  }
+
+  double az_r = sqrt(167273 + (ctx->az - 63.7) * 1123.6) - 408.99;
+  if (t->month == ctx->month && same_bits(ut, ctx->ut) &&
+      same_bits(az_r, ctx->az_r)) {
+    return 0;
+  }
+  ctx->month = t->month;
+  ctx->ut = ut;
+  ctx->az_r = az_r;
+
+  /* Solar declination at the middle of the month. */
+  double doy = 30.5 * t->month - 15;
+  double td = doy + (18 - ut) / 24;
+  double am = (0.9856 * td - 3.289) * D2R;
+  double al = am + (1.916 * sin(am) + 0.020 * sin(2 * am) + 282.634) * D2R;
+  ctx->sin_dec = 0.39782 * sin(al);
+  ctx->cos_dec = sqrt(1 - ctx->sin_dec * ctx->sin_dec);
+
+  /* CCIR maps interpolated in solar activity and evaluated in time. */
+  double w = az_r / 100;
+  double tt = (15 * ut - 180) * D2R;
+  double s[7], co[7];
+  for (u32 k = 1; k <= 6; k++) {
+    s[k] = sin(k * tt);
+    co[k] = cos(k * tt);
+  }
+  const double(*f2)[NEQUICK_F2_COEFFS][NEQUICK_F2_HARMONICS] =
+      ctx->data->f2[t->month - 1];
+  for (u32 j = 0; j < NEQUICK_F2_COEFFS; j++) {
+    double a[NEQUICK_F2_HARMONICS];
+    for (u32 k = 0; k < NEQUICK_F2_HARMONICS; k++) {
+      a[k] = f2[0][j][k] * (1 - w) + f2[1][j][k] * w;
+    }
+    double v = a[0];
+    for (u32 k = 1; k <= 6; k++) {
+      v += a[2 * k - 1] * s[k] + a[2 * k] * co[k];
+    }
+    ctx->cf2[j] = v;
+  }
+  const double(*fm3)[NEQUICK_FM3_COEFFS][NEQUICK_FM3_HARMONICS] =
+      ctx->data->fm3[t->month - 1];
+  for (u32 j = 0; j < NEQUICK_FM3_COEFFS; j++) {
+    double a[NEQUICK_FM3_HARMONICS];
+    for (u32 k = 0; k < NEQUICK_FM3_HARMONICS; k++) {
+      a[k] = fm3[0][j][k] * (1 - w) + fm3[1][j][k] * w;
+    }
+    double v = a[0];
+    for (u32 k = 1; k <= 4; k++) {
+      v += a[2 * k - 1] * s[k] + a[2 * k] * co[k];
+    }
+    ctx->cm3[j] = v;
+  }
+  return 0;
+}
+
+/** Ionospheric profile at a location for the prepared epoch. */
+static void profile_at(const nequick_context_t *ctx,
+                       double lat_deg,
+                       double lon_deg,
+                       nequick_profile_t *p) {
+  double mu = nequick_modip(ctx->data, lat_deg, lon_deg);
+  double lat = lat_deg * D2R;
+  double lon = lon_deg * D2R;
+  double sin_lat = sin(lat);
+  double cos_lat = cos(lat);
+
+  /* Effective solar zenith angle. */
+  double lt = ctx->ut + lon_deg / 15;
+  double cos_chi = sin_lat * ctx->sin_dec +
+                   cos_lat * ctx->cos_dec * cos(M_PI / 12 * (12 - lt));
+  double chi = atan2(sqrt(MAX(1 - cos_chi * cos_chi, 0.0)), cos_chi) * R2D;
+  double chi_eff = join(90 - 0.24 * clip_exp(20 - 0.2 * chi),
+                        chi,
+                        12,
+                        chi - NEQUICK_CHI0_DEG);
+
+  /* E layer critical frequency [MHz]. */
+  double seas = 0;
+  if (ctx->month <= 2 || ctx->month >= 11) {
+    seas = -1;
+  } else if (ctx->month >= 5 && ctx->month <= 8) {
+    seas = 1;
+  }
+  double ee = clip_exp(0.3 * lat_deg);
+  double seasp = seas * (ee - 1) / (ee + 1);
+  double fe = 1.112 - 0.019 * seasp;
+  double fo_e = sqrt(fe * fe * sqrt(ctx->az) *
+                         pow(MAX(cos(chi_eff * D2R), 0.0), 0.6) +
+                     0.49);
+  double nm_e = 0.124 * fo_e * fo_e;
+
+  /* CCIR maps evaluated in space. */
+  double m[12];
+  double sin_mu = sin(mu * D2R);
+  m[0] = 1;
+  for (u32 k = 1; k < 12; k++) {
+    m[k] = m[k - 1] * sin_mu;
+  }
+  double fo_f2 = 0;
+  for (u32 k = 0; k < 12; k++) {
+    fo_f2 += ctx->cf2[k] * m[k];
+  }
+  double m3000 = 0;
+  for (u32 k = 0; k < 7; k++) {
+    m3000 += ctx->cm3[k] * m[k];
+  }
+  double sin_lon = sin(lon);
+  double cos_lon = cos(lon);
+  double pq = 1;
+  double sq = 0;
+  double cq = 1;
+  u32 i_f2 = 12;
+  u32 i_m3 = 7;
+  for (u32 q = 1; q <= 8; q++) {
+    pq *= cos_lat;
+    double sn = sq * cos_lon + cq * sin_lon;
+    cq = cq * cos_lon - sq * sin_lon;
+    sq = sn;
+    double c = cq * pq;
+    double s = sq * pq;
+    for (u32 k = 0; k < f2_terms[q]; k++, i_f2 += 2) {
+      fo_f2 += (ctx->cf2[i_f2] * c + ctx->cf2[i_f2 + 1] * s) * m[k];
+    }
+    if (q < 7) {
+      for (u32 k = 0; k < fm3_terms[q]; k++, i_m3 += 2) {
+        m3000 += (ctx->cm3[i_m3] * c + ctx->cm3[i_m3 + 1] * s) * m[k];
+      }
+    }
+  }
+  assert(NEQUICK_F2_COEFFS == i_f2 && NEQUICK_FM3_COEFFS == i_m3);
+  p->nm_f2 = 0.124 * fo_f2 * fo_f2;
+
+  /* F1 layer. */
+  double fo_f1 = (fo_e >= 2.0) ? 1.4 * fo_e : 0;
+  if (fo_f1 >= 0.85 * fo_f2) {
+    fo_f1 = 0.85 * fo_f2;
+  }
+  if (fo_f1 < 1e-6) {
+    fo_f1 = 0;
+  }
+  double nm_f1 = 0.124 * fo_f1 * fo_f1;
+  if (fo_f1 <= 0 && fo_e > 2.0) {
+    nm_f1 = 0.124 * (fo_e + 0.5) * (fo_e + 0.5);
+  }
+
+  /* Peak heights. */
+  double dm = -0.012;
+  if (fo_e >= 1e-30) {
+    double r = fo_f2 / fo_e;
+    double rho = join(r, 1.75, 20, r - 1.75);
+    dm = 0.253 / (rho - 1.215) - 0.012;
+  }
+  double m2 = m3000 * m3000;
+  p->hm_e = 120;
+  p->hm_f2 = 1490 * m3000 * sqrt((0.0196 * m2 + 1) / (1.2967 * m2 - 1)) /
+                 (m3000 + dm) -
+             176;
+  p->hm_f1 = (p->hm_f2 + p->hm_e) / 2;
+
+  /* Layer thicknesses. */
+  p->b2_bot = 0.385 * p->nm_f2 /
+              (0.01 * exp(-3.467 + 0.857 * log(fo_f2 * fo_f2) +
+                          2.02 * log(m3000)));
+  p->b1_top = 0.3 * (p->hm_f2 - p->hm_f1);
+  p->b1_bot = 0.5 * (p->hm_f1 - p->hm_e);
+  p->be_top = MAX(p->b1_bot, 7.0);
+  p->be_bot = 5;
+
+  /* Epstein amplitudes. */
+  p->a1 = 4 * p->nm_f2;
+  if (fo_f1 < 0.5) {
+    p->a2 = 0;
+    p->a3 = 4 * (nm_e - epstein(p->a1, p->b2_bot, p->hm_f2, p->hm_e));
+  } else {
+    double a2 = 0;
+    double a3 = 4 * nm_e;
+    for (u32 k = 0; k < 5; k++) {
+      a2 = 4 * (nm_f1 - epstein(p->a1, p->b2_bot, p->hm_f2, p->hm_f1) -
+                epstein(a3, p->be_top, p->hm_e, p->hm_f1));
+      a2 = join(a2, 0.8 * nm_f1, 1, a2 - 0.8 * nm_f1);
+      a3 = 4 * (nm_e - epstein(a2, p->b1_bot, p->hm_f1, p->hm_e) -
+                epstein(p->a1, p->b2_bot, p->hm_f2, p->hm_e));
+    }
+    p->a2 = a2;
+    p->a3 = join(a3, 0.05, 60, a3 - 0.005);
+  }
+
+  /* Topside thickness. */
+  double ka;
+  if (ctx->month >= 4 && ctx->month <= 9) {
+    ka = 6.705 - 0.014 * ctx->az_r - 0.008 * p->hm_f2;
+  } else {
+    double r = p->hm_f2 / p->b2_bot;
+    ka = -7.77 + 0.097 * r * r + 0.153 * p->nm_f2;
+  }
+  double kb = join(ka, 2, 1, ka - 2);
+  double k = join(8, kb, 1, kb - 8);
+  p->h0 = k * p->b2_bot;
+}
+
+/** Electron density of a profile [m^-3] at height `h` [km]. */
+static double profile_density(const nequick_profile_t *p, double h) {
+  if (h > p->hm_f2) {
+    const double g = 0.125;
+    const double r = 100;
+    double dh = h - p->hm_f2;
+    double z = dh / (p->h0 * (1 + r * g * dh / (r * p->h0 + g * dh)));
+    double ea = clip_exp(z);
+    double n = (ea > 1e11) ? 4 * p->nm_f2 / ea
+                           : 4 * p->nm_f2 * ea / ((1 + ea) * (1 + ea));
+    return n * NEQUICK_DENSITY_UNIT;
+  }
+
+  double hh = MAX(h, 100.0);
+  double xi = exp(10 / (1 + fabs(hh - p->hm_f2)));
+  double b[3] = {p->b2_bot,
+                 (hh > p->hm_f1) ? p->b1_top : p->b1_bot,
+                 (hh > p->hm_e) ? p->be_top : p->be_bot};
+  double alpha[3] = {(hh - p->hm_f2) / b[0],
+                     (hh - p->hm_f1) / b[1] * xi,
+                     (hh - p->hm_e) / b[2] * xi};
+  double amp[3] = {p->a1, p->a2, p->a3};
+  double sum = 0;
+  double dsum = 0;
+  for (u32 i = 0; i < 3; i++) {
+    if (fabs(alpha[i]) > 25) {
+      continue;
+    }
+    double ee = exp(alpha[i]);
+    double s = amp[i] * ee / ((1 + ee) * (1 + ee));
+    sum += s;
+    dsum += s * (1 - ee) / (b[i] * (1 + ee));
+  }
+  if (h >= 100) {
+    return sum * NEQUICK_DENSITY_UNIT;
+  }
+
+  /* Chapman layer below 100 km joined to the bottomside. */
+  double bc = 1 - 10 * dsum / sum;
+  double z = (h - 100) / 10;
+  return sum * clip_exp(1 - bc * z - clip_exp(-z)) * NEQUICK_DENSITY_UNIT;
+}
+
+/** Electron density.
+ *
+ * \param ctx     Context prepared with nequick_prepare().
+ * \param lat_deg Latitude [deg].
+ * \param lon_deg Longitude [deg].
+ * \param h_km    Height [km].
+ *
+ * \return Electron density [m^-3].
+ */
+double nequick_electron_density(const nequick_context_t *ctx,
+                                double lat_deg,
+                                double lon_deg,
+                                double h_km) {
+  nequick_profile_t p;
+  profile_at(ctx, lat_deg, lon_deg, &p);
+  return profile_density(&p, h_km);
+}
+
+/** Electron density at distance `s` [km] along a ray. */
+static double ray_density(const nequick_ray_t *ray, double s) {
+  if (NULL != ray->vertical) {
+    return profile_density(ray->vertical, s - NEQUICK_RE_KM);
+  }
+  double x[3];
+  for (u32 i = 0; i < 3; i++) {
+    x[i] = ray->p[i] + s * ray->u[i];
+  }
+  double r = sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]);
+  double lat = asin(x[2] / r) * R2D;
+  double lon = atan2(x[1], x[0]) * R2D;
+  nequick_profile_t p;
+  profile_at(ray->ctx, lat, lon, &p);
+  return profile_density(&p, r - NEQUICK_RE_KM);
+}
+
+/** Adaptive Gauss-Kronrod G7/K15 quadrature of the density along a ray.
+ *
+ * An interval is accepted as soon as the two estimates agree to the relative
+ * tolerance, otherwise both halves are integrated separately. Refinement
+ * stops once `budget` evaluations are left for fewer than two more
+ * intervals, so every call terminates.
+ *
+ * \return 0 on success, -1 if the density is not finite.
+ */
+static s8 kronrod(const nequick_ray_t *ray,
+                  double a,
+                  double b,
+                  double tol,
+                  u32 *budget,
+                  double *integral) {
+  static const double xk[8] = {0.991455371120812639,
+                               0.949107912342758525,
+                               0.864864423359769073,
+                               0.741531185599394440,
+                               0.586087235467691130,
+                               0.405845151377397167,
+                               0.207784955007898468,
+                               0.0};
+  static const double wk[8] = {0.022935322010529225,
+                               0.063092092629978553,
+                               0.104790010322250184,
+                               0.140653259715525919,
+                               0.169004726639267903,
+                               0.190350578064785410,
+                               0.204432940075298892,
+                               0.209482141084727828};
+  static const double wg[4] = {0.129484966168869693,
+                               0.279705391489276668,
+                               0.381830050505118945,
+                               0.417959183673469388};
+
+  assert(*budget >= NEQUICK_KRONROD_EVALS);
+  *budget -= NEQUICK_KRONROD_EVALS;
+
+  double c = (a + b) / 2;
+  double h = (b - a) / 2;
+  double fc = ray_density(ray, c);
+  double k15 = wk[7] * fc;
+  double g7 = wg[3] * fc;
+  for (u32 i = 0; i < 7; i++) {
+    double f =
+        ray_density(ray, c - h * xk[i]) + ray_density(ray, c + h * xk[i]);
+    k15 += wk[i] * f;
+    if (i & 1) {
+      g7 += wg[i / 2] * f;
+    }
+  }
+  k15 *= h;
+  g7 *= h;
+
+  if (!isfinite(k15) || !isfinite(g7)) {
+    return -1;
+  }
+  if (fabs(k15 - g7) <= tol * fabs(k15) ||
+      *budget < 2 * NEQUICK_KRONROD_EVALS) {
+    *integral = k15;
+    return 0;
+  }
+
+  /* Keep the evaluations of the right half out of reach of the left. */
+  double left;
+  double right;
+  *budget -= NEQUICK_KRONROD_EVALS;
+  s8 ret = kronrod(ray, a, c, tol, budget, &left);
+  *budget += NEQUICK_KRONROD_EVALS;
+  if (ret < 0 || kronrod(ray, c, b, tol, budget, &right) < 0) {
+    return -1;
+  }
+  *integral = left + right;
+  return 0;
+}
+
+/** Integrate the density along a ray from `a` to `b` with a fresh budget. */
+static s8 integrate(const nequick_ray_t *ray,
+                    double a,
+                    double b,
+                    double tol,
+                    double *integral) {
+  u32 budget = NEQUICK_MAX_EVALS;
+  return kronrod(ray, a, b, tol, &budget, integral);
+}
+
+/** Distance along a ray at which it reaches height `h` [km]. */
+static double ray_distance(const nequick_ray_t *ray, double h) {
+  double r = NEQUICK_RE_KM + h;
+  return sqrt(MAX(r * r - ray->rp * ray->rp, 0.0));
+}
+
+/** Slant total electron content.
+ *
+ * \param ctx         Context prepared with nequick_prepare().
+ * \param sat_lat_rad Satellite latitude [rad].
+ * \param sat_lon_rad Satellite longitude [rad].
+ * \param sat_h       Satellite height [m].
+ * \param stec        Slant total electron content [TECU].
+ *
+ * \return 0 on success, -1 if the satellite is below the horizon or the
+ *         electron density along the ray is not finite.
+ */
+s8 nequick_stec(const nequick_context_t *ctx,
+                double sat_lat_rad,
+                double sat_lon_rad,
+                double sat_h,
+                double *stec) {
+  assert(!isnan(ctx->ut));
+  double r1 = NEQUICK_RE_KM + ctx->rx_h;
+  double r2 = NEQUICK_RE_KM + sat_h / 1000;
+  double rx_lat = ctx->rx_lat * D2R;
+  double rx_lon = ctx->rx_lon * D2R;
+  double x1[3] = {r1 * cos(rx_lat) * cos(rx_lon),
+                  r1 * cos(rx_lat) * sin(rx_lon),
+                  r1 * sin(rx_lat)};
+  double x2[3] = {r2 * cos(sat_lat_rad) * cos(sat_lon_rad),
+                  r2 * cos(sat_lat_rad) * sin(sat_lon_rad),
+                  r2 * sin(sat_lat_rad)};
+
+  nequick_ray_t ray = {.ctx = ctx};
+  double d = 0;
+  for (u32 i = 0; i < 3; i++) {
+    ray.u[i] = x2[i] - x1[i];
+    d += ray.u[i] * ray.u[i];
+  }
+  d = sqrt(d);
+  double s1 = 0;
+  double s2 = 0;
+  for (u32 i = 0; i < 3; i++) {
+    ray.u[i] /= d;
+    s1 += x1[i] * ray.u[i];
+    s2 += x2[i] * ray.u[i];
+  }
+  if (s1 < 0 || !(s2 > s1)) {
+    return -1;
+  }
+  for (u32 i = 0; i < 3; i++) {
+    ray.p[i] = x1[i] - s1 * ray.u[i];
+  }
+  ray.rp = sqrt(ray.p[0] * ray.p[0] + ray.p[1] * ray.p[1] +
+                ray.p[2] * ray.p[2]);
+
+  nequick_profile_t vertical;
+  if (ray.rp < NEQUICK_VERTICAL_RP_KM) {
+    /* Integrate over radius with the profile above the receiver, the
+     * distance from the centre equals the radius when `rp` is zero. */
+    profile_at(ctx, ctx->rx_lat, ctx->rx_lon, &vertical);
+    ray.vertical = &vertical;
+    ray.rp = 0;
+    s1 = r1;
+    s2 = r2;
+  }
+
+  double h2 = sat_h / 1000;
+  double tec[3] = {0, 0, 0};
+  s8 ret;
+  if (h2 <= NEQUICK_H_A_KM) {
+    ret = integrate(&ray, s1, s2, NEQUICK_TOL_LOW, &tec[0]);
+  } else if (ctx->rx_h >= NEQUICK_H_B_KM) {
+    ret = integrate(&ray, s1, s2, NEQUICK_TOL_HIGH, &tec[0]);
+  } else {
+    double sa = MAX(ray_distance(&ray, NEQUICK_H_A_KM), s1);
+    double sb = MAX(ray_distance(&ray, NEQUICK_H_B_KM), sa);
+    sb = MIN(sb, s2);
+    ret = integrate(&ray, s1, sa, NEQUICK_TOL_LOW, &tec[0]);
+    if (ret >= 0) {
+      ret = integrate(&ray, sa, sb, NEQUICK_TOL_HIGH, &tec[1]);
+    }
+    if (ret >= 0) {
+      ret = integrate(&ray, sb, s2, NEQUICK_TOL_HIGH, &tec[2]);
+    }
+  }
+  if (ret < 0) {
+    return -1;
+  }
+  *stec = (tec[0] + tec[1] + tec[2]) * NEQUICK_TECU_PER_KM;
+  return 0;
+}
+
+/** Ionospheric delays of several satellites seen from one receiver.
+ *
+ * Entries with the same satellite position as the previous entry, e.g.
+ * several signals of one satellite, reuse its slant total electron content.
+ *
+ * \param ctx         Context prepared with nequick_prepare().
+ * \param n           Number of entries.
+ * \param sat_lat_rad Satellite latitudes [rad].
+ * \param sat_lon_rad Satellite longitudes [rad].
+ * \param sat_h       Satellite heights [m].
+ * \param sids        Signal of each entry, scaling the delay to its carrier
+ *                    frequency, or NULL for Galileo E1.
+ * \param delay       Ionospheric delays [m], 0 for satellites whose slant
+ *                    total electron content can not be computed.
+ *
+ * \return 0 on success, -1 if the slant total electron content of any
+ *         satellite can not be computed, see nequick_stec().
+ */
+s8 nequick_delay_batch(const nequick_context_t *ctx,
+                       size_t n,
+                       const double *sat_lat_rad,
+                       const double *sat_lon_rad,
+                       const double *sat_h,
+                       const gnss_signal_t *sids,
+                       double *delay) {
+  s8 ret = 0;
+  double stec = 0;
+  s8 valid = -1;
+  for (size_t i = 0; i < n; i++) {
+    if (0 == i || !same_bits(sat_lat_rad[i], sat_lat_rad[i - 1]) ||
+        !same_bits(sat_lon_rad[i], sat_lon_rad[i - 1]) ||
+        !same_bits(sat_h[i], sat_h[i - 1])) {
+      valid =
+          nequick_stec(ctx, sat_lat_rad[i], sat_lon_rad[i], sat_h[i], &stec);
+    }
+    if (valid < 0) {
+      ret = -1;
+      delay[i] = 0;
+      continue;
+    }
+    double f = (NULL == sids) ? GAL_E1_HZ : sid_to_carr_freq(sids[i]);
+    delay[i] = NEQUICK_DELAY_PER_TECU * stec / (f * f);
+  }
+  return ret;
+}
+
+/** \} */
@@ -0,0 +1,830 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include <swiftnav/bitstream.h>
+#include <swiftnav/constants.h>
+#include <swiftnav/edc.h>
+#include <swiftnav/sbas.h>
+
+/** \defgroup sbas SBAS
+ * Decoding of SBAS L1 messages and application of the corrections.
+ *
+ * Supported messages are the PRN mask (type 1), fast corrections (types 2 to
+ * 5 and 24), integrity information (type 6), fast correction degradation
+ * factors (type 7), the ionospheric grid point mask (type 18), long term
+ * corrections (types 24 and 25) and ionospheric delays (type 26). Type 0
+ * marks the corrections as unusable for `SBAS_DO_NOT_USE_TIMEOUT` seconds,
+ * type 63 is ignored.
+ *
+ * References:
+ *   -# RTCA DO-229D, Minimum Operational Performance Standards for Global
+ *      Positioning System/Wide Area Augmentation System Airborne Equipment.
+ * \{ */
+
+/** Number of bits before the data field of a frame. */
+#define SBAS_HEADER_BITS 14
+/** Number of bits covered by the frame CRC. */
+#define SBAS_CRC_BITS (SBAS_HEADER_BITS + SBAS_DATA_BITS)
+/** Number of fast corrections in a type 2 to 5 message. */
+#define SBAS_FAST_BLOCK_SIZE 13
+/** Number of grid point delays in a type 26 message. */
+#define SBAS_IGP_BLOCK_SIZE 15
+/** Grid point delay marking a point that is not monitored. */
+#define SBAS_IGP_DELAY_NOT_MONITORED 0x1FF
+/** Earth radius and ionospheric shell height used for pierce points [m]. */
+#define SBAS_IONO_RE 6378136.3
+#define SBAS_IONO_HI 350000.0
+
+/** Variance of the user differential range error for each UDREI [m^2]. */
+static const double udre_var[16] = {0.0520,
+                                    0.0924,
+                                    0.1444,
+                                    0.2830,
+                                    0.4678,
+                                    0.8315,
+                                    1.2992,
+                                    1.8709,
+                                    2.5465,
+                                    3.3260,
+                                    5.1968,
+                                    20.7870,
+                                    230.9661,
+                                    2078.695,
+                                    NAN,
+                                    NAN};
+
+/** Variance of the grid ionospheric vertical error for each GIVEI [m^2]. */
+static const double give_var[16] = {0.0084,
+                                    0.0333,
+                                    0.0749,
+                                    0.1331,
+                                    0.2079,
+                                    0.2994,
+                                    0.4075,
+                                    0.5322,
+                                    0.6735,
+                                    0.8315,
+                                    1.1974,
+                                    1.8709,
+                                    3.3260,
+                                    20.7870,
+                                    187.0826,
+                                    NAN};
+
+/** Grid point latitudes of the odd columns of bands 0 to 8 [deg]. */
+static const s8 igp_lat_odd[23] = {-55, -50, -45, -40, -35, -30, -25, -20,
+                                   -15, -10, -5,  0,   5,   10,  15,  20,
+                                   25,  30,  35,  40,  45,  50,  55};
+/** Grid point latitudes of the even columns of bands 0 to 8 [deg]. Columns
+ * at 180W, 90W, 0 and 90E add 85N, at 140W, 50W, 40E and 130E 85S. */
+static const s8 igp_lat_even[27] = {-75, -65, -55, -50, -45, -40, -35,
+                                    -30, -25, -20, -15, -10, -5,  0,
+                                    5,   10,  15,  20,  25,  30,  35,
+                                    40,  45,  50,  55,  65,  75};
+
+/** Position of a grid point of a band mask.
+ *
+ * \param band Band number (0 - 10).
+ * \param bit  Mask bit number within the band, starting at 1.
+ * \param lat  Latitude [deg].
+ * \param lon  Longitude [deg].
+ *
+ * \return true if the bit number is valid for the band.
+ */
+static bool igp_position(u8 band, u32 bit, s32 *lat, s32 *lon) {
+  if (band <= 8) {
+    /* Eight columns of 5 degrees, north to south lists of latitudes. */
+    u32 first = 1;
+    for (s32 col = 0; col < 8; col++) {
+      s32 lo = -180 + 40 * band + 5 * col;
+      bool north = (lo % 90) == 0;
+      bool south = ((lo + 140) % 90) == 0;
+      u32 n = (col & 1) ? 23 : ((north || south) ? 28 : 27);
+      if (bit < first + n) {
+        u32 k = bit - first;
+        *lon = lo;
+        if (col & 1) {
+          *lat = igp_lat_odd[k];
+        } else if (south) {
+          *lat = (0 == k) ? -85 : igp_lat_even[k - 1];
+        } else {
+          *lat = (27 == k) ? 85 : igp_lat_even[k];
+        }
+        return true;
+      }
+      first += n;
+    }
+    return false;
+  }
+  if (band <= 10) {
+    /* Rows at 60, 65, 70, 75 and 85 degrees north (band 9) or south. */
+    static const struct {
+      s8 lat;
+      s8 step;
+      u8 n;
+    } rows[5] = {{60, 5, 72}, {65, 10, 36}, {70, 10, 36}, {75, 10, 36},
+                 {85, 30, 12}};
+    u32 first = 1;
+    for (u32 r = 0; r < 5; r++) {
+      if (bit < first + rows[r].n) {
+        s32 offset = (4 == r && 10 == band) ? 10 : 0;
+        *lat = (9 == band) ? rows[r].lat : -rows[r].lat;
+        *lon = -180 + offset + rows[r].step * (s32)(bit - first);
+        return true;
+      }
+      first += rows[r].n;
+    }
+  }
+  return false;
+}
+
+/** Index into the dense grid point array of a point on the 5 degree grid. */
+static u32 igp_index(s32 lat, s32 lon) {
+  s32 col = ((lon + 180) / 5) % SBAS_IGP_COLS;
+  if (col < 0) {
+    col += SBAS_IGP_COLS;
+  }
+  return (u32)((lat + 90) / 5) * SBAS_IGP_COLS + (u32)col;
+}
+
+/** PRN mask bit number of a signal, 0 if it can not be in the mask. */
+static u32 mask_number(gnss_signal_t sid) {
+  constellation_t c = sid_to_constellation(sid);
+  if (CONSTELLATION_GPS == c && sid.sat <= 37) {
+    return sid.sat;
+  }
+  if (CONSTELLATION_GLO == c && sid.sat <= 24) {
+    return 37u + sid.sat;
+  }
+  if (CONSTELLATION_SBAS == c && sid.sat >= 120 && sid.sat <= 138) {
+    return sid.sat;
+  }
+  return 0;
+}
+
+/** Signal of a PRN mask bit number, the satellite is 0 if unsupported. */
+static gnss_signal_t mask_sid(u32 n) {
+  gnss_signal_t sid = {0, CODE_GPS_L1CA};
+  if (n <= 37) {
+    sid.sat = (u16)n;
+  } else if (n <= 61) {
+    sid.sat = (u16)(n - 37);
+    sid.code = CODE_GLO_L1OF;
+  } else if (n >= 120 && n <= 138) {
+    sid.sat = (u16)n;
+    sid.code = CODE_SBAS_L1CA;
+  }
+  return sid;
+}
+
+/** Unsigned field of the data field. Fields never overrun the message. */
+static u32 get_u(const swiftnav_in_bitstream_t *bs, u32 pos, u32 len) {
+  u32 v = 0;
+  bool ok = swiftnav_in_bitstream_getbitu(bs, &v, pos, len);
+  assert(ok);
+  (void)ok;
+  return v;
+}
+
+/** Two's complement field of the data field. */
+static s32 get_s(const swiftnav_in_bitstream_t *bs, u32 pos, u32 len) {
+  s32 v = 0;
+  bool ok = swiftnav_in_bitstream_getbits(bs, &v, pos, len);
+  assert(ok);
+  (void)ok;
+  return v;
+}
+
+/** Initialise a decoder with no corrections.
+ *
+ * \param d      Decoder to initialise.
+ */
+void sbas_decoder_init(sbas_decoder_t *d) {
+  memset(d, 0, sizeof(*d));
+  memset(d->mask_slot, -1, sizeof(d->mask_slot));
+}
+
+/** Type 1: PRN mask. */
+static s8 decode_prn_mask(sbas_decoder_t *d,
+                          const swiftnav_in_bitstream_t *bs) {
+  u8 iodp = (u8)get_u(bs, SBAS_PRN_MASK_BITS, 2);
+  if (d->have_prn_mask && iodp == d->iodp) {
+    return 0;
+  }
+  memset(d->sats, 0, sizeof(d->sats));
+  memset(d->mask_slot, -1, sizeof(d->mask_slot));
+  d->n_sats = 0;
+  for (u32 n = 1; n <= SBAS_PRN_MASK_BITS; n++) {
+    if (0 == get_u(bs, n - 1, 1)) {
+      continue;
+    }
+    if (d->n_sats == SBAS_MAX_MASK_SATS) {
+      break;
+    }
+    d->mask_slot[n] = (s8)d->n_sats;
+    d->sats[d->n_sats].sid = mask_sid(n);
+    d->sats[d->n_sats].udrei = SBAS_UDREI_NOT_MONITORED;
+    d->n_sats++;
+  }
+  d->iodp = iodp;
+  d->have_prn_mask = true;
+  return 0;
+}
+
+/** Store a fast correction of the satellite in slot `i` of the mask. */
+static void set_fast_correction(sbas_decoder_t *d,
+                                u32 i,
+                                double prc,
+                                u8 udrei,
+                                u8 iodf,
+                                const gps_time_t *t) {
+  if (i >= d->n_sats) {
+    return;
+  }
+  sbas_sat_corr_t *s = &d->sats[i];
+  s->rrc = 0;
+  if (s->fast_valid) {
+    double dt = gpsdifftime(t, &s->t_fast);
+    if (dt > 0 && dt <= SBAS_FAST_CORR_TIMEOUT) {
+      s->rrc = (prc - s->prc) / dt;
+    }
+    s->prc_prev = s->prc;
+    s->t_fast_prev = s->t_fast;
+  }
+  s->prc = prc;
+  s->t_fast = *t;
+  s->udrei = udrei;
+  s->iodf = iodf;
+  s->fast_valid = true;
+}
+
+/** Types 2 to 5: fast corrections. */
+static s8 decode_fast(sbas_decoder_t *d,
+                      const swiftnav_in_bitstream_t *bs,
+                      u8 type,
+                      const gps_time_t *t) {
+  u8 iodf = (u8)get_u(bs, 0, 2);
+  if (!d->have_prn_mask || get_u(bs, 2, 2) != d->iodp) {
+    return -1;
+  }
+  for (u32 i = 0; i < SBAS_FAST_BLOCK_SIZE; i++) {
+    double prc = get_s(bs, 4 + 12 * i, 12) * 0.125;
+    u8 udrei = (u8)get_u(bs, 160 + 4 * i, 4);
+    set_fast_correction(
+        d, SBAS_FAST_BLOCK_SIZE * (type - 2u) + i, prc, udrei, iodf, t);
+  }
+  return 0;
+}
+
+/** Type 6: integrity information. */
+static s8 decode_integrity(sbas_decoder_t *d,
+                           const swiftnav_in_bitstream_t *bs) {
+  for (u32 i = 0; i < d->n_sats; i++) {
+    u8 iodf = (u8)get_u(bs, 2 * (i / SBAS_FAST_BLOCK_SIZE), 2);
+    /* IODF 3 is an alert and applies whatever the fast correction IODF. */
+    if (3 == iodf || iodf == d->sats[i].iodf) {
+      d->sats[i].udrei = (u8)get_u(bs, 8 + 4 * i, 4);
+    }
+  }
+  return 0;
+}
+
+/** Type 7: fast correction degradation factors. */
+static s8 decode_degradation(sbas_decoder_t *d,
+                             const swiftnav_in_bitstream_t *bs) {
+  if (!d->have_prn_mask || get_u(bs, 4, 2) != d->iodp) {
+    return -1;
+  }
+  d->tlat = (u8)get_u(bs, 0, 4);
+  for (u32 i = 0; i < d->n_sats; i++) {
+    d->sats[i].ai = (u8)get_u(bs, 8 + 4 * i, 4);
+  }
+  return 0;
+}
+
+/** Tell whether the mask of a band other than `band` includes a grid point.
+ *
+ * Bands 9 and 10 repeat the grid points of bands 0 to 8 at 65, 75 and 85
+ * degrees, which share one entry of the dense grid point array. */
+static bool in_other_band(const sbas_decoder_t *d, u8 band, u16 index) {
+  for (u8 b = 0; b < SBAS_IGP_BANDS; b++) {
+    if (b == band) {
+      continue;
+    }
+    for (u32 j = 0; j < d->band_n_igps[b]; j++) {
+      if (d->band_igps[b][j] == index) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+/** Type 18: ionospheric grid point mask of one band. */
+static s8 decode_igp_mask(sbas_decoder_t *d,
+                          const swiftnav_in_bitstream_t *bs) {
+  u8 n_bands = (u8)get_u(bs, 0, 4);
+  u8 band = (u8)get_u(bs, 4, 4);
+  u8 iodi = (u8)get_u(bs, 8, 2);
+  if (band >= SBAS_IGP_BANDS) {
+    return -1;
+  }
+  d->n_bands = n_bands;
+  if (d->band_n_igps[band] > 0 && d->band_iodi[band] == iodi) {
+    return 0;
+  }
+
+  /* Delays received for the previous mask no longer apply, except at grid
+   * points that another band still includes. */
+  for (u32 j = 0; j < d->band_n_igps[band]; j++) {
+    u16 index = d->band_igps[band][j];
+    if (!in_other_band(d, band, index)) {
+      d->igps[index].valid = false;
+    }
+  }
+  u32 n = 0;
+  for (u32 bit = 1; bit <= SBAS_IGP_BAND_SIZE; bit++) {
+    s32 lat, lon;
+    if (0 == get_u(bs, 9 + bit, 1) || !igp_position(band, bit, &lat, &lon)) {
+      continue;
+    }
+    d->band_igps[band][n++] = (u16)igp_index(lat, lon);
+  }
+  d->band_n_igps[band] = (u8)n;
+  d->band_iodi[band] = iodi;
+  return 0;
+}
+
+/** Type 26: ionospheric delays of one block of a band. */
+static s8 decode_igp_delays(sbas_decoder_t *d,
+                            const swiftnav_in_bitstream_t *bs,
+                            const gps_time_t *t) {
+  u8 band = (u8)get_u(bs, 0, 4);
+  u8 block = (u8)get_u(bs, 4, 4);
+  if (band >= SBAS_IGP_BANDS || 0 == d->band_n_igps[band] ||
+      get_u(bs, 203, 2) != d->band_iodi[band]) {
+    return -1;
+  }
+  for (u32 i = 0; i < SBAS_IGP_BLOCK_SIZE; i++) {
+    u32 j = SBAS_IGP_BLOCK_SIZE * block + i;
+    if (j >= d->band_n_igps[band]) {
+      break;
+    }
+    sbas_igp_t *igp = &d->igps[d->band_igps[band][j]];
+    u32 delay = get_u(bs, 8 + 13 * i, 9);
+    igp->givei = (u8)get_u(bs, 17 + 13 * i, 4);
+    igp->delay = (float)(delay * 0.125);
+    igp->valid = SBAS_IGP_DELAY_NOT_MONITORED != delay &&
+                 SBAS_GIVEI_NOT_MONITORED != igp->givei;
+    igp->t = *t;
+  }
+  return 0;
+}
+
+/** Long term corrections of one satellite without velocity terms. */
+static void decode_long_term_0(sbas_decoder_t *d,
+                               const swiftnav_in_bitstream_t *bs,
+                               u32 p,
+                               const gps_time_t *t) {
+  u32 n = get_u(bs, p, 6);
+  if (0 == n || n > d->n_sats) {
+    return;
+  }
+  sbas_sat_corr_t *s = &d->sats[n - 1];
+  s->iode = (u8)get_u(bs, p + 6, 8);
+  for (u32 k = 0; k < 3; k++) {
+    s->dpos[k] = get_s(bs, p + 14 + 9 * k, 9) * 0.125;
+    s->dvel[k] = 0;
+  }
+  s->daf0 = get_s(bs, p + 41, 10) * C_1_2P31;
+  s->daf1 = 0;
+  s->t_long_term = *t;
+  s->long_term_valid = true;
+}
+
+/** Long term corrections of one satellite with velocity terms. */
+static void decode_long_term_1(sbas_decoder_t *d,
+                               const swiftnav_in_bitstream_t *bs,
+                               u32 p,
+                               const gps_time_t *t) {
+  u32 n = get_u(bs, p, 6);
+  if (0 == n || n > d->n_sats) {
+    return;
+  }
+  sbas_sat_corr_t *s = &d->sats[n - 1];
+  s->iode = (u8)get_u(bs, p + 6, 8);
+  for (u32 k = 0; k < 3; k++) {
+    s->dpos[k] = get_s(bs, p + 14 + 11 * k, 11) * 0.125;
+    s->dvel[k] = get_s(bs, p + 58 + 8 * k, 8) * C_1_2P11;
+  }
+  s->daf0 = get_s(bs, p + 47, 11) * C_1_2P31;
+  s->daf1 = get_s(bs, p + 82, 8) * C_1_2P39;
+
+  /* Time of applicability is a time of day, take the nearest one. */
+  double t0 = get_u(bs, p + 90, 13) * 16.0;
+  double dt = t0 - fmod(t->tow, DAY_SECS);
+  if (dt > DAY_SECS / 2) {
+    dt -= DAY_SECS;
+  } else if (dt < -DAY_SECS / 2) {
+    dt += DAY_SECS;
+  }
+  s->t_long_term = *t;
+  add_secs(&s->t_long_term, dt);
+  s->long_term_valid = true;
+}
+
+/** Half message of long term corrections starting at bit `p`. */
+static s8 decode_long_term_half(sbas_decoder_t *d,
+                                const swiftnav_in_bitstream_t *bs,
+                                u32 p,
+                                const gps_time_t *t) {
+  if (!d->have_prn_mask) {
+    return -1;
+  }
+  if (0 == get_u(bs, p, 1)) {
+    if (get_u(bs, p + 103, 2) != d->iodp) {
+      return -1;
+    }
+    decode_long_term_0(d, bs, p + 1, t);
+    decode_long_term_0(d, bs, p + 52, t);
+  } else {
+    if (get_u(bs, p + 104, 2) != d->iodp) {
+      return -1;
+    }
+    decode_long_term_1(d, bs, p + 1, t);
+  }
+  return 0;
+}
+
+/** Type 24: mixed fast and long term corrections. */
+static s8 decode_mixed(sbas_decoder_t *d,
+                       const swiftnav_in_bitstream_t *bs,
+                       const gps_time_t *t) {
+  if (!d->have_prn_mask || get_u(bs, 96, 2) != d->iodp) {
+    return -1;
+  }
+  u32 block = get_u(bs, 98, 2);
+  u8 iodf = (u8)get_u(bs, 100, 2);
+  for (u32 i = 0; i < 6; i++) {
+    double prc = get_s(bs, 12 * i, 12) * 0.125;
+    u8 udrei = (u8)get_u(bs, 72 + 4 * i, 4);
+    set_fast_correction(
+        d, SBAS_FAST_BLOCK_SIZE * block + i, prc, udrei, iodf, t);
+  }
+  return decode_long_term_half(d, bs, 106, t);
+}
+
+/** Apply the data field of a message. */
+static s8 decode_data(sbas_decoder_t *d,
+                      u8 type,
+                      const swiftnav_in_bitstream_t *bs,
+                      const gps_time_t *t) {
+  if (d->do_not_use &&
+      gpsdifftime(t, &d->t_do_not_use) > SBAS_DO_NOT_USE_TIMEOUT) {
+    d->do_not_use = false;
+  }
+  switch (type) {
+    case 0:
+      d->do_not_use = true;
+      d->t_do_not_use = *t;
+      return 0;
+    case 1:
+      return decode_prn_mask(d, bs);
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return decode_fast(d, bs, type, t);
+    case 6:
+      return decode_integrity(d, bs);
+    case 7:
+      return decode_degradation(d, bs);
+    case 18:
+      return decode_igp_mask(d, bs);
+    case 24:
+      return decode_mixed(d, bs, t);
+    case 25: {
+      s8 ret = decode_long_term_half(d, bs, 0, t);
+      return (decode_long_term_half(d, bs, 106, t) < 0) ? -1 : ret;
+    }
+    case 26:
+      return decode_igp_delays(d, bs, t);
+    case 63:
+      return 0;
+    default:
+      return -1;
+  }
+}
+
+/** Decode a complete SBAS L1 frame.
+ *
+ * \param d      Decoder.
+ * \param frame  Frame of `SBAS_FRAME_BITS` bits starting with the preamble,
+ *               most significant bit first.
+ * \param t      Time of reception.
+ *
+ * \return 0 if the frame was applied, -1 if it failed the CRC or preamble
+ *         check, is of an unsupported type, or refers to a different mask.
+ */
+s8 sbas_decode_frame(sbas_decoder_t *d,
+                     const u8 frame[SBAS_FRAME_BYTES],
+                     const gps_time_t *t) {
+  u32 preamble = getbitu(frame, 0, 8);
+  if (0x53 != preamble && 0x9A != preamble && 0xC6 != preamble) {
+    return -1;
+  }
+  if (crc24q_bits(0, frame, SBAS_CRC_BITS, false) !=
+      getbitu(frame, SBAS_CRC_BITS, 24)) {
+    return -1;
+  }
+  swiftnav_in_bitstream_t bs;
+  swiftnav_in_bitstream_init(&bs, frame, SBAS_CRC_BITS);
+  swiftnav_in_bitstream_remove(&bs, SBAS_HEADER_BITS);
+  return decode_data(d, (u8)getbitu(frame, 8, 6), &bs, t);
+}
+
+/** Decode a message already checked by the receiver.
+ *
+ * \param d      Decoder.
+ * \param raw    Message type and data field.
+ *
+ * \return 0 if the message was applied, -1 if it is of an unsupported type
+ *         or refers to a different mask.
+ */
+s8 sbas_decode_raw(sbas_decoder_t *d, const sbas_raw_data_t *raw) {
+  swiftnav_in_bitstream_t bs;
+  swiftnav_in_bitstream_init(&bs, raw->data, SBAS_DATA_BITS);
+  return decode_data(d, raw->message_type, &bs, &raw->time_of_transmission);
+}
+
+/** Tell whether a type 0 message suspends the corrections at a time. */
+static bool suspended(const sbas_decoder_t *d, const gps_time_t *t) {
+  return d->do_not_use &&
+         fabs(gpsdifftime(t, &d->t_do_not_use)) <= SBAS_DO_NOT_USE_TIMEOUT;
+}
+
+/** Fast correction of a satellite.
+ *
+ * The correction is added to the measured pseudorange.
+ *
+ * \param d      Decoder.
+ * \param sid    Signal.
+ * \param t      Time of the measurement.
+ * \param prc    Pseudorange correction extrapolated to `t` [m].
+ * \param var    Variance of the user differential range error [m^2],
+ *               without degradation terms.
+ *
+ * \return 0 on success, -1 if no usable correction is available.
+ */
+s8 sbas_fast_correction(const sbas_decoder_t *d,
+                        gnss_signal_t sid,
+                        const gps_time_t *t,
+                        double *prc,
+                        double *var) {
+  s8 slot = d->mask_slot[mask_number(sid)];
+  if (slot < 0 || suspended(d, t)) {
+    return -1;
+  }
+  const sbas_sat_corr_t *s = &d->sats[slot];
+  double dt = gpsdifftime(t, &s->t_fast);
+  if (!s->fast_valid || s->udrei >= SBAS_UDREI_NOT_MONITORED ||
+      fabs(dt) > SBAS_FAST_CORR_TIMEOUT) {
+    return -1;
+  }
+  *prc = s->prc + s->rrc * dt;
+  *var = udre_var[s->udrei];
+  return 0;
+}
+
+/** Long term correction of a satellite.
+ *
+ * The corrections are added to the satellite position and clock computed
+ * from the broadcast ephemeris.
+ *
+ * \param d      Decoder.
+ * \param sid    Signal.
+ * \param iode   Issue of data of the ephemeris in use.
+ * \param t      Time of the measurement.
+ * \param dpos   Satellite position correction, ECEF [m].
+ * \param dclk   Satellite clock correction [s].
+ *
+ * \return 0 on success, -1 if no correction for the ephemeris is available.
+ */
+s8 sbas_long_term_correction(const sbas_decoder_t *d,
+                             gnss_signal_t sid,
+                             u8 iode,
+                             const gps_time_t *t,
+                             double dpos[3],
+                             double *dclk) {
+  s8 slot = d->mask_slot[mask_number(sid)];
+  if (slot < 0 || suspended(d, t)) {
+    return -1;
+  }
+  const sbas_sat_corr_t *s = &d->sats[slot];
+  double dt = gpsdifftime(t, &s->t_long_term);
+  if (!s->long_term_valid || s->iode != iode ||
+      fabs(dt) > SBAS_LONG_TERM_TIMEOUT) {
+    return -1;
+  }
+  for (u32 k = 0; k < 3; k++) {
+    dpos[k] = s->dpos[k] + s->dvel[k] * dt;
+  }
+  *dclk = s->daf0 + s->daf1 * dt;
+  return 0;
+}
+
+/** Usable grid point at a position on the 5 degree grid, or NULL. */
+static const sbas_igp_t *usable_igp(const sbas_decoder_t *d,
+                                    const gps_time_t *t,
+                                    s32 lat,
+                                    s32 lon) {
+  if (lat < -90 || lat > 90) {
+    return NULL;
+  }
+  const sbas_igp_t *igp = &d->igps[igp_index(lat, lon)];
+  if (!igp->valid || fabs(gpsdifftime(t, &igp->t)) > SBAS_IONO_TIMEOUT) {
+    return NULL;
+  }
+  return igp;
+}
+
+/** Vertical delay and its variance at a corner of an interpolation cell.
+ *
+ * Grid points at 85 degrees are 90 degrees apart, so as in DO-229 the corner
+ * of a 10 degree cell at 85 degrees is a virtual point, interpolated
+ * linearly in longitude between the two grid points either side of it.
+ *
+ * \return true if the grid points needed are usable.
+ */
+static bool iono_corner(const sbas_decoder_t *d,
+                        const gps_time_t *t,
+                        s32 lat,
+                        s32 lon,
+                        double *delay,
+                        double *var) {
+  s32 west = lon;
+  if (85 == lat || -85 == lat) {
+    /* 85N points are at 180W, 90W, 0 and 90E, the 85S ones 40 degrees east
+     * of those. */
+    const s32 offset = (85 == lat) ? 0 : 40;
+    west = (s32)floor((lon - offset) / 90.0) * 90 + offset;
+  }
+  const sbas_igp_t *w = usable_igp(d, t, lat, west);
+  const sbas_igp_t *e = (lon == west) ? w : usable_igp(d, t, lat, west + 90);
+  if (NULL == w || NULL == e) {
+    return false;
+  }
+  const double f = (lon - west) / 90.0;
+  *delay = (1 - f) * w->delay + f * e->delay;
+  *var = (1 - f) * give_var[w->givei] + f * give_var[e->givei];
+  return true;
+}
+
+/** Vertical ionospheric delay at a pierce point.
+ *
+ * The pierce point is interpolated from the surrounding grid points: a 5
+ * degree cell between 55S and 55N and a 10 degree cell up to 85 degrees.
+ * Between 75 and 85 degrees the corners at 85 degrees are interpolated in
+ * longitude from the grid points there, which are 90 degrees apart. Pierce
+ * points closer to the poles are not covered. If one of the four corners is
+ * missing the remaining three are used when the pierce point lies inside
+ * their triangle.
+ *
+ * \param d       Decoder.
+ * \param t       Time of the measurement.
+ * \param lat_rad Pierce point latitude [rad].
+ * \param lon_rad Pierce point longitude [rad].
+ * \param delay   Vertical delay at L1 [m].
+ * \param var     Variance of the vertical delay [m^2].
+ *
+ * \return 0 on success, -1 if not enough grid points are available.
+ */
+s8 sbas_iono_vertical_delay(const sbas_decoder_t *d,
+                            const gps_time_t *t,
+                            double lat_rad,
+                            double lon_rad,
+                            double *delay,
+                            double *var) {
+  double lat = lat_rad * R2D;
+  double lon = fmod(lon_rad * R2D + 180, 360);
+  lon = ((lon < 0) ? lon + 360 : lon) - 180;
+
+  /* Corners (lat0, lon0), (lat1, lon0), (lat0, lon1), (lat1, lon1) and the
+   * position within the cell. */
+  s32 lat0, lon0, step;
+  if (lat >= -55 && lat < 55) {
+    step = 5;
+    lat0 = (s32)floor(lat / 5) * 5;
+  } else {
+    step = 10;
+    lat0 = (s32)floor((lat - 5) / 10) * 10 + 5;
+  }
+  lon0 = (s32)floor(lon / step) * step;
+  const s32 lat1 = lat0 + step;
+  const s32 lon1 = lon0 + step;
+  const double x = (lon - lon0) / step;
+  const double y = (lat - lat0) / step;
+
+  double c_delay[4], c_var[4];
+  const bool ok[4] = {
+      iono_corner(d, t, lat0, lon0, &c_delay[0], &c_var[0]),
+      iono_corner(d, t, lat1, lon0, &c_delay[1], &c_var[1]),
+      iono_corner(d, t, lat0, lon1, &c_delay[2], &c_var[2]),
+      iono_corner(d, t, lat1, lon1, &c_delay[3], &c_var[3])};
+
+  double w[4] = {0, 0, 0, 0};
+  if (ok[0] && ok[1] && ok[2] && ok[3]) {
+    w[0] = (1 - x) * (1 - y);
+    w[1] = (1 - x) * y;
+    w[2] = x * (1 - y);
+    w[3] = x * y;
+  } else if (ok[0] && ok[1] && ok[2]) {
+    w[1] = y;
+    w[2] = x;
+    w[0] = 1 - x - y;
+  } else if (ok[0] && ok[2] && ok[3]) {
+    w[0] = 1 - x;
+    w[3] = y;
+    w[2] = x - y;
+  } else if (ok[0] && ok[1] && ok[3]) {
+    w[0] = 1 - y;
+    w[3] = x;
+    w[1] = y - x;
+  } else if (ok[1] && ok[2] && ok[3]) {
+    w[1] = 1 - x;
+    w[2] = 1 - y;
+    w[3] = x + y - 1;
+  } else {
+    return -1;
+  }
+  if (w[0] < 0 || w[1] < 0 || w[2] < 0 || w[3] < 0) {
+    return -1;
+  }
+
+  *delay = 0;
+  *var = 0;
+  for (u32 i = 0; i < 4; i++) {
+    if (ok[i]) {
+      *delay += w[i] * c_delay[i];
+      *var += w[i] * c_var[i];
+    }
+  }
+  return 0;
+}
+
+/** Slant ionospheric delay.
+ *
+ * \param d       Decoder.
+ * \param t       Time of the measurement.
+ * \param lat_rad Receiver latitude [rad].
+ * \param lon_rad Receiver longitude [rad].
+ * \param az      Satellite azimuth [rad].
+ * \param el      Satellite elevation [rad].
+ * \param delay   Slant delay at L1 [m].
+ * \param var     Variance of the slant delay [m^2].
+ *
+ * \return 0 on success, -1 if not enough grid points are available.
+ */
+s8 sbas_iono_delay(const sbas_decoder_t *d,
+                   const gps_time_t *t,
+                   double lat_rad,
+                   double lon_rad,
+                   double az,
+                   double el,
+                   double *delay,
+                   double *var) {
+  double k = SBAS_IONO_RE / (SBAS_IONO_RE + SBAS_IONO_HI) * cos(el);
+  double psi = M_PI / 2 - el - asin(k);
+  double lat_pp =
+      asin(sin(lat_rad) * cos(psi) + cos(lat_rad) * sin(psi) * cos(az));
+  double dlon = asin(sin(psi) * sin(az) / cos(lat_pp));
+  if ((lat_rad > 70 * D2R && tan(psi) * cos(az) > tan(M_PI / 2 - lat_rad)) ||
+      (lat_rad < -70 * D2R &&
+       tan(psi) * cos(az + M_PI) > tan(M_PI / 2 + lat_rad))) {
+    dlon = M_PI - dlon;
+  }
+
+  double vdelay, vvar;
+  if (sbas_iono_vertical_delay(
+          d, t, lat_pp, lon_rad + dlon, &vdelay, &vvar) < 0) {
+    return -1;
+  }
+  double f2 = 1 / (1 - k * k);
+  *delay = sqrt(f2) * vdelay;
+  *var = f2 * vvar;
+  return 0;
+}
+
+/** \} */
@@ -260,4 +260,26 @@ u32 insert_element(
   return index;
 }
 
+/** Size ratio above which an intersection gallops through the larger set
+ * instead of merging. */
+#define SET_GALLOP_RATIO 8
+
+#define SET_NAME sid
+#define SET_TYPE gnss_signal_t
+#define SET_KEY_TYPE u32
+#define SET_KEY(x) sid_hash(x)
+#include "set_typed.inc"
+
+#define SET_NAME s32
+#define SET_TYPE s32
+#define SET_KEY_TYPE s32
+#define SET_KEY(x) (x)
+#include "set_typed.inc"
+
+#define SET_NAME u16
+#define SET_TYPE u16
+#define SET_KEY_TYPE u16
+#define SET_KEY(x) (x)
+#include "set_typed.inc"
+
 /** \} */
@@ -15,6 +15,30 @@
 #include <swiftnav/bits.h>
 #include <swiftnav/sid_set.h>
 
+/** Number of set bits in a word. */
+static inline u32 popcount_u64(u64 v) {
+#if defined(__GNUC__) || defined(__clang__)
+  return (u32)__builtin_popcountll(v);
+#else
+  return count_bits_u64(v, 1);
+#endif
+}
+
+/** Index of the lowest set bit of a non zero word. */
+static inline u32 ctz_u64(u64 v) {
+  assert(v != 0);
+#if defined(__GNUC__) || defined(__clang__)
+  return (u32)__builtin_ctzll(v);
+#else
+  u32 n = 0;
+  while (!(v & 1)) {
+    v >>= 1;
+    n++;
+  }
+  return n;
+#endif
+}
+
 /** Initialize new sid set
  *
  * \param sid_set gnss_sid_set_t to be initialized
@@ -57,15 +81,12 @@ void sid_set_remove(gnss_sid_set_t *sid_set, gnss_signal_t sid) {
  */
 u32 sid_set_get_sat_count(const gnss_sid_set_t *sid_set) {
   u64 sats[CONSTELLATION_COUNT];
-  memset(sats, 0, sizeof(sats));
-  for (code_t code = 0; code < CODE_COUNT; code++) {
-    sats[code_to_constellation(code)] |= sid_set->sats[code];
-  }
+  sid_set_get_sats(sid_set, sats);
 
   u32 cnt = 0;
   for (constellation_t constellation = 0; constellation < CONSTELLATION_COUNT;
        constellation++) {
-    cnt += count_bits_u64(sats[constellation], 1);
+    cnt += popcount_u64(sats[constellation]);
   }
 
   return cnt;
@@ -81,7 +102,7 @@ u32 sid_set_get_sat_count(const gnss_sid_set_t *sid_set) {
 u32 sid_set_get_sig_count(const gnss_sid_set_t *sid_set) {
   u32 cnt = 0;
   for (code_t code = 0; code < CODE_COUNT; code++) {
-    cnt += count_bits_u64(sid_set->sats[code], 1);
+    cnt += popcount_u64(sid_set->sats[code]);
   }
 
   return cnt;
@@ -100,3 +121,156 @@ bool sid_set_contains(const gnss_sid_set_t *sid_set, gnss_signal_t sid) {
   assert(s < 64);
   return sid_set->sats[sid.code] & ((u64)0x01 << s);
 }
+
+/** Union of two sid sets
+ *
+ * \param result gnss_sid_set_t to write the union to, may alias a or b
+ * \param a first sid set
+ * \param b second sid set
+ *
+ */
+void sid_set_union(gnss_sid_set_t *result,
+                   const gnss_sid_set_t *a,
+                   const gnss_sid_set_t *b) {
+  for (u32 code = 0; code < CODE_COUNT; code++) {
+    result->sats[code] = a->sats[code] | b->sats[code];
+  }
+}
+
+/** Intersection of two sid sets
+ *
+ * \param result gnss_sid_set_t to write the intersection to, may alias a or b
+ * \param a first sid set
+ * \param b second sid set
+ *
+ */
+void sid_set_intersection(gnss_sid_set_t *result,
+                          const gnss_sid_set_t *a,
+                          const gnss_sid_set_t *b) {
+  for (u32 code = 0; code < CODE_COUNT; code++) {
+    result->sats[code] = a->sats[code] & b->sats[code];
+  }
+}
+
+/** Difference of two sid sets, the elements of a which are not in b
+ *
+ * \param result gnss_sid_set_t to write the difference to, may alias a or b
+ * \param a sid set to remove elements from
+ * \param b sid set of elements to remove
+ *
+ */
+void sid_set_difference(gnss_sid_set_t *result,
+                        const gnss_sid_set_t *a,
+                        const gnss_sid_set_t *b) {
+  for (u32 code = 0; code < CODE_COUNT; code++) {
+    result->sats[code] = a->sats[code] & ~b->sats[code];
+  }
+}
+
+/** Is every element of a sid set also in another
+ *
+ * \param a candidate subset
+ * \param b candidate superset
+ *
+ * \returns True if all elements of a are in b
+ *
+ */
+bool sid_set_is_subset(const gnss_sid_set_t *a, const gnss_sid_set_t *b) {
+  u64 extra = 0;
+  for (u32 code = 0; code < CODE_COUNT; code++) {
+    extra |= a->sats[code] & ~b->sats[code];
+  }
+  return extra == 0;
+}
+
+/** Is a sid set empty
+ *
+ * \param sid_set gnss_sid_set_t to check
+ *
+ * \returns True if sid_set has no elements
+ *
+ */
+bool sid_set_is_empty(const gnss_sid_set_t *sid_set) {
+  u64 any = 0;
+  for (u32 code = 0; code < CODE_COUNT; code++) {
+    any |= sid_set->sats[code];
+  }
+  return any == 0;
+}
+
+/** Project a sid set onto satellites
+ *
+ * Bit n of the word of a constellation is set if any signal of the
+ * constellation with code index n is in the set.
+ *
+ * \param sid_set gnss_sid_set_t to project
+ * \param sats satellites present in the set, per constellation
+ *
+ */
+void sid_set_get_sats(const gnss_sid_set_t *sid_set,
+                      u64 sats[CONSTELLATION_COUNT]) {
+  memset(sats, 0, CONSTELLATION_COUNT * sizeof(sats[0]));
+  for (code_t code = 0; code < CODE_COUNT; code++) {
+    sats[code_to_constellation(code)] |= sid_set->sats[code];
+  }
+}
+
+/** Does a sid set contain any signal of the satellite of a given sid
+ *
+ * \param sid_set gnss_sid_set_t to search from
+ * \param sid A signal of the satellite to search for
+ *
+ * \returns True if a signal of the satellite is in sid_set, that is if
+ *          adding sid would not change `sid_set_get_sat_count()`
+ *
+ */
+bool sid_set_contains_sat(const gnss_sid_set_t *sid_set, gnss_signal_t sid) {
+  u16 s = sid_to_code_index(sid);
+  assert(s < 64);
+  constellation_t constellation = sid_to_constellation(sid);
+  u64 sat = 0;
+  for (code_t code = 0; code < CODE_COUNT; code++) {
+    if (code_to_constellation(code) == constellation) {
+      sat |= sid_set->sats[code];
+    }
+  }
+  return sat & ((u64)0x01 << s);
+}
+
+/** Start iterating over the members of a sid set
+ *
+ * Members are visited in order of code, then satellite. The set must not
+ * change while it is iterated over.
+ *
+ * \param iter iterator to initialize
+ * \param sid_set gnss_sid_set_t to iterate over
+ *
+ */
+void sid_set_iter_init(sid_set_iter_t *iter, const gnss_sid_set_t *sid_set) {
+  iter->sid_set = sid_set;
+  iter->code = 0;
+  iter->remaining = sid_set->sats[0];
+}
+
+/** Get the next member of a sid set
+ *
+ * \param iter iterator initialized by `sid_set_iter_init()`
+ * \param sid the next member, only written if there is one
+ *
+ * \returns False once all members have been visited
+ *
+ */
+bool sid_set_iter_next(sid_set_iter_t *iter, gnss_signal_t *sid) {
+  while (iter->remaining == 0) {
+    if (iter->code + 1 >= CODE_COUNT) {
+      iter->code = CODE_COUNT;
+      return false;
+    }
+    iter->code++;
+    iter->remaining = iter->sid_set->sats[iter->code];
+  }
+  u32 s = ctz_u64(iter->remaining);
+  iter->remaining &= iter->remaining - 1;
+  *sid = sid_from_code_index((code_t)iter->code, (u16)s);
+  return true;
+}
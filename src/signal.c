@@ -10,13 +10,22 @@
  * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
  */
 
+/* The library always provides the asserting, out of line, versions of the
+ * lookups signal.h otherwise inlines. */
+#ifndef LIBSWIFTNAV_CHECKED_SIGNAL_LOOKUP
+#define LIBSWIFTNAV_CHECKED_SIGNAL_LOOKUP
+#endif
+
 #include <assert.h>
 #include <string.h>
 #include <swiftnav/array_tools.h>
 #include <swiftnav/constants.h>
 #include <swiftnav/glo_map.h>
+#include <swiftnav/macros.h>
 #include <swiftnav/signal.h>
 
+#include "signal_hash.inc"
+
 /** \defgroup signal GNSS signal identifiers (SID)
  * \{ */
 
@@ -37,854 +46,10 @@ typedef struct { /* NOLINT(clang-analyzer-optin.performance.Padding) */
   bool requires_data_decoder;
 } code_table_element_t;
 
-/** Table of useful data for each code.
- *  [1] RINEX3.03 Table A23
- *      "Reference code and phase alignment by constellation and frequency band"
- */
+/** Table of useful data for each code, see code_table.h. */
 static const code_table_element_t code_table[CODE_COUNT + 1] = {
-    /** GPS */
-    [CODE_GPS_L1CA] = {CONSTELLATION_GPS,
-                       NUM_SATS_GPS,
-                       NUM_SIGNALS_GPS_L1CA,
-                       GPS_FIRST_PRN,
-                       "GPS L1CA",
-                       GPS_L1_HZ,
-                       GPS_L1CA_CHIPS_NUM,
-                       GPS_CA_CHIPPING_RATE,
-                       true,
-                       GPS_L1CA_PRN_PERIOD_MS,
-                       GPS_L1_DOPPLER_MAX_HZ,
-                       0.f, /* reference signal (see L1C in [1]) */
-                       true},
-    [CODE_AUX_GPS] = {CONSTELLATION_GPS,
-                      NUM_SATS_GPS,
-                      NUM_SIGNALS_GPS_L1CA,
-                      GPS_FIRST_PRN,
-                      "GPS AUX",
-                      GPS_L1_HZ,
-                      GPS_L1CA_CHIPS_NUM,
-                      GPS_CA_CHIPPING_RATE,
-                      false,
-                      GPS_L1CA_PRN_PERIOD_MS,
-                      GPS_L1_DOPPLER_MAX_HZ,
-                      0.f, /* assuming CODE_GPS_L1CA */
-                      false},
-    [CODE_GPS_L1CI] = {CONSTELLATION_GPS,
-                       NUM_SATS_GPS,
-                       NUM_SIGNALS_GPS_L1C,
-                       GPS_FIRST_PRN,
-                       "GPS L1CI",
-                       GPS_L1_HZ,
-                       GPS_L1C_CHIPS_NUM,
-                       GPS_CA_CHIPPING_RATE,
-                       false,
-                       GPS_L1C_PRN_PERIOD_MS,
-                       GPS_L1_DOPPLER_MAX_HZ,
-                       0.25f, /* see L1S in [1] */
-                       false},
-    [CODE_GPS_L1CQ] = {CONSTELLATION_GPS,
-                       NUM_SATS_GPS,
-                       NUM_SIGNALS_GPS_L1C,
-                       GPS_FIRST_PRN,
-                       "GPS L1CQ",
-                       GPS_L1_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       GPS_L1_DOPPLER_MAX_HZ,
-                       0.25f, /* see L1L in [1] */
-                       false},
-    [CODE_GPS_L1CX] = {CONSTELLATION_GPS,
-                       NUM_SATS_GPS,
-                       NUM_SIGNALS_GPS_L1C,
-                       GPS_FIRST_PRN,
-                       "GPS L1C",
-                       GPS_L1_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       GPS_L1_DOPPLER_MAX_HZ,
-                       0.25f, /* see L1X in [1] */
-                       false},
-    [CODE_GPS_L2CM] = {CONSTELLATION_GPS,
-                       NUM_SATS_GPS,
-                       NUM_SIGNALS_GPS_L2C,
-                       GPS_FIRST_PRN,
-                       "GPS L2CM",
-                       GPS_L2_HZ,
-                       GPS_L2CM_CHIPS_NUM,
-                       GPS_CA_CHIPPING_RATE,
-                       false,
-                       GPS_L2CM_PRN_PERIOD_MS,
-                       (float)GPS_L2_DOPPLER_MAX_HZ,
-                       -0.25f, /* see L2S in [1] */
-                       true},
-    [CODE_GPS_L2CL] = {CONSTELLATION_GPS,
-                       NUM_SATS_GPS,
-                       NUM_SIGNALS_GPS_L2C,
-                       GPS_FIRST_PRN,
-                       "GPS L2CL",
-                       GPS_L2_HZ,
-                       GPS_L2CL_CHIPS_NUM,
-                       GPS_CA_CHIPPING_RATE,
-                       false,
-                       GPS_L2CL_PRN_PERIOD_MS,
-                       (float)GPS_L2_DOPPLER_MAX_HZ,
-                       -0.25f, /* see L2L in [1] */
-                       false},
-    [CODE_GPS_L2CX] = {CONSTELLATION_GPS,
-                       NUM_SATS_GPS,
-                       NUM_SIGNALS_GPS_L2C,
-                       GPS_FIRST_PRN,
-                       "GPS L2C",
-                       GPS_L2_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       (float)GPS_L2_DOPPLER_MAX_HZ,
-                       -0.25f, /* see L2X [1] */
-                       false},
-    [CODE_GPS_L5I] = {CONSTELLATION_GPS,
-                      NUM_SATS_GPS,
-                      NUM_SIGNALS_GPS_L5,
-                      GPS_FIRST_PRN,
-                      "GPS L5I",
-                      GPS_L5_HZ,
-                      GPS_L5_CHIPS_NUM,
-                      GPS_L5_CHIPPING_RATE,
-                      false,
-                      GPS_L5_PRN_PERIOD_MS,
-                      (float)GPS_L5_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L5I in [1]) */
-                      false},
-    [CODE_GPS_L5Q] = {CONSTELLATION_GPS,
-                      NUM_SATS_GPS,
-                      NUM_SIGNALS_GPS_L5,
-                      GPS_FIRST_PRN,
-                      "GPS L5Q",
-                      GPS_L5_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GPS_L5_DOPPLER_MAX_HZ,
-                      -0.25f, /* see L5Q in [1] */
-                      false},
-    [CODE_GPS_L5X] = {CONSTELLATION_GPS,
-                      NUM_SATS_GPS,
-                      NUM_SIGNALS_GPS_L5,
-                      GPS_FIRST_PRN,
-                      "GPS L5",
-                      GPS_L5_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GPS_L5_DOPPLER_MAX_HZ,
-                      0.f, /* must be aligned to CODE_GPS_L5I (see L5X in [1])*/
-                      false},
-    [CODE_GPS_L1P] = {CONSTELLATION_GPS,
-                      NUM_SATS_GPS,
-                      NUM_SIGNALS_GPS_L1P,
-                      GPS_FIRST_PRN,
-                      "GPS L1P",
-                      GPS_L1_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      GPS_L1_DOPPLER_MAX_HZ,
-                      0.25f, /* see L1P in [1] */
-                      false},
-    [CODE_GPS_L2P] = {CONSTELLATION_GPS,
-                      NUM_SATS_GPS,
-                      NUM_SIGNALS_GPS_L2P,
-                      GPS_FIRST_PRN,
-                      "GPS L2P",
-                      GPS_L2_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GPS_L2_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L2P in [1]) */
-                      false},
-
-    /** SBAS */
-    [CODE_SBAS_L1CA] = {CONSTELLATION_SBAS,
-                        NUM_SATS_SBAS,
-                        NUM_SIGNALS_SBAS_L1CA,
-                        SBAS_FIRST_PRN,
-                        "SBAS L1",
-                        SBAS_L1_HZ,
-                        SBAS_L1CA_CHIPS_NUM,
-                        SBAS_L1CA_CHIPPING_RATE,
-                        true,
-                        SBAS_L1CA_PRN_PERIOD_MS,
-                        SBAS_L1_DOPPLER_MAX_HZ,
-                        0.f, /* reference signal */
-                        true},
-    [CODE_AUX_SBAS] = {CONSTELLATION_SBAS,
-                       NUM_SATS_SBAS,
-                       NUM_SIGNALS_SBAS_L1CA,
-                       SBAS_FIRST_PRN,
-                       "SBAS AUX",
-                       SBAS_L1_HZ,
-                       SBAS_L1CA_CHIPS_NUM,
-                       SBAS_L1CA_CHIPPING_RATE,
-                       false,
-                       SBAS_L1CA_PRN_PERIOD_MS,
-                       SBAS_L1_DOPPLER_MAX_HZ,
-                       0.f, /* not used */
-                       false},
-    [CODE_SBAS_L5I] = {CONSTELLATION_SBAS,
-                       NUM_SATS_SBAS,
-                       NUM_SIGNALS_SBAS_L5,
-                       SBAS_FIRST_PRN,
-                       "SBAS L5I",
-                       SBAS_L5_HZ,
-                       SBAS_L5_CHIPS_NUM,
-                       SBAS_L5_CHIPPING_RATE,
-                       false,
-                       SBAS_L5_PRN_PERIOD_MS,
-                       (float)SBAS_L5_DOPPLER_MAX_HZ,
-                       0.f, /* reference signal */
-                       true},
-    [CODE_SBAS_L5Q] = {CONSTELLATION_SBAS,
-                       NUM_SATS_SBAS,
-                       NUM_SIGNALS_SBAS_L5,
-                       SBAS_FIRST_PRN,
-                       "SBAS L5Q",
-                       SBAS_L5_HZ,
-                       SBAS_L5_CHIPS_NUM,
-                       SBAS_L5_CHIPPING_RATE,
-                       false,
-                       SBAS_L5_PRN_PERIOD_MS,
-                       (float)SBAS_L5_DOPPLER_MAX_HZ,
-                       -0.25f, /* not used */
-                       false},
-    [CODE_SBAS_L5X] = {CONSTELLATION_SBAS,
-                       NUM_SATS_SBAS,
-                       NUM_SIGNALS_SBAS_L5,
-                       SBAS_FIRST_PRN,
-                       "SBAS L5",
-                       SBAS_L5_HZ,
-                       SBAS_L5_CHIPS_NUM,
-                       SBAS_L5_CHIPPING_RATE,
-                       false,
-                       SBAS_L5_PRN_PERIOD_MS,
-                       (float)SBAS_L5_DOPPLER_MAX_HZ,
-                       0.f, /* must be aligned with CODE_SBAS_L5I */
-                       false},
-
-    /** Glonass  */
-    [CODE_GLO_L1OF] = {CONSTELLATION_GLO,
-                       NUM_SATS_GLO,
-                       NUM_FREQ_GLO_L1OF,
-                       GLO_FIRST_PRN,
-                       "GLO L1OF",
-                       GLO_L1_HZ,
-                       GLO_CA_CHIPS_NUM,
-                       GLO_CA_CHIPPING_RATE,
-                       true,
-                       GLO_PRN_PERIOD_MS,
-                       GLO_L1_DOPPLER_MAX_HZ,
-                       0.f, /* reference signal (see L1C in [1]) */
-                       true},
-    [CODE_GLO_L2OF] = {CONSTELLATION_GLO,
-                       NUM_SATS_GLO,
-                       NUM_FREQ_GLO_L2OF,
-                       GLO_FIRST_PRN,
-                       "GLO L2OF",
-                       GLO_L2_HZ,
-                       GLO_CA_CHIPS_NUM,
-                       GLO_CA_CHIPPING_RATE,
-                       false,
-                       GLO_PRN_PERIOD_MS,
-                       (float)GLO_L2_DOPPLER_MAX_HZ,
-                       0.f, /* reference signal (see L2C in [1]) */
-                       true},
-    [CODE_GLO_L1P] = {CONSTELLATION_GLO,
-                      NUM_SATS_GLO,
-                      NUM_FREQ_GLO_L1OF,
-                      GLO_FIRST_PRN,
-                      "GLO L1P",
-                      GLO_L1_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      GLO_L1_DOPPLER_MAX_HZ,
-                      0.25f, /* see L1P in [1] */
-                      false},
-    [CODE_GLO_L2P] = {CONSTELLATION_GLO,
-                      NUM_SATS_GLO,
-                      NUM_FREQ_GLO_L2OF,
-                      GLO_FIRST_PRN,
-                      "GLO L2P",
-                      GLO_L2_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GLO_L2_DOPPLER_MAX_HZ,
-                      0.25f, /* see L2P in [1] */
-                      false},
-
-    /** Galileo  */
-    [CODE_GAL_E1B] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E1,
-                      GAL_FIRST_PRN,
-                      "GAL E1B",
-                      GAL_E1_HZ,
-                      GAL_E1B_CHIPS_NUM,
-                      GAL_E1_CHIPPING_RATE,
-                      true,
-                      GAL_E1B_PRN_PERIOD_MS,
-                      GAL_E1_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L1B in [1]) */
-                      true},
-    [CODE_GAL_E1C] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E1,
-                      GAL_FIRST_PRN,
-                      "GAL E1C",
-                      GAL_E1_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      GAL_E1_DOPPLER_MAX_HZ,
-                      0.5f, /* see L1C in [1] */
-                      false},
-    [CODE_GAL_E1X] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E1,
-                      GAL_FIRST_PRN,
-                      "GAL E1",
-                      GAL_E1_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      GAL_E1_DOPPLER_MAX_HZ,
-                      0.f, /* must be aligned to CODE_GAL_E1B (see L1X in [1])*/
-                      false},
-    [CODE_AUX_GAL] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E1,
-                      GAL_FIRST_PRN,
-                      "GAL AUX",
-                      GAL_E1_HZ,
-                      GAL_E1B_CHIPS_NUM,
-                      GAL_E1_CHIPPING_RATE,
-                      false,
-                      GAL_E1B_PRN_PERIOD_MS,
-                      GAL_E1_DOPPLER_MAX_HZ,
-                      0.f, /* assuming CODE_GAL_E1B */
-                      false},
-    [CODE_GAL_E6B] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E6,
-                      GAL_FIRST_PRN,
-                      "GAL E6B",
-                      GAL_E6_HZ,
-                      GAL_E6_CHIPS_NUM,
-                      GAL_E6_CHIPPING_RATE,
-                      false,
-                      GAL_E6B_PRN_PERIOD_MS,
-                      (float)GAL_E6_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L6B in [1]) */
-                      true},
-    [CODE_GAL_E6C] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E6,
-                      GAL_FIRST_PRN,
-                      "GAL E6C",
-                      GAL_E6_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GAL_E6_DOPPLER_MAX_HZ,
-                      -0.5f, /* see L6C in [1] */
-                      false},
-    [CODE_GAL_E6X] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E6,
-                      GAL_FIRST_PRN,
-                      "GAL E6",
-                      GAL_E6_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GAL_E6_DOPPLER_MAX_HZ,
-                      0.f, /* must be aligned to CODE_GAL_E6B (see L6X in [1])*/
-                      false},
-    [CODE_GAL_E7I] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E7,
-                      GAL_FIRST_PRN,
-                      "GAL E5bI",
-                      GAL_E7_HZ,
-                      GAL_E7_CHIPS_NUM,
-                      GAL_E7_CHIPPING_RATE,
-                      false,
-                      GAL_E7I_PRN_PERIOD_MS,
-                      (float)GAL_E7_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L7I in [1]) */
-                      true},
-    [CODE_GAL_E7Q] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E7,
-                      GAL_FIRST_PRN,
-                      "GAL E5bQ",
-                      GAL_E7_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GAL_E7_DOPPLER_MAX_HZ,
-                      -0.25f, /* see L7Q in [1] */
-                      false},
-    [CODE_GAL_E7X] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E7,
-                      GAL_FIRST_PRN,
-                      "GAL E5b",
-                      GAL_E7_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GAL_E7_DOPPLER_MAX_HZ,
-                      0.f, /* must be aligned to CODE_GAL_E7I (see L7X in [1])*/
-                      false},
-    [CODE_GAL_E8I] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E8,
-                      GAL_FIRST_PRN,
-                      "GAL E8I",
-                      GAL_E8_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GAL_E8_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L8I in [1]) */
-                      false},
-    [CODE_GAL_E8Q] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E8,
-                      GAL_FIRST_PRN,
-                      "GAL E8Q",
-                      GAL_E8_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GAL_E8_DOPPLER_MAX_HZ,
-                      -0.25f, /* see L8Q in [1] */
-                      false},
-    [CODE_GAL_E8X] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E8,
-                      GAL_FIRST_PRN,
-                      "GAL E8",
-                      GAL_E8_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GAL_E8_DOPPLER_MAX_HZ,
-                      0.f, /* must be aligned to CODE_GAL_E8Q (see L8X in [1])*/
-                      false},
-    [CODE_GAL_E5I] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E5,
-                      GAL_FIRST_PRN,
-                      "GAL E5aI",
-                      GAL_E5_HZ,
-                      GAL_E5_CHIPS_NUM,
-                      GAL_E5_CHIPPING_RATE,
-                      false,
-                      GAL_E5I_PRN_PERIOD_MS,
-                      (float)GAL_E5_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L5I in [1]) */
-                      true},
-    [CODE_GAL_E5Q] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E5,
-                      GAL_FIRST_PRN,
-                      "GAL E5aQ",
-                      GAL_E5_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GAL_E5_DOPPLER_MAX_HZ,
-                      -0.25f, /* see L5Q in [1] */
-                      false},
-    [CODE_GAL_E5X] = {CONSTELLATION_GAL,
-                      NUM_SATS_GAL,
-                      NUM_SIGNALS_GAL_E5,
-                      GAL_FIRST_PRN,
-                      "GAL E5a",
-                      GAL_E5_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)GAL_E5_DOPPLER_MAX_HZ,
-                      0.f, /* must be aligned to CODE_GAL_E5I (see L5X in [1])*/
-                      false},
-
-    /** Beidou */
-    [CODE_BDS2_B1] = {CONSTELLATION_BDS,
-                      NUM_SATS_BDS,
-                      NUM_SIGNALS_BDS2_B1,
-                      BDS_FIRST_PRN,
-                      "BDS B1",
-                      BDS2_B1I_HZ,
-                      BDS2_B1I_CHIPS_NUM,
-                      BDS2_B1I_CHIPPING_RATE,
-                      true,
-                      BDS2_B1I_PRN_PERIOD_MS,
-                      BDS2_B1I_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L2I in [1]) */
-                      true},
-    [CODE_AUX_BDS] = {CONSTELLATION_BDS,
-                      NUM_SATS_BDS,
-                      NUM_SIGNALS_BDS2_B1,
-                      BDS_FIRST_PRN,
-                      "BDS AUX",
-                      BDS2_B1I_HZ,
-                      BDS2_B1I_CHIPS_NUM,
-                      BDS2_B1I_CHIPPING_RATE,
-                      false,
-                      BDS2_B1I_PRN_PERIOD_MS,
-                      BDS2_B1I_DOPPLER_MAX_HZ,
-                      0.f, /* assuming CODE_BDS2_B1 */
-                      false},
-    [CODE_BDS2_B2] = {CONSTELLATION_BDS,
-                      NUM_SATS_BDS,
-                      NUM_SIGNALS_BDS2_B2,
-                      BDS_FIRST_PRN,
-                      "BDS B2",
-                      BDS2_B2_HZ,
-                      BDS2_B2_CHIPS_NUM,
-                      BDS2_B2_CHIPPING_RATE,
-                      false,
-                      BDS2_B2_PRN_PERIOD_MS,
-                      (float)BDS2_B2_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L7I in [1]) */
-                      true},
-    [CODE_BDS3_B1CI] = {CONSTELLATION_BDS,
-                        NUM_SATS_BDS,
-                        NUM_SIGNALS_BDS3_B1C,
-                        BDS_FIRST_PRN,
-                        "BDS3 B1CI",
-                        BDS3_B1C_HZ,
-                        BDS3_B1C_CHIPS_NUM,
-                        BDS3_B1C_CHIPPING_RATE,
-                        false,
-                        BDS3_B1C_PRN_PERIOD_MS,
-                        BDS3_B1C_DOPPLER_MAX_HZ,
-                        0.f, /* not used (interoperable with SBAS) */
-                        false},
-    [CODE_BDS3_B1CQ] = {CONSTELLATION_BDS,
-                        NUM_SATS_BDS,
-                        NUM_SIGNALS_BDS3_B1C,
-                        BDS_FIRST_PRN,
-                        "BDS3 B1CQ",
-                        BDS3_B1C_HZ,
-                        0,
-                        0,
-                        false,
-                        0,
-                        BDS3_B1C_DOPPLER_MAX_HZ,
-                        0.f, /* not used (interoperable with SBAS) */
-                        false},
-    [CODE_BDS3_B1CX] = {CONSTELLATION_BDS,
-                        NUM_SATS_BDS,
-                        NUM_SIGNALS_BDS3_B1C,
-                        BDS_FIRST_PRN,
-                        "BDS3 B1C",
-                        BDS3_B1C_HZ,
-                        0,
-                        0,
-                        false,
-                        0,
-                        BDS3_B1C_DOPPLER_MAX_HZ,
-                        0.f, /* not used (interoperable with SBAS) */
-                        false},
-    [CODE_BDS3_B3I] = {CONSTELLATION_BDS,
-                       NUM_SATS_BDS,
-                       NUM_SIGNALS_BDS3_B3,
-                       BDS_FIRST_PRN,
-                       "BDS3 B3I",
-                       BDS3_B3_HZ,
-                       BDS3_B3_CHIPS_NUM,
-                       BDS3_B3_CHIPPING_RATE,
-                       false,
-                       BDS3_B3_PRN_PERIOD_MS,
-                       (float)BDS3_B3_DOPPLER_MAX_HZ,
-                       0.f, /* reference signal (see L6I in [1]) */
-                       false},
-    [CODE_BDS3_B3Q] = {CONSTELLATION_BDS,
-                       NUM_SATS_BDS,
-                       NUM_SIGNALS_BDS3_B3,
-                       BDS_FIRST_PRN,
-                       "BDS3 B3Q",
-                       BDS3_B3_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       (float)BDS3_B3_DOPPLER_MAX_HZ,
-                       -0.25f, /* see L6Q in [1] */
-                       false},
-    [CODE_BDS3_B3X] = {CONSTELLATION_BDS,
-                       NUM_SATS_BDS,
-                       NUM_SIGNALS_BDS3_B3,
-                       BDS_FIRST_PRN,
-                       "BDS3 B3",
-                       BDS3_B3_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       (float)BDS3_B3_DOPPLER_MAX_HZ,
-                       0.f, /*must be aligned to CODE_BDS3_B3I (L6X in [1]) */
-                       false},
-    [CODE_BDS3_B7I] = {CONSTELLATION_BDS,
-                       NUM_SATS_BDS,
-                       NUM_SIGNALS_BDS3_B7,
-                       BDS_FIRST_PRN,
-                       "BDS3 B7I",
-                       BDS3_B7_HZ,
-                       BDS3_B7_CHIPS_NUM,
-                       BDS3_B7_CHIPPING_RATE,
-                       false,
-                       BDS3_B7_PRN_PERIOD_MS,
-                       (float)BDS3_B7_DOPPLER_MAX_HZ,
-                       0.f, /* reference signal (see L7I in [1]) */
-                       false},
-    [CODE_BDS3_B7Q] = {CONSTELLATION_BDS,
-                       NUM_SATS_BDS,
-                       NUM_SIGNALS_BDS3_B7,
-                       BDS_FIRST_PRN,
-                       "BDS3 B7Q",
-                       BDS3_B7_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       (float)BDS3_B7_DOPPLER_MAX_HZ,
-                       -0.25f, /* see L7Q in [1] */
-                       false},
-    [CODE_BDS3_B7X] = {CONSTELLATION_BDS,
-                       NUM_SATS_BDS,
-                       NUM_SIGNALS_BDS3_B7,
-                       BDS_FIRST_PRN,
-                       "BDS3 B7",
-                       BDS3_B7_HZ,
-                       BDS3_B7_CHIPS_NUM,
-                       BDS3_B7_CHIPPING_RATE,
-                       false,
-                       BDS3_B7_PRN_PERIOD_MS,
-                       (float)BDS3_B7_DOPPLER_MAX_HZ,
-                       0.f, /* must be aligned to CODE_BDS3_B7I (L7X in [1]) */
-                       false},
-    [CODE_BDS3_B5I] = {CONSTELLATION_BDS,
-                       NUM_SATS_BDS,
-                       NUM_SIGNALS_BDS3_B5,
-                       BDS_FIRST_PRN,
-                       "BDS3 B5I",
-                       BDS3_B5_HZ,
-                       BDS3_B5_CHIPS_NUM,
-                       BDS3_B5_CHIPPING_RATE,
-                       false,
-                       BDS3_B5_PRN_PERIOD_MS,
-                       (float)BDS3_B5_DOPPLER_MAX_HZ,
-                       0.f, /* not used (interoperable with SBAS) */
-                       false},
-    [CODE_BDS3_B5Q] = {CONSTELLATION_BDS,
-                       NUM_SATS_BDS,
-                       NUM_SIGNALS_BDS3_B5,
-                       BDS_FIRST_PRN,
-                       "BDS3 B5Q",
-                       BDS3_B5_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       (float)BDS3_B5_DOPPLER_MAX_HZ,
-                       0.f, /* not used (interoperable with SBAS) */
-                       false},
-    [CODE_BDS3_B5X] = {CONSTELLATION_BDS,
-                       NUM_SATS_BDS,
-                       NUM_SIGNALS_BDS3_B5,
-                       BDS_FIRST_PRN,
-                       "BDS3 B5",
-                       BDS3_B5_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       (float)BDS3_B5_DOPPLER_MAX_HZ,
-                       0.f, /* not used (interoperable with SBAS) */
-                       false},
-
-    /** QZS L1C/A has all the same characteristics as GPS L1 C/A */
-    [CODE_QZS_L1CA] = {CONSTELLATION_QZS,
-                       NUM_SATS_QZS,
-                       NUM_SIGNALS_QZS_L1,
-                       QZS_FIRST_PRN,
-                       "QZS L1CA",
-                       QZS_L1_HZ,
-                       QZS_L1CA_CHIPS_NUM,
-                       QZS_L1CA_CHIPPING_RATE,
-                       true,
-                       QZS_L1CA_PRN_PERIOD_MS,
-                       QZS_L1_DOPPLER_MAX_HZ,
-                       0.f, /* reference signal (see L1C in [1]) */
-                       true},
-    [CODE_AUX_QZS] = {CONSTELLATION_QZS,
-                      NUM_SATS_QZS,
-                      NUM_SIGNALS_QZS_L1,
-                      QZS_FIRST_PRN,
-                      "QZS AUX",
-                      QZS_L1_HZ,
-                      QZS_L1CA_CHIPS_NUM,
-                      QZS_L1CA_CHIPPING_RATE,
-                      false,
-                      QZS_L1CA_PRN_PERIOD_MS,
-                      QZS_L1_DOPPLER_MAX_HZ,
-                      0.f, /* assuming CODE_QZS_L1CA */
-                      false},
-    [CODE_QZS_L1CI] = {CONSTELLATION_QZS,
-                       NUM_SATS_QZS,
-                       NUM_SIGNALS_QZS_L1C,
-                       QZS_FIRST_PRN,
-                       "QZS L1CI",
-                       QZS_L1_HZ,
-                       GPS_L1C_CHIPS_NUM,
-                       GPS_CA_CHIPPING_RATE,
-                       false,
-                       GPS_L1C_PRN_PERIOD_MS,
-                       GPS_L1_DOPPLER_MAX_HZ,
-                       0.f, /* see L1S in [1] */
-                       false},
-    [CODE_QZS_L1CQ] = {CONSTELLATION_QZS,
-                       NUM_SATS_QZS,
-                       NUM_SIGNALS_QZS_L1C,
-                       QZS_FIRST_PRN,
-                       "QZS L1CQ",
-                       QZS_L1_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       GPS_L1_DOPPLER_MAX_HZ,
-                       0.25f, /* see L1L in [1] */
-                       false},
-    [CODE_QZS_L1CX] = {CONSTELLATION_QZS,
-                       NUM_SATS_QZS,
-                       NUM_SIGNALS_QZS_L1C,
-                       QZS_FIRST_PRN,
-                       "QZS L1CX",
-                       QZS_L1_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       GPS_L1_DOPPLER_MAX_HZ,
-                       0.25f, /* see L1X in [1] */
-                       false},
-    [CODE_QZS_L2CM] = {CONSTELLATION_QZS,
-                       NUM_SATS_QZS,
-                       NUM_SIGNALS_QZS_L2C,
-                       QZS_FIRST_PRN,
-                       "QZS L2CM",
-                       GPS_L2_HZ,
-                       GPS_L2CM_CHIPS_NUM,
-                       QZS_L1CA_CHIPPING_RATE,
-                       false,
-                       GPS_L2CM_PRN_PERIOD_MS,
-                       (float)QZS_L2_DOPPLER_MAX_HZ,
-                       0.f, /* reference signal (see L2S in [1]) */
-                       false},
-    [CODE_QZS_L2CL] = {CONSTELLATION_QZS,
-                       NUM_SATS_QZS,
-                       NUM_SIGNALS_QZS_L2C,
-                       QZS_FIRST_PRN,
-                       "QZS L2CL",
-                       GPS_L2_HZ,
-                       GPS_L2CL_CHIPS_NUM,
-                       QZS_L1CA_CHIPPING_RATE,
-                       false,
-                       GPS_L2CL_PRN_PERIOD_MS,
-                       (float)QZS_L2_DOPPLER_MAX_HZ,
-                       0.f, /* see L2L in [1] */
-                       false},
-    [CODE_QZS_L2CX] = {CONSTELLATION_QZS,
-                       NUM_SATS_QZS,
-                       NUM_SIGNALS_QZS_L2C,
-                       QZS_FIRST_PRN,
-                       "QZS L2C",
-                       GPS_L2_HZ,
-                       0,
-                       0,
-                       false,
-                       0,
-                       (float)QZS_L2_DOPPLER_MAX_HZ,
-                       0.f, /* see L2X in [1] */
-                       false},
-    [CODE_QZS_L5I] = {CONSTELLATION_QZS,
-                      NUM_SATS_QZS,
-                      NUM_SIGNALS_QZS_L5,
-                      QZS_FIRST_PRN,
-                      "QZS L5I",
-                      QZS_L5_HZ,
-                      GPS_L5_CHIPS_NUM,
-                      GPS_L5_CHIPPING_RATE,
-                      false,
-                      GPS_L5_PRN_PERIOD_MS,
-                      (float)QZS_L5_DOPPLER_MAX_HZ,
-                      0.f, /* reference signal (see L5I in [1]) */
-                      false},
-    [CODE_QZS_L5Q] = {CONSTELLATION_QZS,
-                      NUM_SATS_QZS,
-                      NUM_SIGNALS_QZS_L5,
-                      QZS_FIRST_PRN,
-                      "QZS L5Q",
-                      QZS_L5_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)QZS_L5_DOPPLER_MAX_HZ,
-                      -0.25f, /* see L5Q in [1] */
-                      false},
-    [CODE_QZS_L5X] = {CONSTELLATION_QZS,
-                      NUM_SATS_QZS,
-                      NUM_SIGNALS_QZS_L5,
-                      QZS_FIRST_PRN,
-                      "QZS L5",
-                      QZS_L5_HZ,
-                      0,
-                      0,
-                      false,
-                      0,
-                      (float)QZS_L5_DOPPLER_MAX_HZ,
-                      0.f, /* must be aligned to CODE_QZS_L5I (see L5X in [1])*/
-                      false},
+#define CODE_TABLE_ENTRY(code, ...) [code] = {__VA_ARGS__},
+#include <swiftnav/code_table.h>
     [CODE_COUNT] = {CONSTELLATION_INVALID,
                     0,
                     0,
@@ -900,6 +65,111 @@ static const code_table_element_t code_table[CODE_COUNT + 1] = {
                     false},
 };
 
+/* First global index of each code, `<code>_GLOBAL_START`, the prefix sums of
+ * the satellite counts. Each code also takes a `<code>_GLOBAL_LAST`
+ * enumerator so the next one starts sat_count after it. The signal count
+ * can't be used as it only counts the frequency slots of GLONASS FDMA codes. */
+enum {
+#define CODE_TABLE_ENTRY(code, constellation, sat_count, ...) \
+  code##_GLOBAL_START,                                        \
+      code##_GLOBAL_LAST = code##_GLOBAL_START + sat_count - 1,
+#include <swiftnav/code_table.h>
+  GLOBAL_INDEX_END
+};
+
+/** Codes in the order of their global indices, the order of code_table.h. */
+static const u8 global_index_codes[CODE_COUNT] = {
+#define CODE_TABLE_ENTRY(code, ...) code,
+#include <swiftnav/code_table.h>
+};
+
+/** Hot subset of the code table, see code_props_t. */
+SWIFT_ATTR_ALIGNED(64) const code_props_t code_props[CODE_COUNT + 1] = {
+#define CODE_TABLE_ENTRY(code,                   \
+                         constellation,          \
+                         sat_count,              \
+                         sig_count,              \
+                         sat_start,              \
+                         str,                    \
+                         carr_freq,              \
+                         chip_count,             \
+                         chip_rate,              \
+                         requires_direct_acq,    \
+                         prn_period_ms,          \
+                         sv_doppler_max,         \
+                         phase_alignment_cycles, \
+                         requires_data_decoder)  \
+  [code] = {(float)(chip_rate),                  \
+            sat_start,                           \
+            sat_count,                           \
+            sig_count,                           \
+            prn_period_ms,                       \
+            code##_GLOBAL_START,                 \
+            constellation},
+#include <swiftnav/code_table.h>
+    [CODE_COUNT] = {0, 0, 0, 0, 0, GLOBAL_INDEX_END, CONSTELLATION_INVALID},
+};
+
+/** Offset of the GLONASS FDMA rows in the carrier table. */
+#define GLO_CARRIER_ROWS_START (CODE_COUNT + 1)
+
+/** Number of entries of a GLONASS FDMA row of the carrier table, indexed by
+ * frequency slot with the band centre at `GLO_FCN_UNKNOWN`. */
+#define GLO_CARRIER_ROW_SIZE (GLO_MAX_FCN + 1)
+
+/** Carrier frequency of frequency slot `fcn` in GLONASS band `band`. */
+#define GLO_CARRIER_FREQ(band, fcn) \
+  (band##_HZ + ((fcn)-GLO_FCN_OFFSET) * band##_DELTA_HZ)
+
+/** Carrier table entry of frequency slot `fcn` in GLONASS band `band`. */
+#define GLO_CARRIER(band, fcn)                   \
+  {GLO_CARRIER_FREQ(band, fcn),                  \
+   GPS_C / GLO_CARRIER_FREQ(band, fcn),          \
+   GLO_CARRIER_FREQ(band, fcn) / GPS_C}
+
+/** Row of GLONASS band `band`, the centre then frequency slots 1 to 14. */
+#define GLO_CARRIER_ROW(band)                                              \
+  GLO_CARRIER(band, GLO_FCN_OFFSET), GLO_CARRIER(band, 1),                 \
+      GLO_CARRIER(band, 2), GLO_CARRIER(band, 3), GLO_CARRIER(band, 4),    \
+      GLO_CARRIER(band, 5), GLO_CARRIER(band, 6), GLO_CARRIER(band, 7),    \
+      GLO_CARRIER(band, 8), GLO_CARRIER(band, 9), GLO_CARRIER(band, 10),   \
+      GLO_CARRIER(band, 11), GLO_CARRIER(band, 12), GLO_CARRIER(band, 13), \
+      GLO_CARRIER(band, 14)
+
+const sid_carrier_t sid_carrier_table[GLO_CARRIER_ROWS_START +
+                                      2 * GLO_CARRIER_ROW_SIZE] = {
+#define CODE_TABLE_ENTRY(code,                                    \
+                         constellation,                           \
+                         sat_count,                               \
+                         sig_count,                               \
+                         sat_start,                               \
+                         str,                                     \
+                         carr_freq,                               \
+                         ...)                                     \
+  [code] = {carr_freq, GPS_C / (carr_freq), (carr_freq) / GPS_C},
+#include <swiftnav/code_table.h>
+    [GLO_CARRIER_ROWS_START] = GLO_CARRIER_ROW(GLO_L1),
+    [GLO_CARRIER_ROWS_START + GLO_CARRIER_ROW_SIZE] = GLO_CARRIER_ROW(GLO_L2),
+};
+
+/** Row word of GLONASS FDMA band `band`, see `sid_carrier_rows`. */
+#define GLO_CARRIER_ROW_WORD(band) \
+  (0xFFFF0000u | (GLO_CARRIER_ROWS_START + (band)*GLO_CARRIER_ROW_SIZE))
+
+/** Row word of a code, see `sid_carrier_rows`. */
+#define CARRIER_ROW_WORD(code)                                       \
+  ((CODE_GLO_L1OF == (code))                                         \
+       ? GLO_CARRIER_ROW_WORD(0)                                     \
+       : (CODE_GLO_L2OF == (code)) ? GLO_CARRIER_ROW_WORD(1) : (u32)(code))
+
+const u32 sid_carrier_rows[CODE_COUNT + 1] = {
+#define CODE_TABLE_ENTRY(code, ...) [code] = CARRIER_ROW_WORD(code),
+#include <swiftnav/code_table.h>
+    [CODE_COUNT] = CODE_COUNT,
+};
+
+u8 sid_carrier_glo_fcn[SID_CARRIER_GLO_SLOTS] = {GLO_FCN_UNKNOWN};
+
 static const char *constellation_table[CONSTELLATION_COUNT] = {
     [CONSTELLATION_GPS] = "GPS",
     [CONSTELLATION_SBAS] = "SBAS",
@@ -922,12 +192,8 @@ const char *constellation_to_string(const constellation_t cons) {
 }
 
 constellation_t constellation_string_to_enum(const char *constellation_string) {
-  for (s32 i = 0; i < (s32)CONSTELLATION_COUNT; ++i) {
-    if (strcmp(constellation_string, constellation_table[i]) == 0) {
-      return (constellation_t)i;
-    }
-  }
-  return CONSTELLATION_INVALID;
+  return constellation_string_to_enum_n(constellation_string,
+                                        strlen(constellation_string));
 }
 
 const char *sub_constellation_to_string(const sub_constellation_t sub_cons) {
@@ -936,12 +202,8 @@ const char *sub_constellation_to_string(const sub_constellation_t sub_cons) {
 
 sub_constellation_t sub_constellation_string_to_enum(
     const char *sub_constellation_string) {
-  for (s32 i = 0; i < (s32)SUB_CONSTELLATION_COUNT; ++i) {
-    if (strcmp(sub_constellation_string, sub_constellation_table[i]) == 0) {
-      return (sub_constellation_t)i;
-    }
-  }
-  return SUB_CONSTELLATION_INVALID;
+  return sub_constellation_string_to_enum_n(sub_constellation_string,
+                                            strlen(sub_constellation_string));
 }
 
 constellation_t sub_constellation_to_constellation(
@@ -968,13 +230,138 @@ constellation_t sub_constellation_to_constellation(
   }
 }
 
-code_t code_string_to_enum(const char *code_label) {
-  for (s32 i = 0; i < (s32)CODE_COUNT; ++i) {
-    if (strcmp(code_label, code_table[i].str) == 0) {
-      return (code_t)i;
+/** Upper case an ASCII letter, other characters are left alone. */
+static char label_fold(char c) {
+  return ((c >= 'a') && (c <= 'z')) ? (char)(c - 'a' + 'A') : c;
+}
+
+/** Slot of a label in a perfect hash table, the seeded FNV-1a hash of the
+ * label ignoring case, see scripts/signal_hash_generator.py.
+ *
+ * \param str   Label, need not be NUL terminated
+ * \param len   Length of the label
+ * \param seed  Seed found for the table by the generator
+ * \param bits  Base 2 logarithm of the size of the table
+ * \return Slot of the label
+ */
+static u32 label_hash(const char *str, size_t len, u32 seed, u32 bits) {
+  u32 h = seed;
+  for (size_t i = 0; i < len; i++) {
+    h = (h ^ (u8)label_fold(str[i])) * 16777619U;
+  }
+  return h >> (32 - bits);
+}
+
+/** Compare a NUL terminated label with a string slice.
+ *
+ * \param label   NUL terminated label
+ * \param str     Slice, need not be NUL terminated
+ * \param len     Length of the slice
+ * \param nocase  Ignore the case of ASCII letters
+ * \return true if the slice spells the label
+ */
+static bool label_equal(const char *label,
+                        const char *str,
+                        size_t len,
+                        bool nocase) {
+  for (size_t i = 0; i < len; i++) {
+    if (label[i] == 0) {
+      return false;
+    }
+    char a = nocase ? label_fold(label[i]) : label[i];
+    char b = nocase ? label_fold(str[i]) : str[i];
+    if (a != b) {
+      return false;
     }
   }
-  return CODE_INVALID;
+  return label[len] == 0;
+}
+
+static constellation_t constellation_lookup(const char *str,
+                                            size_t len,
+                                            bool nocase) {
+  s8 i = constellation_hash_table[label_hash(
+      str, len, CONSTELLATION_HASH_SEED, CONSTELLATION_HASH_BITS)];
+  if ((i < 0) || !label_equal(constellation_table[i], str, len, nocase)) {
+    return CONSTELLATION_INVALID;
+  }
+  return (constellation_t)i;
+}
+
+/** Parse a constellation label of known length, such as "GPS".
+ *
+ * \param str Label, need not be NUL terminated
+ * \param len Length of the label
+ * \return Constellation, CONSTELLATION_INVALID if the label is not known
+ */
+constellation_t constellation_string_to_enum_n(const char *str, size_t len) {
+  return constellation_lookup(str, len, false);
+}
+
+/** Parse a constellation label of known length ignoring case, see
+ * `constellation_string_to_enum_n()`. */
+constellation_t constellation_string_to_enum_nocase(const char *str,
+                                                    size_t len) {
+  return constellation_lookup(str, len, true);
+}
+
+static sub_constellation_t sub_constellation_lookup(const char *str,
+                                                    size_t len,
+                                                    bool nocase) {
+  s8 i = sub_constellation_hash_table[label_hash(
+      str, len, SUB_CONSTELLATION_HASH_SEED, SUB_CONSTELLATION_HASH_BITS)];
+  if ((i < 0) || !label_equal(sub_constellation_table[i], str, len, nocase)) {
+    return SUB_CONSTELLATION_INVALID;
+  }
+  return (sub_constellation_t)i;
+}
+
+/** Parse a sub constellation label of known length, such as "BDS3".
+ *
+ * \param str Label, need not be NUL terminated
+ * \param len Length of the label
+ * \return Sub constellation, SUB_CONSTELLATION_INVALID if the label is not
+ *         known
+ */
+sub_constellation_t sub_constellation_string_to_enum_n(const char *str,
+                                                       size_t len) {
+  return sub_constellation_lookup(str, len, false);
+}
+
+/** Parse a sub constellation label of known length ignoring case, see
+ * `sub_constellation_string_to_enum_n()`. */
+sub_constellation_t sub_constellation_string_to_enum_nocase(const char *str,
+                                                           size_t len) {
+  return sub_constellation_lookup(str, len, true);
+}
+
+static code_t code_lookup(const char *str, size_t len, bool nocase) {
+  s8 i = code_hash_table[label_hash(str, len, CODE_HASH_SEED, CODE_HASH_BITS)];
+  if ((i < 0) || (code_label_len[i] != len) ||
+      !label_equal(code_table[i].str, str, len, nocase)) {
+    return CODE_INVALID;
+  }
+  return (code_t)i;
+}
+
+code_t code_string_to_enum(const char *code_label) {
+  return code_string_to_enum_n(code_label, strlen(code_label));
+}
+
+/** Parse a code label of known length, such as "GPS L1CA".
+ *
+ * \param str Label, need not be NUL terminated
+ * \param len Length of the label
+ * \return Code, CODE_INVALID if the label is not known
+ */
+code_t code_string_to_enum_n(const char *str, size_t len) {
+  return code_lookup(str, len, false);
+}
+
+/** Parse a code label of known length ignoring case, see
+ * `code_string_to_enum_n()`. */
+code_t code_string_to_enum_nocase(const char *str, size_t len) {
+  return code_lookup(str, len, true);
 }
 
 typedef struct {
@@ -1019,6 +406,50 @@ gnss_signal_t construct_sid(code_t code, u16 sat) {
   return sid;
 }
 
+/** Longest string written by `format_sat_code()`, the longest code label, a
+ * suffix and five digits. */
+#define SAT_CODE_STR_LEN_MAX \
+  (sizeof(code_table[0].str) + MESID_SUFFIX_LENGTH + 5)
+
+/** Write the decimal digits of a number, without a terminating NUL.
+ *
+ * \param buf   Buffer of at least 5 characters
+ * \param value Number to write
+ * \return Number of characters written
+ */
+static size_t format_u16(char *buf, u16 value) {
+  char digits[5];
+  size_t n = 0;
+  do {
+    digits[n++] = (char)('0' + value % 10);
+    value /= 10;
+  } while (value > 0);
+  for (size_t i = 0; i < n; i++) {
+    buf[i] = digits[n - 1 - i];
+  }
+  return n;
+}
+
+/** Write a code label, a suffix and a satellite number, without a
+ * terminating NUL.
+ *
+ * \param buf         Buffer of at least SAT_CODE_STR_LEN_MAX characters
+ * \param suffix_len  Length of suffix, at most MESID_SUFFIX_LENGTH
+ * \param suffix      Suffix string to be printed
+ * \param sat         Sat identifier
+ * \param code        Code identifier
+ * \return Number of characters written
+ */
+static size_t format_sat_code(
+    char *buf, size_t suffix_len, const char *suffix, u16 sat, code_t code) {
+  bool known = (code >= 0) && (code < CODE_COUNT);
+  size_t n = known ? code_label_len[code] : strlen(unknown_str);
+  memcpy(buf, known ? code_table[code].str : unknown_str, n);
+  memcpy(&buf[n], suffix, suffix_len);
+  n += suffix_len;
+  return n + format_u16(&buf[n], sat);
+}
+
 /** Print a string representation of a sat code.
  *
  * \param str_buf     Buffer of capacity str_buf_len,
@@ -1035,35 +466,7 @@ int sat_code_to_string(char *str_buf,
                        const char *suffix,
                        u16 sat,
                        code_t code) {
-  const char *code_str =
-      ((code < 0) || (code >= CODE_COUNT)) ? unknown_str : code_table[code].str;
-  int nchars = 0;
-
-  /* Copy code string */
-  for (u32 i = 0; code_str[i] != 0; i++) {
-    str_buf[nchars++] = code_str[i];
-  }
-
-  /* Print suffix */
-  for (u32 i = 0; i < suffix_len; i++) {
-    str_buf[nchars++] = suffix[i];
-  }
-
-  /* Print sat value */
-  bool started = false;
-  u16 div = 10000;
-  while (div > 0) {
-    u8 digit = (sat / div) % 10;
-    div /= 10;
-    if (started || (digit != 0)) {
-      str_buf[nchars++] = '0' + digit;
-      started = true;
-    }
-  }
-  /* Handle special case where sat = 0 */
-  if (!started) {
-    str_buf[nchars++] = '0';
-  }
+  int nchars = (int)format_sat_code(str_buf, suffix_len, suffix, sat, code);
   str_buf[nchars] = 0;
   if (nchars >= SID_STR_LEN_MAX) {
     log_error("%d: %s", nchars, str_buf);
@@ -1087,6 +490,27 @@ int sid_to_string(char *s, int n, const gnss_signal_t sid) {
       s, SID_SUFFIX_LENGTH, /* suffix = */ " ", sid.sat, sid.code);
 }
 
+/** Print a string representation of a gnss_signal_t into a buffer of any
+ * size, truncating the string if it does not fit.
+ *
+ * \param s   Buffer of capacity n to which the string will be written.
+ * \param n   Capacity of buffer s, nothing is written if 0.
+ * \param sid gnss_signal_t to use.
+ *
+ * \return Number of characters written to s, excluding the terminating null.
+ */
+size_t sid_to_string_n(char *s, size_t n, const gnss_signal_t sid) {
+  if (n == 0) {
+    return 0;
+  }
+  char buf[SAT_CODE_STR_LEN_MAX];
+  size_t len = format_sat_code(buf, SID_SUFFIX_LENGTH, " ", sid.sat, sid.code);
+  len = MIN(len, n - 1);
+  memcpy(s, buf, len);
+  s[len] = 0;
+  return len;
+}
+
 /** Determine if a gnss_signal_t corresponds to a known code and
  * satellite identifier.
  *
@@ -1142,6 +566,46 @@ u16 sid_to_code_index(gnss_signal_t sid) {
   return sid.sat - code_table[sid.code].sat_start;
 }
 
+/** Return the index of a gnss_signal_t among the signals of all codes.
+ *
+ * The global indices of the signals of a code are contiguous and follow
+ * those of the previous code, so per signal state can be kept in a flat array
+ * of SID_GLOBAL_COUNT entries instead of a map keyed on `sid_hash()`.
+ *
+ * \param sid   gnss_signal_t to use.
+ *
+ * \return Global signal index in [0, SID_GLOBAL_COUNT).
+ */
+u16 sid_to_global_index(gnss_signal_t sid) {
+  assert(sid_valid(sid));
+  return code_props[sid.code].global_start + sid_to_code_index(sid);
+}
+
+/** Return the gnss_signal_t of a global signal index, the inverse of
+ * `sid_to_global_index()`.
+ *
+ * \param global_index  Global signal index in [0, SID_GLOBAL_COUNT).
+ *
+ * \return gnss_signal_t with that global index.
+ */
+gnss_signal_t global_index_to_sid(u16 global_index) {
+  assert(global_index < SID_GLOBAL_COUNT);
+  /* Last code starting at or before the index. */
+  u32 lo = 0;
+  u32 hi = CODE_COUNT;
+  while (hi - lo > 1) {
+    u32 mid = (lo + hi) / 2;
+    if (code_props[global_index_codes[mid]].global_start <= global_index) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  code_t code = (code_t)global_index_codes[lo];
+  return sid_from_code_index(code,
+                             global_index - code_props[code].global_start);
+}
+
 /** Get the constellation to which a gnss_signal_t belongs.
  *
  * \param sid   gnss_signal_t to use.
@@ -1209,6 +673,22 @@ double sid_to_lambda(gnss_signal_t sid) {
   return GPS_C / code_table[sid.code].carr_freq;
 }
 
+/** Set the frequency slot of a GLONASS orbital slot for `sid_to_carrier()`.
+ *
+ * The carrier table itself is constant, only the frequency slot of the
+ * orbital slot is published, with a single byte release store. Called by
+ * the GLO map whenever a frequency slot is set or cleared.
+ *
+ * \param glo_slot_id GLO orbital slot
+ * \param fcn GLO frequency slot, anything outside GLO_MIN_FCN to GLO_MAX_FCN
+ *            selects the band centre
+ */
+void sid_carrier_set_glo_fcn(u16 glo_slot_id, u16 fcn) {
+  assert(glo_slot_id < SID_CARRIER_GLO_SLOTS);
+  u8 index = glo_fcn_is_valid(fcn) ? (u8)fcn : (u8)GLO_FCN_UNKNOWN;
+  SID_CARRIER_STORE_FCN(&sid_carrier_glo_fcn[glo_slot_id], index);
+}
+
 /** Return the chips count for a code_t.
  *
  * \param code  code_t to use.
@@ -23,6 +23,7 @@
 #include <swiftnav/float_equality.h>
 #include <swiftnav/linear_algebra.h>
 #include <swiftnav/logging.h>
+#include <swiftnav/udu_filter.h>
 
 #include "max_channels.h"
 
@@ -77,6 +78,36 @@
 #define RANGE_RESIDUAL_THRESHOLD_M 30
 #define DOPPLER_RESIDUAL_THRESHOLD_M_S 5
 
+/* Recursive position filter state layout. Position and clock biases are
+ * placed as in the LSQ state vector with an identity clock map, followed by
+ * velocity and a common clock drift, so that the LSQ measurement models can be
+ * evaluated directly on the filter state. */
+#define PVT_FILTER_POS_IDX 0
+#define PVT_FILTER_CLOCK_IDX 3
+#define PVT_FILTER_VEL_IDX N_STATE
+#define PVT_FILTER_DRIFT_IDX (N_STATE + 3)
+#define PVT_FILTER_N_STATES (N_STATE + 4)
+
+/* Number of process noise inputs: two per position/velocity axis, two for
+ * the shared clock drift and one per constellation clock bias */
+#define PVT_FILTER_N_NOISE (8 + CONSTELLATION_COUNT)
+
+/* Default process noise spectral densities */
+#define PVT_FILTER_ACCEL_PSD 1.0
+#define PVT_FILTER_CLOCK_BIAS_PSD 1.0
+#define PVT_FILTER_CLOCK_DRIFT_PSD 0.1
+
+/* Initial variances for states not provided by the seeding solution */
+#define PVT_FILTER_CLOCK_INIT_VAR 1e8
+#define PVT_FILTER_VEL_INIT_VAR 1e2
+#define PVT_FILTER_DRIFT_INIT_VAR 1e2
+
+/* Longest gap between updates before the filter is re-seeded [s] */
+#define PVT_FILTER_MAX_GAP_S 30.0
+
+/* Innovation gate in units of innovation sigmas */
+#define PVT_FILTER_GATE_SIGMAS 5.0
+
 /* container for the LSQ iteration results and intermediate arrays */
 typedef struct {
   /* state estimate */
@@ -588,12 +619,9 @@ static s8 pvt_solve(const u8 n_used,
   return 1;
 }
 
-static s8 filter_solution(gnss_solution *soln, dops_t *dops) {
-  if (dops->gdop > 20.0) {
-    /* GDOP is too high to yield a good solution. */
-    return PVT_PDOP_TOO_HIGH;
-  }
-
+/* Checks the altitude and velocity of a solution. Every solution output,
+ * whatever its DOP, must pass these checks. */
+static s8 check_solution_limits(const gnss_solution *soln) {
   if (soln->pos_llh[2] < -1e3 || soln->pos_llh[2] > 1e6) {
     /* Altitude is unreasonable. */
     return PVT_BAD_ALTITUDE;
@@ -611,6 +639,15 @@ static s8 filter_solution(gnss_solution *soln, dops_t *dops) {
   return 0;
 }
 
+static s8 filter_solution(gnss_solution *soln, dops_t *dops) {
+  if (dops->gdop > 20.0) {
+    /* GDOP is too high to yield a good solution. */
+    return PVT_PDOP_TOO_HIGH;
+  }
+
+  return check_solution_limits(soln);
+}
+
 /** Checks pvt_iter weighted residuals.
  *
  * \param n_used   length of omp
@@ -701,6 +738,10 @@ static bool flag_outliers(const u8 n_used,
   uint16_t signals_flagged = 0;
   double line_of_sight[3];
 
+  /* signals that have already gone through RAIM */
+  gnss_sid_set_t skip_sids;
+  sid_set_union(&skip_sids, exclude_sids, removed_sids);
+
   LSN_NEW_ARRAY(range_residual, n_used, double);
 
   /* bias per code */
@@ -713,8 +754,7 @@ static bool flag_outliers(const u8 n_used,
   /* first pass through measurements computes the biases per code */
   for (u8 i = 0; i < n_used; i++) {
     gnss_signal_t sid = nav_meas[i]->sid;
-    if (sid_set_contains(exclude_sids, sid) ||
-        sid_set_contains(removed_sids, sid)) {
+    if (sid_set_contains(&skip_sids, sid)) {
       range_residual[i] = 0;
       /* already gone through RAIM */
       continue;
@@ -737,8 +777,7 @@ static bool flag_outliers(const u8 n_used,
   /* second pass does the outlier detection */
   for (u8 i = 0; i < n_used; i++) {
     gnss_signal_t sid = nav_meas[i]->sid;
-    if (sid_set_contains(exclude_sids, sid) ||
-        sid_set_contains(removed_sids, sid)) {
+    if (sid_set_contains(&skip_sids, sid)) {
       /* already gone through RAIM */
       continue;
     }
@@ -1268,10 +1307,8 @@ static bool gps_l1ca_when_possible(gnss_signal_t sid,
   bool use_this = false;
   u8 sats_used = sid_set_get_sat_count(&sids_used);
   if (sats_used <= n_states + RAIM_MAX_EXCLUSIONS) {
-    gnss_sid_set_t new_sids_used = sids_used;
-    sid_set_add(&new_sids_used, sid);
-    use_this = (sid_set_get_sat_count(&new_sids_used) >
-                sid_set_get_sat_count(&sids_used));
+    /* use only signals that add a new satellite */
+    use_this = !sid_set_contains_sat(&sids_used, sid);
   }
   return use_this;
 }
@@ -1426,27 +1463,18 @@ static s8 calc_PVT_pred_internal(const u8 n_meas,
                                /* metric = */ NULL);
   }
 
-  gnss_sid_set_t sid_set;
-  sid_set_init(&sid_set);
-
-  if (raim_flag >= PVT_CONVERGED_RAIM_OK) {
-    /* Count number of unique satellites in the solution */
-    for (u8 j = 0; j < n_processed_meas_used; j++) {
-      /* Skip the removed SIDs */
-      if ((raim_flag == PVT_CONVERGED_RAIM_REPAIR) &&
-          sid_set_contains(&removed_sids, processed_nav_meas_ptrs[j]->sid)) {
-        continue;
-      }
-      soln->n_sigs_used++;
-      sid_set_add(&sid_set, processed_nav_meas_ptrs[j]->sid);
-    }
-  }
-
   if (raim_flag < PVT_CONVERGED_RAIM_OK) {
     /* Didn't converge or least squares integrity check failed. */
     return raim_flag;
   }
 
+  /* Count number of unique signals and satellites in the solution, skipping
+   * the removed SIDs */
+  gnss_sid_set_t sid_set = sids_used;
+  if (raim_flag == PVT_CONVERGED_RAIM_REPAIR) {
+    sid_set_difference(&sid_set, &sids_used, &removed_sids);
+  }
+  soln->n_sigs_used = sid_set_get_sig_count(&sid_set);
   soln->n_sats_used = sid_set_get_sat_count(&sid_set);
 
   /* Compute various dilution of precision metrics. */
@@ -1482,10 +1510,11 @@ static s8 calc_PVT_pred_internal(const u8 n_meas,
     soln->vel_ecef[i] = lsq_data.rx_state[n_states + i];
   }
 
-  wgsecef2ned(soln->vel_ecef, soln->pos_ecef, soln->vel_ned);
-
-  /* Convert to lat, lon, hgt. */
-  wgsecef2llh(lsq_data.rx_state, soln->pos_llh);
+  /* Convert to lat, lon, hgt and rotate the velocity into the local frame. */
+  ned_frame_t frame;
+  ned_frame_init_ecef(&frame, soln->pos_ecef);
+  memcpy(soln->pos_llh, frame.ref_llh, sizeof(soln->pos_llh));
+  ned_frame_ecef2ned(&frame, soln->vel_ecef, soln->vel_ned);
 
   soln->clock_offset = lsq_data.rx_state[3] / GPS_C;
   soln->clock_drift = lsq_data.rx_state[3 + n_states] / GPS_C;
@@ -1654,4 +1683,490 @@ s8 calc_PVT(const u8 n_used,
   return 0;
 }
 
+/***********************************************************************
+ * Recursive position filter
+ ***********************************************************************/
+
+/** Initialize a recursive position filter.
+ *
+ * \param filter Filter to initialize
+ * \param config Process noise settings, or NULL for the defaults
+ */
+void pvt_filter_init(pvt_filter_t *filter, const pvt_filter_config_t *config) {
+  assert(PVT_FILTER_N_STATES <= UDU_FILTER_MAX_STATES);
+  assert(PVT_FILTER_N_NOISE <= UDU_FILTER_MAX_NOISE);
+  memset(filter, 0, sizeof(*filter));
+  if (NULL != config) {
+    filter->config = *config;
+  } else {
+    filter->config.accel_psd = PVT_FILTER_ACCEL_PSD;
+    filter->config.clock_bias_psd = PVT_FILTER_CLOCK_BIAS_PSD;
+    filter->config.clock_drift_psd = PVT_FILTER_CLOCK_DRIFT_PSD;
+  }
+}
+
+/** Discard the filter state, the next call to calc_PVT_filter() re-seeds it
+ * from a single epoch solution.
+ *
+ * \param filter Filter to reset
+ */
+void pvt_filter_reset(pvt_filter_t *filter) {
+  filter->initialized = false;
+  memset(filter->clock_initialized, 0, sizeof(filter->clock_initialized));
+}
+
+/** Re-initialize a single filter state, removing its correlations. */
+static void pvt_filter_reset_state(pvt_filter_t *filter,
+                                   u32 idx,
+                                   double value,
+                                   double var) {
+  u32 n = filter->kf.n;
+  double x[UDU_FILTER_MAX_STATES];
+  double P[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+  memcpy(x, filter->kf.x, n * sizeof(double));
+  udu_filter_get_covariance(&filter->kf, P);
+  for (u32 i = 0; i < n; i++) {
+    P[i * n + idx] = 0;
+    P[idx * n + i] = 0;
+  }
+  P[idx * n + idx] = var;
+  x[idx] = value;
+  udu_filter_init(&filter->kf, n, x, P);
+}
+
+/** Propagate the filter state over `dt` seconds.
+ *
+ * Position and clock biases are integrated from velocity and clock drift,
+ * which follow random walks. The correlated position/velocity and clock
+ * bias/drift process noise blocks are supplied to the time update in factored
+ * form so that the noise covariance stays diagonal.
+ */
+static void pvt_filter_predict(pvt_filter_t *filter, double dt) {
+  const u32 n = PVT_FILTER_N_STATES;
+  const u32 p = PVT_FILTER_N_NOISE;
+  const pvt_filter_config_t *cfg = &filter->config;
+  double Phi[PVT_FILTER_N_STATES * PVT_FILTER_N_STATES];
+  double G[PVT_FILTER_N_STATES * PVT_FILTER_N_NOISE];
+  double Q[PVT_FILTER_N_NOISE];
+  double dt3 = dt * dt * dt;
+
+  matrix_eye(n, Phi);
+  memset(G, 0, sizeof(G));
+  u32 k = 0;
+  for (u32 i = 0; i < 3; i++) {
+    Phi[(PVT_FILTER_POS_IDX + i) * n + PVT_FILTER_VEL_IDX + i] = dt;
+    G[(PVT_FILTER_POS_IDX + i) * p + k] = 1;
+    Q[k++] = cfg->accel_psd * dt3 / 12;
+    G[(PVT_FILTER_POS_IDX + i) * p + k] = dt / 2;
+    G[(PVT_FILTER_VEL_IDX + i) * p + k] = 1;
+    Q[k++] = cfg->accel_psd * dt;
+  }
+  for (u32 c = 0; c < CONSTELLATION_COUNT; c++) {
+    Phi[(PVT_FILTER_CLOCK_IDX + c) * n + PVT_FILTER_DRIFT_IDX] = dt;
+    G[(PVT_FILTER_CLOCK_IDX + c) * p + k] = 1;
+    G[(PVT_FILTER_CLOCK_IDX + c) * p + k + 1] = dt / 2;
+  }
+  G[PVT_FILTER_DRIFT_IDX * p + k + 1] = 1;
+  Q[k++] = cfg->clock_drift_psd * dt3 / 12;
+  Q[k++] = cfg->clock_drift_psd * dt;
+  for (u32 c = 0; c < CONSTELLATION_COUNT; c++) {
+    G[(PVT_FILTER_CLOCK_IDX + c) * p + k] = 1;
+    Q[k++] = cfg->clock_bias_psd * dt;
+  }
+  assert(k == p);
+
+  udu_filter_predict(&filter->kf, Phi, p, G, Q);
+}
+
+/** Tell whether a measurement can be used by the filter. */
+static bool pvt_filter_meas_usable(const navigation_measurement_t *nav_meas,
+                                   const obs_mask_config_t *obs_mask_config) {
+  return (nav_meas->flags & NAV_MEAS_FLAG_CODE_VALID) &&
+         obs_mask_check_passed(obs_mask_config, nav_meas->cn0);
+}
+
+/** Seed the filter from a single epoch solution. */
+static s8 pvt_filter_seed(pvt_filter_t *filter,
+                          const u8 n_meas,
+                          const navigation_measurement_t **nav_meas,
+                          const gps_time_t *tor,
+                          const bool disable_velocity,
+                          const obs_mask_config_t *obs_mask_config,
+                          gnss_solution *soln,
+                          dops_t *dops,
+                          gnss_sid_set_t *rejected_sids) {
+  s8 ret = calc_PVT_pred_internal(n_meas,
+                                  nav_meas,
+                                  tor,
+                                  false,
+                                  disable_velocity,
+                                  obs_mask_config,
+                                  all_constellations,
+                                  soln,
+                                  dops,
+                                  rejected_sids);
+  if (ret < 0) {
+    return ret;
+  }
+
+  double x[PVT_FILTER_N_STATES] = {0};
+  double var[PVT_FILTER_N_STATES];
+  for (u8 i = 0; i < CONSTELLATION_COUNT; i++) {
+    /* Clock biases are initialized from the first residual of each
+     * constellation when it is first used by the filter. */
+    var[PVT_FILTER_CLOCK_IDX + i] = PVT_FILTER_CLOCK_INIT_VAR;
+  }
+  const u8 cov_diag[3] = {0, 3, 5};
+  for (u8 i = 0; i < 3; i++) {
+    x[PVT_FILTER_POS_IDX + i] = soln->pos_ecef[i];
+    var[PVT_FILTER_POS_IDX + i] = soln->err_cov[cov_diag[i]];
+    if (soln->velocity_valid) {
+      x[PVT_FILTER_VEL_IDX + i] = soln->vel_ecef[i];
+      var[PVT_FILTER_VEL_IDX + i] = soln->vel_cov[cov_diag[i]];
+    } else {
+      var[PVT_FILTER_VEL_IDX + i] = PVT_FILTER_VEL_INIT_VAR;
+    }
+  }
+  if (soln->velocity_valid) {
+    x[PVT_FILTER_DRIFT_IDX] = soln->clock_drift * GPS_C;
+    var[PVT_FILTER_DRIFT_IDX] = soln->clock_drift_var * GPS_C * GPS_C;
+  } else {
+    var[PVT_FILTER_DRIFT_IDX] = PVT_FILTER_DRIFT_INIT_VAR;
+  }
+
+  udu_filter_init_diag(&filter->kf, PVT_FILTER_N_STATES, x, var);
+  memset(filter->clock_initialized, 0, sizeof(filter->clock_initialized));
+  filter->t = *tor;
+  filter->initialized = true;
+  return ret;
+}
+
+/** Innovation gate of one linearized scalar measurement.
+ *
+ * \param z Output measurement to pass to udu_filter_update(), shifted so that
+ *          the filter computes the innovation against the current estimate
+ *          rather than the linearization point
+ *
+ * \return true if the measurement passed the innovation gate
+ */
+static bool pvt_filter_gate(const pvt_filter_t *filter,
+                            const double *x_lin,
+                            const double *h,
+                            double omp,
+                            double var,
+                            double *z) {
+  *z = omp + vector_dot(PVT_FILTER_N_STATES, h, x_lin);
+  double innov = *z - vector_dot(PVT_FILTER_N_STATES, h, filter->kf.x);
+  double s = udu_filter_innovation_variance(&filter->kf, h, var);
+  return innov * innov <= PVT_FILTER_GATE_SIGMAS * PVT_FILTER_GATE_SIGMAS * s;
+}
+
+/** Recursive multi-epoch position, velocity and clock solution.
+ *
+ * Runs an extended Kalman filter over receiver position, velocity, one clock
+ * bias per constellation and a common clock drift, using the same measurement
+ * models and noise model as calc_PVT(). Each call propagates the filter to
+ * `tor`, linearizes once about the predicted state and applies every
+ * measurement as a sequential scalar update. Measurements whose pseudorange
+ * or Doppler innovation falls outside the gate are rejected as a whole
+ * instead of running RAIM.
+ *
+ * The filter is seeded from a RAIM checked single epoch solution on the first
+ * call, after pvt_filter_reset(), after a gap longer than 30 s or if time
+ * runs backwards. Once seeded it keeps producing solutions with fewer
+ * satellites than a single epoch solution requires.
+ *
+ * \param filter - filter state, initialized with pvt_filter_init()
+ * \param n_meas - number of measurements
+ * \param nav_meas - array of measurements of length `n_meas`
+ * \param tor - the time of reception
+ * \param disable_velocity - passing True will ignore Doppler measurements
+ * \param obs_mask_config - measurement mask
+ * \param soln - output solution struct
+ * \param dops - output dilution of precision information, zero if the epoch
+ *        geometry alone is under-determined
+ * \param rejected_sids - optional arg that returns the sids of measurements
+ *        rejected by the innovation gate or by RAIM while seeding
+ *
+ * \return Non-negative values indicate a valid solution, with the same
+ *         meaning as for calc_PVT(). `1` indicates that some measurements
+ *         were rejected. Negative values are as for calc_PVT(); on
+ *         `-4` (most measurements rejected) and `-2`/`-3` the filter is reset.
+ */
+s8 calc_PVT_filter(pvt_filter_t *filter,
+                   const u8 n_meas,
+                   const navigation_measurement_t nav_meas[],
+                   const gps_time_t *tor,
+                   const bool disable_velocity,
+                   const obs_mask_config_t *obs_mask_config,
+                   gnss_solution *soln,
+                   dops_t *dops,
+                   gnss_sid_set_t *rejected_sids) {
+  assert(filter != NULL);
+  assert(tor != NULL);
+  assert(soln != NULL);
+  assert(dops != NULL);
+
+  u8 n_used = 0;
+  for (u8 i = 0; i < n_meas; i++) {
+    n_used += pvt_filter_meas_usable(&nav_meas[i], obs_mask_config) ? 1 : 0;
+  }
+  if (0 == n_used) {
+    memset(soln, 0, sizeof(*soln));
+    memset(dops, 0, sizeof(*dops));
+    return PVT_INSUFFICENT_MEAS;
+  }
+
+  LSN_NEW_ARRAY(nav_meas_ptrs, n_used, const navigation_measurement_t *);
+  n_used = 0;
+  for (u8 i = 0; i < n_meas; i++) {
+    if (pvt_filter_meas_usable(&nav_meas[i], obs_mask_config)) {
+      nav_meas_ptrs[n_used++] = &nav_meas[i];
+    }
+  }
+
+  double dt = 0;
+  if (filter->initialized) {
+    dt = gpsdifftime(tor, &filter->t);
+    if (dt < 0 || dt > PVT_FILTER_MAX_GAP_S) {
+      log_info("Re-seeding position filter after %.1f s", dt);
+      pvt_filter_reset(filter);
+    }
+  }
+
+  if (!filter->initialized) {
+    s8 ret = pvt_filter_seed(filter,
+                             n_used,
+                             nav_meas_ptrs,
+                             tor,
+                             disable_velocity,
+                             obs_mask_config,
+                             soln,
+                             dops,
+                             rejected_sids);
+    LSN_FREE_ARRAY(nav_meas_ptrs);
+    return ret;
+  }
+
+  pvt_filter_predict(filter, dt);
+  filter->t = *tor;
+
+  /* Initialize the clock bias of newly seen constellations from the first
+   * pseudorange residual against the predicted position. */
+  s8 clock_map[CONSTELLATION_COUNT];
+  for (u8 c = 0; c < CONSTELLATION_COUNT; c++) {
+    clock_map[c] = PVT_FILTER_CLOCK_IDX + c;
+  }
+  double rx_state[2 * N_STATE] = {0};
+  double los[3];
+  for (u8 i = 0; i < n_used; i++) {
+    constellation_t c = sid_to_constellation(nav_meas_ptrs[i]->sid);
+    if (!filter->clock_initialized[c]) {
+      memcpy(rx_state, filter->kf.x, PVT_FILTER_N_STATES * sizeof(double));
+      rx_state[clock_map[c]] = 0;
+      double range = compute_predicted_pseudorange(
+          clock_map, rx_state, nav_meas_ptrs[i], los);
+      pvt_filter_reset_state(
+          filter,
+          clock_map[c],
+          nav_meas_cor_sat_clk_on_pseudorange(nav_meas_ptrs[i]) - range,
+          PVT_FILTER_CLOCK_INIT_VAR);
+      filter->clock_initialized[c] = true;
+    }
+  }
+
+  /* Single linearization point for the whole epoch */
+  memcpy(rx_state, filter->kf.x, PVT_FILTER_N_STATES * sizeof(double));
+
+  gnss_sid_set_t used_sids;
+  gnss_sid_set_t removed_sids;
+  sid_set_init(&used_sids);
+  sid_set_init(&removed_sids);
+  LSN_NEW_ARRAY(
+      accepted_nav_meas_ptrs, n_used, const navigation_measurement_t *);
+  u8 n_accepted = 0;
+  u8 n_rejected = 0;
+  bool velocity_used = false;
+
+  for (u8 i = 0; i < n_used; i++) {
+    const navigation_measurement_t *meas = nav_meas_ptrs[i];
+    double h_range[UDU_FILTER_MAX_STATES] = {0};
+    double h_doppler[UDU_FILTER_MAX_STATES] = {0};
+    double pseudorange_var = 0.0;
+    double doppler_var = 0.0;
+    calc_measurement_noises(meas, &pseudorange_var, &doppler_var);
+
+    double p_pred =
+        compute_predicted_pseudorange(clock_map, rx_state, meas, los);
+    for (u8 j = 0; j < 3; j++) {
+      h_range[PVT_FILTER_POS_IDX + j] = -los[j];
+    }
+    h_range[clock_map[sid_to_constellation(meas->sid)]] = 1;
+    double omp_range = nav_meas_cor_sat_clk_on_pseudorange(meas) - p_pred;
+    double z_range = 0.0;
+    bool ok = pvt_filter_gate(
+        filter, rx_state, h_range, omp_range, pseudorange_var, &z_range);
+
+    /* Gate the Doppler before applying either part, a measurement is used
+     * in full or not at all. */
+    bool use_doppler = ok && !disable_velocity &&
+                       (meas->flags & NAV_MEAS_FLAG_MEAS_DOPPLER_VALID);
+    double z_doppler = 0.0;
+    if (use_doppler) {
+      double wavelength = sid_to_lambda(meas->sid);
+      double pdot_pred = compute_predicted_doppler(N_STATE, rx_state, meas);
+      for (u8 j = 0; j < 3; j++) {
+        h_doppler[PVT_FILTER_VEL_IDX + j] = -los[j];
+      }
+      h_doppler[PVT_FILTER_DRIFT_IDX] = 1;
+      double omp_doppler =
+          -nav_meas_cor_sat_clk_on_measured_doppler(meas) * wavelength -
+          pdot_pred;
+      doppler_var *= wavelength * wavelength;
+      ok = pvt_filter_gate(
+          filter, rx_state, h_doppler, omp_doppler, doppler_var, &z_doppler);
+    }
+
+    if (ok) {
+      ok = 0 ==
+           udu_filter_update(&filter->kf, h_range, z_range, pseudorange_var);
+    }
+    /* The pseudorange is in the filter by now, so a failed Doppler update
+     * only leaves the velocity without this measurement. */
+    if (ok && use_doppler &&
+        0 == udu_filter_update(
+                 &filter->kf, h_doppler, z_doppler, doppler_var)) {
+      velocity_used = true;
+    }
+
+    if (ok) {
+      accepted_nav_meas_ptrs[n_accepted++] = meas;
+      sid_set_add(&used_sids, meas->sid);
+    } else {
+      log_debug_sid(meas->sid, "Position filter rejected measurement");
+      sid_set_add(&removed_sids, meas->sid);
+      n_rejected++;
+    }
+  }
+
+  s8 ret = (n_rejected > 0) ? PVT_CONVERGED_RAIM_REPAIR : PVT_CONVERGED_RAIM_OK;
+  if (n_rejected > 1 && n_rejected > n_accepted) {
+    /* The filter most likely diverged, start over from a single epoch
+     * solution on the next call. */
+    log_info("Position filter rejected %u of %u measurements, resetting",
+             n_rejected,
+             n_used);
+    pvt_filter_reset(filter);
+    ret = PVT_RAIM_REPAIR_FAILED;
+  } else if (0 == n_accepted) {
+    ret = PVT_INSUFFICENT_MEAS;
+  }
+  if (ret < 0) {
+    memset(soln, 0, sizeof(*soln));
+    LSN_FREE_ARRAY(accepted_nav_meas_ptrs);
+    LSN_FREE_ARRAY(nav_meas_ptrs);
+    return ret;
+  }
+
+  const double *x = filter->kf.x;
+  double P[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+  udu_filter_get_covariance(&filter->kf, P);
+  const u32 n = PVT_FILTER_N_STATES;
+
+  memset(soln, 0, sizeof(*soln));
+  for (u8 i = 0; i < 3; i++) {
+    soln->pos_ecef[i] = x[PVT_FILTER_POS_IDX + i];
+    soln->vel_ecef[i] = disable_velocity ? 0 : x[PVT_FILTER_VEL_IDX + i];
+  }
+  const u8 cov_row[6] = {0, 0, 0, 1, 1, 2};
+  const u8 cov_col[6] = {0, 1, 2, 1, 2, 2};
+  for (u8 i = 0; i < 6; i++) {
+    soln->err_cov[i] = P[(PVT_FILTER_POS_IDX + cov_row[i]) * n +
+                         PVT_FILTER_POS_IDX + cov_col[i]];
+    if (!disable_velocity) {
+      soln->vel_cov[i] = P[(PVT_FILTER_VEL_IDX + cov_row[i]) * n +
+                           PVT_FILTER_VEL_IDX + cov_col[i]];
+    }
+  }
+  ned_frame_t frame;
+  ned_frame_init_ecef(&frame, soln->pos_ecef);
+  memcpy(soln->pos_llh, frame.ref_llh, sizeof(soln->pos_llh));
+  ned_frame_ecef2ned(&frame, soln->vel_ecef, soln->vel_ned);
+
+  /* Report the GPS clock when available, otherwise the first constellation
+   * in use. */
+  constellation_t clock_constellation =
+      sid_to_constellation(accepted_nav_meas_ptrs[0]->sid);
+  if (filter->clock_initialized[CONSTELLATION_GPS]) {
+    clock_constellation = CONSTELLATION_GPS;
+  }
+  u32 clock_idx = (u32)clock_map[clock_constellation];
+  soln->clock_offset = x[clock_idx] / GPS_C;
+  soln->clock_offset_var = P[clock_idx * n + clock_idx] / GPS_C / GPS_C;
+  soln->clock_drift = x[PVT_FILTER_DRIFT_IDX] / GPS_C;
+  soln->clock_drift_var =
+      P[PVT_FILTER_DRIFT_IDX * n + PVT_FILTER_DRIFT_IDX] / GPS_C / GPS_C;
+  soln->time = *tor;
+  soln->time.tow -= soln->clock_offset;
+  normalize_gps_time(&soln->time);
+  soln->n_sigs_used = n_accepted;
+  soln->n_sats_used = sid_set_get_sat_count(&used_sids);
+
+  /* DOPs describe the geometry of this epoch only */
+  memset(dops, 0, sizeof(*dops));
+  s8 dop_clock_map[CONSTELLATION_COUNT];
+  memset(dop_clock_map, -1, sizeof(dop_clock_map));
+  u8 n_states = 3;
+  for (u8 i = 0; i < n_accepted; i++) {
+    constellation_t c = sid_to_constellation(accepted_nav_meas_ptrs[i]->sid);
+    if (-1 == dop_clock_map[c]) {
+      dop_clock_map[c] = n_states++;
+    }
+  }
+  if (n_accepted >= n_states) {
+    LSN_NEW_ARRAY(G, n_accepted * n_states, double);
+    double H[N_STATE * N_STATE];
+    memcpy(rx_state, x, PVT_FILTER_N_STATES * sizeof(double));
+    for (u8 i = 0; i < n_accepted; i++) {
+      compute_predicted_pseudorange(
+          clock_map, rx_state, accepted_nav_meas_ptrs[i], los);
+      for (u8 j = 0; j < 3; j++) {
+        G[i * n_states + j] = -los[j];
+      }
+      constellation_t c = sid_to_constellation(accepted_nav_meas_ptrs[i]->sid);
+      G[i * n_states + dop_clock_map[c]] = 1;
+    }
+    /* Only the covariance is needed, so no residuals are passed */
+    if (matrix_wlsq_solve(n_accepted, n_states, G, NULL, NULL, NULL, H) >= 0) {
+      compute_dops(n_states, H, rx_state, dops);
+      soln->err_cov[6] = dops->gdop;
+      soln->vel_cov[6] = dops->gdop;
+    }
+    LSN_FREE_ARRAY(G);
+  }
+
+  /* The estimate carries information from previous epochs, so a poor
+   * geometry in this epoch alone is not a reason to drop it. The altitude
+   * and velocity checks still apply. */
+  s8 filter_ret = check_solution_limits(soln);
+  if (0 != filter_ret) {
+    memset(soln, 0, sizeof(*soln));
+    pvt_filter_reset(filter);
+    LSN_FREE_ARRAY(accepted_nav_meas_ptrs);
+    LSN_FREE_ARRAY(nav_meas_ptrs);
+    return filter_ret;
+  }
+
+  soln->valid = 1;
+  soln->velocity_valid = velocity_used ? 1 : 0;
+
+  if (PVT_CONVERGED_RAIM_REPAIR == ret && NULL != rejected_sids) {
+    *rejected_sids = removed_sids;
+  }
+
+  LSN_FREE_ARRAY(accepted_nav_meas_ptrs);
+  LSN_FREE_ARRAY(nav_meas_ptrs);
+  return ret;
+}
+
 u8 get_max_channels(void) { return MAX_CHANNELS; }
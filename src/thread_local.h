@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef LIBSWIFTNAV_THREAD_LOCAL_H
+#define LIBSWIFTNAV_THREAD_LOCAL_H
+
+/* Storage class specifier for the per thread caches of the library.
+ *
+ * SWIFTNAV_THREAD_LOCAL is left undefined if the compiler offers no thread
+ * local storage, or if LIBSWIFTNAV_DISABLE_THREAD_LOCAL is defined for
+ * platforms that cannot use it. Each cache then falls back to working
+ * without stored state. */
+#if !defined(LIBSWIFTNAV_DISABLE_THREAD_LOCAL)
+#if defined(__GNUC__) || defined(__clang__)
+#define SWIFTNAV_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define SWIFTNAV_THREAD_LOCAL __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define SWIFTNAV_THREAD_LOCAL _Thread_local
+#endif
+#endif
+
+#endif /* LIBSWIFTNAV_THREAD_LOCAL_H */
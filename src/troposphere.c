@@ -11,6 +11,7 @@
  */
 
 #include <math.h>
+#include <string.h>
 #include <swiftnav/common.h>
 #include <swiftnav/constants.h>
 #include <swiftnav/troposphere.h>
@@ -126,7 +127,21 @@ static double calc_param(double lat,
   return avg - amp * cos((doy - doy_0) * doy_2_rad);
 }
 
-/** Calculate tropospheric delay using UNM3m model.
+/** Neil mapping function with continued fraction coefficients a, b, c. */
+static double neil_mapping(double sin_el,
+                           double top,
+                           double a,
+                           double b,
+                           double c) {
+  return top / (sin_el + a / (sin_el + b / (sin_el + c)));
+}
+
+/** Calculate the zenith delays and mapping function coefficients of the
+ * UNB3m model at a receiver position and time.
+ *
+ * Everything except the final mapping to the satellite elevation depends
+ * only on the receiver, so this needs computing once per epoch and the
+ * result can be mapped to each satellite with calc_troposphere_slant().
  *
  * References:
  *   -# UNB Neutral Atmosphere Models: Development and Performance. R Leandro,
@@ -135,13 +150,13 @@ static double calc_param(double lat,
  * \param doy time at which to calculate tropospheric delay [day of year]
  * \param lat Latitude of the receiver [rad]
  * \param h Orthometric height of the receiver (height above the geoid) [m]
- * \param el Elevation of the satellite [rad]
- *
- * \return Tropospheric delay distance [m]
+ * \param zenith Zenith delays and mapping function coefficients
  */
-double calc_troposphere(const double doy, double lat, double h, double el) {
+void calc_troposphere_zenith(const double doy,
+                             double lat,
+                             double h,
+                             tropo_zenith_t *zenith) {
   lat *= R2D;
-  el *= R2D;
 
   /* The troposphere is defined as the region from the Earth's surface to 11km
    * altitude (see the ICAO International Standard Atmosphere). Above this
@@ -153,7 +168,11 @@ double calc_troposphere(const double doy, double lat, double h, double el) {
    * this height.
    */
   if (h > MAX_ALTITUDE) {
-    return 0.0;
+    /* Zero delays with finite mapping coefficients map to zero delay */
+    memset(zenith, 0, sizeof(*zenith));
+    zenith->mhf_top = 1.0;
+    zenith->mwf_top = 1.0;
+    return;
   }
 
   /* truncate negative altitudes */
@@ -161,11 +180,6 @@ double calc_troposphere(const double doy, double lat, double h, double el) {
     h = 0.0;
   }
 
-  /* truncate negative/near zero elevations to avoid divisions by zero */
-  if (el < MIN_SAT_ELEVATION) {
-    el = MIN_SAT_ELEVATION;
-  }
-
   /* Compute surface tropo values */
   double p_0 = calc_param(lat, doy, p_avg_lut, p_amp_lut);
   double t_0 = calc_param(lat, doy, t_avg_lut, t_amp_lut);
@@ -218,47 +232,111 @@ double calc_troposphere(const double doy, double lat, double h, double el) {
   double t_m = t * (1.0 - b * r_d / den);
 
   /* Compute zenith hydrostatic delay */
-  double zhd = c_1 / d_g_ref * p;
+  zenith->zhd = c_1 / d_g_ref * p;
 
   /* Compute zenith wet delay */
-  double zwd = 1e-6 * (k_2_prim + k_3 / t_m) * r_d * e / den;
+  zenith->zwd = 1e-6 * (k_2_prim + k_3 / t_m) * r_d * e / den;
 
   /* Compute hydrostatic Neil mapping function coeffcient values */
-  double mhf_a = calc_param(lat, doy, mhf_a_avg_lut, mhf_a_amp_lut);
-  double mhf_b = calc_param(lat, doy, mhf_b_avg_lut, mhf_b_amp_lut);
-  double mhf_c = calc_param(lat, doy, mhf_c_avg_lut, mhf_c_amp_lut);
+  zenith->mhf_a = calc_param(lat, doy, mhf_a_avg_lut, mhf_a_amp_lut);
+  zenith->mhf_b = calc_param(lat, doy, mhf_b_avg_lut, mhf_b_amp_lut);
+  zenith->mhf_c = calc_param(lat, doy, mhf_c_avg_lut, mhf_c_amp_lut);
+  zenith->mhf_top =
+      1.0 + zenith->mhf_a / (1.0 + zenith->mhf_b / (1.0 + zenith->mhf_c));
+
+  /* Height correction of the hydrostatic mapping function */
+  zenith->h = h;
+
+  /* Compute wet Neil mapping function coeffcient values */
+  zenith->mwf_a = lookup_param(lat, mwf_a_lut);
+  zenith->mwf_b = lookup_param(lat, mwf_b_lut);
+  zenith->mwf_c = lookup_param(lat, mwf_c_lut);
+  zenith->mwf_top =
+      1.0 + zenith->mwf_a / (1.0 + zenith->mwf_b / (1.0 + zenith->mwf_c));
+}
+
+/** Map zenith delays computed by calc_troposphere_zenith() to a satellite
+ * elevation.
+ *
+ * \param zenith Zenith delays and mapping function coefficients
+ * \param el Elevation of the satellite [rad]
+ *
+ * \return Tropospheric delay distance [m]
+ */
+double calc_troposphere_slant(const tropo_zenith_t *zenith, double el) {
+  el *= R2D;
+
+  /* truncate negative/near zero elevations to avoid divisions by zero */
+  if (el < MIN_SAT_ELEVATION) {
+    el = MIN_SAT_ELEVATION;
+  }
 
   /* Compute hydrostatic Neil mapping function value */
   double sin_el = sin(el * D2R);
-  double mhf_top = 1.0 + mhf_a / (1.0 + mhf_b / (1.0 + mhf_c));
-  double mhf_bot = sin_el + mhf_a / (sin_el + mhf_b / (sin_el + mhf_c));
-  double mhf = mhf_top / mhf_bot;
+  double mhf = neil_mapping(
+      sin_el, zenith->mhf_top, zenith->mhf_a, zenith->mhf_b, zenith->mhf_c);
 
   /* Compute height correction */
   const double mhf_a_ht = 2.53e-5;
   const double mhf_b_ht = 5.49e-3;
   const double mhf_c_ht = 1.14e-3;
-  double mhf_top_ht = 1.0 + mhf_a_ht / (1.0 + mhf_b_ht / (1.0 + mhf_c_ht));
-  double mhf_bot_ht =
-      sin_el + mhf_a_ht / (sin_el + mhf_b_ht / (sin_el + mhf_c_ht));
-  double mhf_ht_coef = 1.0 / sin_el - mhf_top_ht / mhf_bot_ht;
-  double mhf_ht = mhf_ht_coef * h / 1000.0;
-  mhf += mhf_ht;
-
-  /* Compute wet Neil mapping function coeffcient values */
-  double mwf_a = lookup_param(lat, mwf_a_lut);
-  double mwf_b = lookup_param(lat, mwf_b_lut);
-  double mwf_c = lookup_param(lat, mwf_c_lut);
+  const double mhf_top_ht =
+      1.0 + mhf_a_ht / (1.0 + mhf_b_ht / (1.0 + mhf_c_ht));
+  double mhf_ht_coef =
+      1.0 / sin_el -
+      neil_mapping(sin_el, mhf_top_ht, mhf_a_ht, mhf_b_ht, mhf_c_ht);
+  mhf += mhf_ht_coef * zenith->h / 1000.0;
 
   /* Compute wet Neil mapping function value */
-  double mwf_top = 1.0 + mwf_a / (1.0 + mwf_b / (1.0 + mwf_c));
-  double mwf_bot = sin_el + mwf_a / (sin_el + mwf_b / (sin_el + mwf_c));
-  double mwf = mwf_top / mwf_bot;
+  double mwf = neil_mapping(
+      sin_el, zenith->mwf_top, zenith->mwf_a, zenith->mwf_b, zenith->mwf_c);
 
   /* Compute total tropospheric delay */
-  double td = mhf * zhd + mwf * zwd;
+  return mhf * zenith->zhd + mwf * zenith->zwd;
+}
+
+/** Map zenith delays computed by calc_troposphere_zenith() to several
+ * satellite elevations.
+ *
+ * \param zenith Zenith delays and mapping function coefficients
+ * \param n Number of satellites
+ * \param el Elevations of the satellites [rad]
+ * \param delay Tropospheric delay distances [m]
+ */
+void calc_troposphere_slant_batch(const tropo_zenith_t *zenith,
+                                  size_t n,
+                                  const double *el,
+                                  double *delay) {
+  for (size_t i = 0; i < n; i++) {
+    delay[i] = calc_troposphere_slant(zenith, el[i]);
+  }
+}
 
-  return td;
+/** Calculate tropospheric delay using UNM3m model.
+ *
+ * Equivalent to calc_troposphere_zenith() followed by
+ * calc_troposphere_slant(). When computing the delay to several satellites
+ * from one position use those directly, as the zenith part is the bulk of
+ * the cost.
+ *
+ * References:
+ *   -# UNB Neutral Atmosphere Models: Development and Performance. R Leandro,
+ *      M Santos, and R B Langley
+ *
+ * \param doy time at which to calculate tropospheric delay [day of year]
+ * \param lat Latitude of the receiver [rad]
+ * \param h Orthometric height of the receiver (height above the geoid) [m]
+ * \param el Elevation of the satellite [rad]
+ *
+ * \return Tropospheric delay distance [m]
+ */
+double calc_troposphere(const double doy, double lat, double h, double el) {
+  if (h > MAX_ALTITUDE) {
+    return 0.0;
+  }
+  tropo_zenith_t zenith;
+  calc_troposphere_zenith(doy, lat, h, &zenith);
+  return calc_troposphere_slant(&zenith, el);
 }
 
 /** \} */
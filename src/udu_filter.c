@@ -0,0 +1,301 @@
+/*
+ * Copyright (C) 2026 Swift Navigation Inc.
+ * Contact: Swift Navigation <dev@swiftnav.com>
+ *
+ * This source is subject to the license found in the file 'LICENSE' which must
+ * be distributed together with this source. All other rights reserved.
+ *
+ * THIS CODE AND INFORMATION IS PROVIDED "AS IS" WITHOUT WARRANTY OF ANY KIND,
+ * EITHER EXPRESSED OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND/OR FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include <swiftnav/linear_algebra.h>
+#include <swiftnav/udu_filter.h>
+
+/** \defgroup udu_filter UDU Kalman Filter
+ * Kalman filter operating directly on the \f$U D U^{T}\f$ factors of the
+ * state covariance.
+ *
+ * Measurements are processed one scalar at a time with Bierman's update and
+ * the covariance is propagated with Thornton's modified weighted
+ * Gram-Schmidt time update. Neither step forms or inverts a full covariance
+ * matrix, so each scalar measurement costs \f$O(n^2)\f$ and the factors stay
+ * positive semi-definite by construction.
+ *
+ * References:
+ *   -# Bierman, Gerald J. "Factorization Methods for Discrete Sequential
+ *      Estimation." Academic Press, 1977.
+ *   -# Grewal, Mohinder S. and Andrews, Angus P. "Kalman Filtering: Theory
+ *      and Practice Using MATLAB." John Wiley & Sons, Inc., 2008.
+ * \{ */
+
+/** Initialise a filter from a full covariance matrix.
+ *
+ * \param f      Filter to initialise.
+ * \param n      Number of states, at most `UDU_FILTER_MAX_STATES`.
+ * \param x      Initial state estimate, length `n`.
+ * \param P      Initial `n` x `n` symmetric positive semi-definite covariance.
+ */
+void udu_filter_init(udu_filter_t *f,
+                     u32 n,
+                     const double *x,
+                     const double *P) {
+  assert(n > 0 && n <= UDU_FILTER_MAX_STATES);
+  memset(f, 0, sizeof(*f));
+  f->n = n;
+  memcpy(f->x, x, n * sizeof(double));
+  /* matrix_udu() destroys its input, use the scratch space as a copy. */
+  memcpy(f->work, P, n * n * sizeof(double));
+  matrix_udu(n, f->work, f->U, f->D);
+}
+
+/** Initialise a filter with a diagonal covariance matrix.
+ *
+ * \param f      Filter to initialise.
+ * \param n      Number of states, at most `UDU_FILTER_MAX_STATES`.
+ * \param x      Initial state estimate, length `n`.
+ * \param P_diag Initial state variances, length `n`.
+ */
+void udu_filter_init_diag(udu_filter_t *f,
+                          u32 n,
+                          const double *x,
+                          const double *P_diag) {
+  assert(n > 0 && n <= UDU_FILTER_MAX_STATES);
+  memset(f, 0, sizeof(*f));
+  f->n = n;
+  memcpy(f->x, x, n * sizeof(double));
+  matrix_eye(n, f->U);
+  memcpy(f->D, P_diag, n * sizeof(double));
+}
+
+/** Reconstruct the full state covariance \f$P = U D U^{T}\f$.
+ *
+ * \param f      Filter.
+ * \param P      Output `n` x `n` covariance matrix.
+ */
+void udu_filter_get_covariance(const udu_filter_t *f, double *P) {
+  matrix_reconstruct_udu(f->n, f->U, f->D, P);
+}
+
+/** Compute \f$U^{T} h\f$ exploiting the unit upper triangular structure. */
+static void ut_times_vector(u32 n,
+                            const double *U,
+                            const double *h,
+                            double *a) {
+  for (u32 j = 0; j < n; j++) {
+    double s = h[j];
+    for (u32 i = 0; i < j; i++) {
+      s += U[i * n + j] * h[i];
+    }
+    a[j] = s;
+  }
+}
+
+/** Innovation variance \f$h P h^{T} + r\f$ of a scalar measurement.
+ *
+ * Useful for gating a measurement before committing to the update.
+ *
+ * \param f      Filter.
+ * \param h      Measurement row, length `n`.
+ * \param r      Measurement noise variance.
+ *
+ * \return The innovation variance.
+ */
+double udu_filter_innovation_variance(const udu_filter_t *f,
+                                      const double *h,
+                                      double r) {
+  double a[UDU_FILTER_MAX_STATES];
+  ut_times_vector(f->n, f->U, h, a);
+  double alpha = r;
+  for (u32 j = 0; j < f->n; j++) {
+    alpha += f->D[j] * a[j] * a[j];
+  }
+  return alpha;
+}
+
+/** Bierman scalar measurement update.
+ *
+ * Incorporates the measurement \f$z = h x + v\f$, \f$v \sim N(0, r)\f$ into
+ * the state and updates the \f$U\f$ and \f$D\f$ factors in place.
+ *
+ * For an extended filter linearised about \f$x_0\f$, pass
+ * \f$z - h(x_0) + h x_0\f$ as the measurement so that the innovation stays
+ * correct when several measurements are applied sequentially.
+ *
+ * \param f      Filter to update.
+ * \param h      Measurement row, length `n`.
+ * \param z      Measurement.
+ * \param r      Measurement noise variance, must be positive.
+ *
+ * \return 0 on success, -1 if the measurement was rejected.
+ */
+s8 udu_filter_update(udu_filter_t *f, const double *h, double z, double r) {
+  if (!(r > 0) || !isfinite(z)) {
+    return -1;
+  }
+
+  u32 n = f->n;
+  double *U = f->U;
+  double *D = f->D;
+  double a[UDU_FILTER_MAX_STATES];
+  double b[UDU_FILTER_MAX_STATES];
+
+  double innov = z - vector_dot(n, h, f->x);
+
+  /* a = U^T h, b = D a */
+  ut_times_vector(n, U, h, a);
+  for (u32 j = 0; j < n; j++) {
+    b[j] = D[j] * a[j];
+  }
+
+  double alpha = r;
+  double gamma = 1.0 / alpha;
+  for (u32 j = 0; j < n; j++) {
+    double beta = alpha;
+    alpha += a[j] * b[j];
+    double lambda = -a[j] * gamma;
+    gamma = 1.0 / alpha;
+    D[j] *= beta * gamma;
+    for (u32 i = 0; i < j; i++) {
+      beta = U[i * n + j];
+      U[i * n + j] = beta + b[i] * lambda;
+      b[i] += b[j] * beta;
+    }
+  }
+
+  /* Unscaled gain is left in b, K = b / alpha. */
+  double k = innov * gamma;
+  for (u32 i = 0; i < n; i++) {
+    f->x[i] += b[i] * k;
+  }
+
+  return 0;
+}
+
+/** Sequentially apply uncorrelated scalar measurements.
+ *
+ * Equivalent to a single vector update with a diagonal measurement noise
+ * covariance, without inverting the innovation covariance. Correlated
+ * measurements must be decorrelated by the caller first.
+ *
+ * \param f      Filter to update.
+ * \param m      Number of measurements.
+ * \param H      `m` x `n` measurement matrix.
+ * \param z      Measurements, length `m`.
+ * \param r      Measurement noise variances, length `m`.
+ *
+ * \return 0 on success, -1 if any measurement was rejected. Rejected
+ *         measurements are skipped and the remaining ones still applied.
+ */
+s8 udu_filter_update_sequential(udu_filter_t *f,
+                                u32 m,
+                                const double *H,
+                                const double *z,
+                                const double *r) {
+  s8 ret = 0;
+  for (u32 i = 0; i < m; i++) {
+    if (udu_filter_update(f, &H[i * f->n], z[i], r[i]) < 0) {
+      ret = -1;
+    }
+  }
+  return ret;
+}
+
+/** Thornton time update.
+ *
+ * Propagates the state and covariance factors through
+ * \f$x := \Phi x\f$, \f$P := \Phi P \Phi^{T} + G Q G^{T}\f$ using modified
+ * weighted Gram-Schmidt orthogonalisation, with \f$Q\f$ diagonal.
+ *
+ * \param f      Filter to propagate.
+ * \param Phi    `n` x `n` state transition matrix, or NULL for identity.
+ * \param p      Number of process noise inputs, at most
+ *               `UDU_FILTER_MAX_NOISE`.
+ * \param G      `n` x `p` noise input matrix, or NULL for identity (in which
+ *               case `p` must equal `n`).
+ * \param Q_diag Process noise variances, length `p`.
+ *
+ * \return 0 on success, -1 on invalid dimensions.
+ */
+s8 udu_filter_predict(udu_filter_t *f,
+                      const double *Phi,
+                      u32 p,
+                      const double *G,
+                      const double *Q_diag) {
+  u32 n = f->n;
+  if (p > UDU_FILTER_MAX_NOISE || (NULL == G && 0 != p && p != n)) {
+    return -1;
+  }
+
+  u32 w = n + p;
+  double *W = f->work;
+  double *U = f->U;
+  double Dw[UDU_FILTER_MAX_STATES + UDU_FILTER_MAX_NOISE];
+
+  /* W = [Phi U | G], Dw = [D | Q] */
+  for (u32 i = 0; i < n; i++) {
+    for (u32 j = 0; j < n; j++) {
+      double s;
+      if (NULL == Phi) {
+        s = U[i * n + j];
+      } else {
+        s = Phi[i * n + j];
+        for (u32 k = 0; k < j; k++) {
+          s += Phi[i * n + k] * U[k * n + j];
+        }
+      }
+      W[i * w + j] = s;
+    }
+    for (u32 j = 0; j < p; j++) {
+      if (NULL == G) {
+        W[i * w + n + j] = (i == j) ? 1.0 : 0.0;
+      } else {
+        W[i * w + n + j] = G[i * p + j];
+      }
+    }
+  }
+  memcpy(Dw, f->D, n * sizeof(double));
+  for (u32 j = 0; j < p; j++) {
+    Dw[n + j] = Q_diag[j];
+  }
+
+  if (NULL != Phi) {
+    double x[UDU_FILTER_MAX_STATES];
+    matrix_multiply(n, n, 1, Phi, f->x, x);
+    memcpy(f->x, x, n * sizeof(double));
+  }
+
+  matrix_eye(n, U);
+  for (u32 k = n; k-- > 0;) {
+    double *Wk = &W[k * w];
+    double c[UDU_FILTER_MAX_STATES + UDU_FILTER_MAX_NOISE];
+    double sigma = 0;
+    for (u32 j = 0; j < w; j++) {
+      c[j] = Dw[j] * Wk[j];
+      sigma += Wk[j] * c[j];
+    }
+    f->D[k] = sigma;
+    if (!(sigma > 0)) {
+      /* Zero variance direction, the remaining rows are unaffected. */
+      f->D[k] = 0;
+      continue;
+    }
+    double inv_sigma = 1.0 / sigma;
+    for (u32 i = 0; i < k; i++) {
+      double *Wi = &W[i * w];
+      double u = vector_dot(w, Wi, c) * inv_sigma;
+      U[i * n + k] = u;
+      for (u32 j = 0; j < w; j++) {
+        Wi[j] -= u * Wk[j];
+      }
+    }
+  }
+
+  return 0;
+}
+
+/** \} */
@@ -2,6 +2,7 @@
 #include <inttypes.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <swiftnav/bits.h>
 #include <time.h>
 
@@ -380,6 +381,97 @@ START_TEST(test_endianess) {
 }
 END_TEST
 
+/* Bit at a time reference implementations of the bit field functions. */
+static u64 ref_getbitul(const u8 *buff, u32 pos, u32 len) {
+  u64 bits = 0;
+  for (u32 i = pos; i < pos + len; i++) {
+    bits = (bits << 1) + ((buff[i / 8] >> (7 - i % 8)) & 1u);
+  }
+  return bits;
+}
+
+static void ref_setbitul(u8 *buff, u32 pos, u32 len, u64 data) {
+  for (u32 i = pos; i < pos + len; i++) {
+    if ((data >> (pos + len - 1 - i)) & 1u) {
+      buff[i / 8] |= (u8)(1u << (7 - i % 8));
+    } else {
+      buff[i / 8] &= (u8)~(1u << (7 - i % 8));
+    }
+  }
+}
+
+START_TEST(test_bitfield_reference) {
+  u8 buff[16];
+  u8 expected[16];
+  u8 actual[16];
+  for (u32 i = 0; i < sizeof(buff); i++) {
+    buff[i] = (u8)(rand() & 0xFF);
+  }
+
+  /* every bit offset within a word and every length */
+  for (u32 pos = 0; pos <= 64; pos++) {
+    for (u32 len = 0; len <= 64; len++) {
+      u64 ref = ref_getbitul(buff, pos, len);
+      fail_unless(getbitul(buff, pos, (u8)len) == ref,
+                  "getbitul mismatch (pos %u, len %u)",
+                  pos,
+                  len);
+      if (len <= 32) {
+        fail_unless(getbitu(buff, pos, (u8)len) == (u32)ref,
+                    "getbitu mismatch (pos %u, len %u)",
+                    pos,
+                    len);
+      }
+
+      u64 data = ((u64)rand() << 40) ^ ((u64)rand() << 20) ^ (u64)rand();
+      memcpy(expected, buff, sizeof(buff));
+      memcpy(actual, buff, sizeof(buff));
+      ref_setbitul(expected, pos, len, data);
+      setbitul(actual, pos, len, data);
+      fail_unless(memcmp(actual, expected, sizeof(buff)) == 0,
+                  "setbitul mismatch (pos %u, len %u)",
+                  pos,
+                  len);
+      if (len <= 32) {
+        memcpy(actual, buff, sizeof(buff));
+        setbitu(actual, pos, len, (u32)data);
+        fail_unless(memcmp(actual, expected, sizeof(buff)) == 0,
+                    "setbitu mismatch (pos %u, len %u)",
+                    pos,
+                    len);
+      }
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_bitfield_buffer_end) {
+  /* Fields ending on the last byte of an exactly sized buffer */
+  for (u32 size = 1; size <= 9; size++) {
+    u8 *buff = (u8 *)malloc(size);
+    fail_unless(buff != NULL);
+    for (u32 len = 1; len <= MIN(64, 8 * size); len++) {
+      u32 pos = 8 * size - len;
+      memset(buff, 0, size);
+      u64 data = ~UINT64_C(0) >> (64 - len);
+      setbitul(buff, pos, len, data);
+      fail_unless(getbitul(buff, pos, (u8)len) == data,
+                  "bad field at buffer end (size %u, len %u)",
+                  size,
+                  len);
+      for (u32 i = 0; i < pos; i++) {
+        fail_unless(ref_getbitul(buff, i, 1) == 0,
+                    "bit %u before the field changed (size %u, len %u)",
+                    i,
+                    size,
+                    len);
+      }
+    }
+    free(buff);
+  }
+}
+END_TEST
+
 Suite *bits_suite(void) {
   Suite *s = suite_create("Bit Utils");
 
@@ -391,6 +483,8 @@ Suite *bits_suite(void) {
   tcase_add_test(tc_core, test_setbitul);
   tcase_add_test(tc_core, test_setbits);
   tcase_add_test(tc_core, test_setbitsl);
+  tcase_add_test(tc_core, test_bitfield_reference);
+  tcase_add_test(tc_core, test_bitfield_buffer_end);
   tcase_add_test(tc_core, test_bitshl);
   tcase_add_test(tc_core, test_bitcopy);
   tcase_add_test(tc_core, test_count_bits_x);
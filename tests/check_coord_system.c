@@ -373,6 +373,349 @@ START_TEST(test_random_wgsecef2ned_d_0) {
 }
 END_TEST
 
+START_TEST(test_wgsecef2llh_closed_form) {
+  srand(5);
+  for (int i = 0; i < 10000; i++) {
+    double ecef[3];
+    if (i < NUM_COORDS) {
+      ecef[0] = ecefs[i][0];
+      ecef[1] = ecefs[i][1];
+      ecef[2] = ecefs[i][2];
+    } else {
+      /* From below the geoid up to geostationary orbit. */
+      const double llh[3] = {
+          D2R * frand(-90, 90), D2R * frand(-180, 180), frand(-1e4, 3.6e7)};
+      wgsllh2ecef(llh, ecef);
+    }
+
+    double llh[3], llh_ref[3];
+    wgsecef2llh(ecef, llh_ref);
+    wgsecef2llh_method(ecef, llh, WGSECEF2LLH_CLOSED_FORM);
+    fail_unless(fabs(llh[0] - llh_ref[0]) < MAX_ANGLE_ERROR_RAD &&
+                    fabs(llh[1] - llh_ref[1]) < MAX_ANGLE_ERROR_RAD &&
+                    fabs(llh[2] - llh_ref[2]) < MAX_DIST_ERROR_M,
+                "Closed form ECEF to LLH differs from iterative.\n"
+                "ECEF: %f, %f, %f\n"
+                "Closed form LLH: %.12f, %.12f, %f\n"
+                "Iterative LLH: %.12f, %.12f, %f",
+                ecef[0],
+                ecef[1],
+                ecef[2],
+                llh[0],
+                llh[1],
+                llh[2],
+                llh_ref[0],
+                llh_ref[1],
+                llh_ref[2]);
+
+    wgsecef2llh_method(ecef, llh, WGSECEF2LLH_ITERATIVE);
+    fail_unless(llh[0] == llh_ref[0] && llh[1] == llh_ref[1] &&
+                    llh[2] == llh_ref[2],
+                "Iterative method selection differs from wgsecef2llh");
+  }
+
+  /* Deep inside the Earth the closed form defers to the iterative method,
+   * between there and the surface it must still be self consistent. */
+  for (int i = 0; i < 1000; i++) {
+    const double radius = frand(0, EARTH_B);
+    double ecef[3] = {frand(-1, 1), frand(-1, 1), frand(-1, 1)};
+    const double scale = radius / sqrt(ecef[0] * ecef[0] + ecef[1] * ecef[1] +
+                                       ecef[2] * ecef[2]);
+    for (int n = 0; n < 3; n++) {
+      ecef[n] *= scale;
+    }
+
+    double llh[3], llh_ref[3], ecef_[3];
+    wgsecef2llh_closed_form(ecef, llh);
+    wgsecef2llh(ecef, llh_ref);
+    wgsllh2ecef(llh, ecef_);
+    if (radius < 0.1 * EARTH_A) {
+      fail_unless(llh[0] == llh_ref[0] && llh[1] == llh_ref[1] &&
+                      llh[2] == llh_ref[2],
+                  "Closed form did not defer to the iterative method");
+    } else if (radius > 0.101 * EARTH_A) {
+      for (int n = 0; n < 3; n++) {
+        fail_unless(fabs(ecef_[n] - ecef[n]) < MAX_DIST_ERROR_M,
+                    "Closed form ECEF to LLH does not round trip.\n"
+                    "ECEF: %f, %f, %f\n"
+                    "LLH: %.12f, %.12f, %f",
+                    ecef[0],
+                    ecef[1],
+                    ecef[2],
+                    llh[0],
+                    llh[1],
+                    llh[2]);
+      }
+    }
+  }
+}
+END_TEST
+
+#define NUM_BATCH 1000
+
+/* Batch conversions must agree with the scalar routines, including for the
+ * special case coordinates, points near the geocenter and lengths not a
+ * multiple of the block size. */
+START_TEST(test_batch_wgsecef2llh) {
+  static double x[NUM_BATCH], y[NUM_BATCH], z[NUM_BATCH];
+  static double lat[NUM_BATCH], lon[NUM_BATCH], hgt[NUM_BATCH];
+
+  srand(1);
+  for (int i = 0; i < NUM_BATCH; i++) {
+    if (i < NUM_COORDS) {
+      x[i] = ecefs[i][0];
+      y[i] = ecefs[i][1];
+      z[i] = ecefs[i][2];
+    } else if (i < 2 * NUM_COORDS) {
+      x[i] = frand(-0.2 * EARTH_A, 0.2 * EARTH_A);
+      y[i] = frand(-0.2 * EARTH_A, 0.2 * EARTH_A);
+      z[i] = frand(-0.2 * EARTH_A, 0.2 * EARTH_A);
+    } else {
+      x[i] = frand(-4 * EARTH_A, 4 * EARTH_A);
+      y[i] = frand(-4 * EARTH_A, 4 * EARTH_A);
+      z[i] = frand(-4 * EARTH_A, 4 * EARTH_A);
+    }
+  }
+  x[2 * NUM_COORDS] = y[2 * NUM_COORDS] = z[2 * NUM_COORDS] = 0;
+
+  size_t n = NUM_BATCH - 3;
+  wgsecef2llh_batch(n, x, y, z, lat, lon, hgt);
+
+  for (size_t i = 0; i < n; i++) {
+    double ecef[3] = {x[i], y[i], z[i]};
+    double llh[3];
+    wgsecef2llh(ecef, llh);
+    fail_unless(fabs(lat[i] - llh[0]) < MAX_ANGLE_ERROR_RAD &&
+                    fabs(lon[i] - llh[1]) < MAX_ANGLE_ERROR_RAD &&
+                    fabs(hgt[i] - llh[2]) < MAX_DIST_ERROR_M,
+                "Batch ECEF to LLH differs from scalar at %zu.\n"
+                "ECEF: %f, %f, %f\n"
+                "Batch LLH: %.12f, %.12f, %f\n"
+                "Scalar LLH: %.12f, %.12f, %f",
+                i,
+                x[i],
+                y[i],
+                z[i],
+                lat[i],
+                lon[i],
+                hgt[i],
+                llh[0],
+                llh[1],
+                llh[2]);
+  }
+
+  /* Converting in place gives the same answer. */
+  wgsecef2llh_batch(n, x, y, z, x, y, z);
+  for (size_t i = 0; i < n; i++) {
+    fail_unless(x[i] == lat[i] && y[i] == lon[i] && z[i] == hgt[i],
+                "In place batch ECEF to LLH differs at %zu",
+                i);
+  }
+}
+END_TEST
+
+/* From below the geoid to geostationary orbit the batch conversion must stay
+ * within its documented agreement with the scalar routine. */
+START_TEST(test_batch_wgsecef2llh_precision) {
+  static double x[NUM_BATCH], y[NUM_BATCH], z[NUM_BATCH];
+  static double lat[NUM_BATCH], lon[NUM_BATCH], hgt[NUM_BATCH];
+
+  srand(5);
+  for (int i = 0; i < NUM_BATCH; i++) {
+    double llh[3] = {
+        D2R * frand(-90, 90), D2R * frand(-180, 180), frand(-1e4, 3.6e7)};
+    double ecef[3];
+    wgsllh2ecef(llh, ecef);
+    x[i] = ecef[0];
+    y[i] = ecef[1];
+    z[i] = ecef[2];
+  }
+
+  wgsecef2llh_batch(NUM_BATCH, x, y, z, lat, lon, hgt);
+
+  for (int i = 0; i < NUM_BATCH; i++) {
+    double ecef[3] = {x[i], y[i], z[i]};
+    double llh[3];
+    wgsecef2llh(ecef, llh);
+    fail_unless(fabs(lat[i] - llh[0]) < 2e-15 &&
+                    fabs(lon[i] - llh[1]) < 2e-15 &&
+                    fabs(hgt[i] - llh[2]) < 1e-7,
+                "Batch ECEF to LLH outside error bound at %d.\n"
+                "Lat error (rad): %g\nLon error (rad): %g\nH error (m): %g",
+                i,
+                lat[i] - llh[0],
+                lon[i] - llh[1],
+                hgt[i] - llh[2]);
+  }
+}
+END_TEST
+
+START_TEST(test_batch_wgsllh2ecef) {
+  static double lat[NUM_BATCH], lon[NUM_BATCH], hgt[NUM_BATCH];
+  static double x[NUM_BATCH], y[NUM_BATCH], z[NUM_BATCH];
+
+  srand(2);
+  for (int i = 0; i < NUM_BATCH; i++) {
+    if (i < NUM_COORDS) {
+      lat[i] = llhs[i][0];
+      lon[i] = llhs[i][1];
+      hgt[i] = llhs[i][2];
+    } else {
+      lat[i] = D2R * frand(-90, 90);
+      lon[i] = D2R * frand(-180, 180);
+      hgt[i] = frand(-0.5 * EARTH_A, 4 * EARTH_A);
+    }
+  }
+
+  wgsllh2ecef_batch(NUM_BATCH, lat, lon, hgt, x, y, z);
+
+  for (int i = 0; i < NUM_BATCH; i++) {
+    double llh[3] = {lat[i], lon[i], hgt[i]};
+    double ecef[3];
+    wgsllh2ecef(llh, ecef);
+    fail_unless(fabs(x[i] - ecef[0]) < MAX_DIST_ERROR_M &&
+                    fabs(y[i] - ecef[1]) < MAX_DIST_ERROR_M &&
+                    fabs(z[i] - ecef[2]) < MAX_DIST_ERROR_M,
+                "Batch LLH to ECEF differs from scalar at %d.\n"
+                "Batch ECEF: %f, %f, %f\n"
+                "Scalar ECEF: %f, %f, %f",
+                i,
+                x[i],
+                y[i],
+                z[i],
+                ecef[0],
+                ecef[1],
+                ecef[2]);
+  }
+
+  wgsllh2ecef_batch(NUM_BATCH, lat, lon, hgt, lat, lon, hgt);
+  for (int i = 0; i < NUM_BATCH; i++) {
+    fail_unless(lat[i] == x[i] && lon[i] == y[i] && hgt[i] == z[i],
+                "In place batch LLH to ECEF differs at %d",
+                i);
+  }
+}
+END_TEST
+
+/* The fast conversion must stay within its documented error bounds. */
+START_TEST(test_batch_wgsecef2llh_fast) {
+  static double x[NUM_BATCH], y[NUM_BATCH], z[NUM_BATCH];
+  static double lat[NUM_BATCH], lon[NUM_BATCH], hgt[NUM_BATCH];
+  /* Height range and the latitude bound that applies within it. */
+  const double ranges[2][3] = {{-1e4, 1e5, 2e-11}, {1e5, 1e7, 1e-8}};
+
+  srand(3);
+  for (int r = 0; r < 2; r++) {
+    for (int i = 0; i < NUM_BATCH; i++) {
+      double llh[3] = {D2R * frand(-90, 90),
+                       D2R * frand(-180, 180),
+                       frand(ranges[r][0], ranges[r][1])};
+      double ecef[3];
+      if (i < NUM_COORDS) {
+        llh[0] = llhs[i][0];
+        llh[1] = llhs[i][1];
+        llh[2] = llhs[i][2];
+      }
+      wgsllh2ecef(llh, ecef);
+      x[i] = ecef[0];
+      y[i] = ecef[1];
+      z[i] = ecef[2];
+    }
+
+    wgsecef2llh_batch_fast(NUM_BATCH, x, y, z, lat, lon, hgt);
+
+    for (int i = 0; i < NUM_BATCH; i++) {
+      double ecef[3] = {x[i], y[i], z[i]};
+      double llh[3];
+      wgsecef2llh(ecef, llh);
+      fail_unless(fabs(lat[i] - llh[0]) < ranges[r][2] &&
+                      fabs(lon[i] - llh[1]) < MAX_ANGLE_ERROR_RAD &&
+                      fabs(hgt[i] - llh[2]) < MAX_DIST_ERROR_M,
+                  "Fast ECEF to LLH outside error bound at %d.\n"
+                  "Lat error (rad): %g\nH error (m): %g",
+                  i,
+                  lat[i] - llh[0],
+                  hgt[i] - llh[2]);
+    }
+  }
+}
+END_TEST
+
+/* A cached local frame must give the same results as the one shot NED and
+ * azimuth/elevation conversions. */
+START_TEST(test_ned_frame) {
+  srand(4);
+  for (int t = 0; t < 100; t++) {
+    double ref_llh[3] = {
+        D2R * frand(-90, 90), D2R * frand(-180, 180), frand(-1e3, 1e4)};
+    double ref_ecef[3];
+    wgsllh2ecef(ref_llh, ref_ecef);
+
+    ned_frame_t frame, frame_llh;
+    ned_frame_init_ecef(&frame, ref_ecef);
+    ned_frame_init_llh(&frame_llh, ref_llh);
+    for (int i = 0; i < 3; i++) {
+      fail_unless(fabs(frame.ref_llh[i] - frame_llh.ref_llh[i]) < 1e-6 &&
+                      fabs(frame.ref_ecef[i] - frame_llh.ref_ecef[i]) < 1e-6,
+                  "Frame references from ECEF and LLH differ");
+      for (int j = 0; j < 3; j++) {
+        fail_unless(fabs(frame.M[i][j] - frame_llh.M[i][j]) < 1e-12,
+                    "Frame rotations from ECEF and LLH differ");
+      }
+    }
+
+    double ecef[4 * 3], ned[4 * 3], az[4], el[4];
+    for (int k = 0; k < 4 * 3; k++) {
+      ecef[k] = frand(-3e7, 3e7);
+    }
+    ned_frame_ecef2ned_d_batch(&frame, 4, ecef, ned);
+    ned_frame_ecef2azel_batch(&frame, 4, ecef, az, el);
+
+    for (int k = 0; k < 4; k++) {
+      double ned_ref[3], ecef_ref[3], tmp[3], az_ref, el_ref;
+      wgsecef2ned_d(&ecef[3 * k], ref_ecef, ned_ref);
+      wgsecef2azel(&ecef[3 * k], ref_ecef, &az_ref, &el_ref);
+      fail_unless(fabs(az[k] - az_ref) < 1e-12 && fabs(el[k] - el_ref) < 1e-12,
+                  "Frame az/el differs: %f %f vs %f %f",
+                  az[k],
+                  el[k],
+                  az_ref,
+                  el_ref);
+
+      ned_frame_ecef2ned(&frame, &ecef[3 * k], tmp);
+      wgsecef2ned(&ecef[3 * k], ref_ecef, ned_ref);
+      for (int i = 0; i < 3; i++) {
+        fail_unless(fabs(tmp[i] - ned_ref[i]) < MAX_DIST_ERROR_M,
+                    "Frame rotation differs from wgsecef2ned");
+      }
+
+      wgsecef2ned_d(&ecef[3 * k], ref_ecef, ned_ref);
+      for (int i = 0; i < 3; i++) {
+        fail_unless(fabs(ned[3 * k + i] - ned_ref[i]) < MAX_DIST_ERROR_M,
+                    "Frame NED differs from wgsecef2ned_d");
+      }
+
+      /* And back again. */
+      ned_frame_ned2ecef_d(&frame, &ned[3 * k], tmp);
+      wgsned2ecef(&ned[3 * k], ref_ecef, ecef_ref);
+      ned_frame_ned2ecef(&frame, &ned[3 * k], ned_ref);
+      for (int i = 0; i < 3; i++) {
+        fail_unless(fabs(tmp[i] - ecef[3 * k + i]) < MAX_DIST_ERROR_M,
+                    "Frame NED to ECEF does not round trip");
+        fail_unless(fabs(ned_ref[i] - ecef_ref[i]) < MAX_DIST_ERROR_M,
+                    "Frame rotation differs from wgsned2ecef");
+      }
+    }
+
+    /* In place conversion. */
+    ned_frame_ecef2ned_d_batch(&frame, 4, ecef, ecef);
+    for (int k = 0; k < 4 * 3; k++) {
+      fail_unless(ecef[k] == ned[k], "In place frame conversion differs");
+    }
+  }
+}
+END_TEST
+
 Suite *coord_system_suite(void) {
   Suite *s = suite_create("Coordinate systems");
 
@@ -389,7 +732,16 @@ Suite *coord_system_suite(void) {
   tcase_add_loop_test(tc_random, test_random_wgsllh2ecef2llh, 0, 22);
   tcase_add_loop_test(tc_random, test_random_wgsecef2llh2ecef, 0, 22);
   tcase_add_loop_test(tc_random, test_random_wgsecef2ned_d_0, 0, 22);
+  tcase_add_test(tc_random, test_ned_frame);
+  tcase_add_test(tc_random, test_wgsecef2llh_closed_form);
   suite_add_tcase(s, tc_random);
 
+  TCase *tc_batch = tcase_create("Batch");
+  tcase_add_test(tc_batch, test_batch_wgsecef2llh);
+  tcase_add_test(tc_batch, test_batch_wgsecef2llh_precision);
+  tcase_add_test(tc_batch, test_batch_wgsllh2ecef);
+  tcase_add_test(tc_batch, test_batch_wgsecef2llh_fast);
+  suite_add_tcase(s, tc_batch);
+
   return s;
 }
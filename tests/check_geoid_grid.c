@@ -0,0 +1,507 @@
+#include <check.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <swiftnav/bits.h>
+#include <swiftnav/constants.h>
+#include <swiftnav/geoid_grid.h>
+#include <swiftnav/geoid_model.h>
+
+#include "check_suites.h"
+#include "common/check_utils.h"
+
+#define GRID_MAX_POSTS (181 * 361)
+#define GRID_BUF_LEN (GEOID_GRID_HEADER_LEN + 4 * GRID_MAX_POSTS)
+
+static u8 grid_buf[GRID_BUF_LEN];
+static u8 gtx_buf[GRID_BUF_LEN];
+static u8 tiled_buf[GRID_BUF_LEN];
+static geoid_tile_cache_t test_cache;
+
+typedef double (*height_fn)(double lat_deg, double lon_deg);
+
+static void put_u32(u8 *p, u32 v, bool big_endian) {
+  v = big_endian ? htobe_32(v) : htole_32(v);
+  memcpy(p, &v, sizeof(v));
+}
+
+static void put_double(u8 *p, double d, bool big_endian) {
+  u64 v;
+  memcpy(&v, &d, sizeof(v));
+  v = big_endian ? htobe_64(v) : htole_64(v);
+  memcpy(p, &v, sizeof(v));
+}
+
+static void put_float(u8 *p, float f, bool big_endian) {
+  u32 v;
+  memcpy(&v, &f, sizeof(v));
+  put_u32(p, v, big_endian);
+}
+
+/* Fill a compact format and a GTX buffer with samples of `fn`, returning the
+ * length of the compact buffer. */
+static size_t make_grids(double lat0,
+                         double lon0,
+                         double dlat,
+                         double dlon,
+                         u32 n_lat,
+                         u32 n_lon,
+                         height_fn fn) {
+  memcpy(grid_buf, GEOID_GRID_MAGIC, GEOID_GRID_MAGIC_LEN);
+  put_u32(&grid_buf[8], GEOID_GRID_VERSION, false);
+  put_u32(&grid_buf[12], GEOID_MODEL_EGM96, false);
+  put_double(&grid_buf[16], lat0, false);
+  put_double(&grid_buf[24], lon0, false);
+  put_double(&grid_buf[32], dlat, false);
+  put_double(&grid_buf[40], dlon, false);
+  put_u32(&grid_buf[48], n_lat, false);
+  put_u32(&grid_buf[52], n_lon, false);
+
+  put_double(&gtx_buf[0], lat0, true);
+  put_double(&gtx_buf[8], lon0, true);
+  put_double(&gtx_buf[16], dlat, true);
+  put_double(&gtx_buf[24], dlon, true);
+  put_u32(&gtx_buf[32], n_lat, true);
+  put_u32(&gtx_buf[36], n_lon, true);
+
+  for (u32 r = 0; r < n_lat; r++) {
+    for (u32 c = 0; c < n_lon; c++) {
+      float h = (float)fn(lat0 + r * dlat, lon0 + c * dlon);
+      size_t i = 4 * ((size_t)r * n_lon + c);
+      put_float(&grid_buf[GEOID_GRID_HEADER_LEN + i], h, false);
+      put_float(&gtx_buf[GEOID_GRID_GTX_HEADER_LEN + i], h, true);
+    }
+  }
+  return GEOID_GRID_HEADER_LEN + 4 * (size_t)n_lat * n_lon;
+}
+
+static double linear_height(double lat_deg, double lon_deg) {
+  return 0.5 * lat_deg - 0.25 * lon_deg + 3;
+}
+
+static double smooth_height(double lat_deg, double lon_deg) {
+  return 10 * cos(D2R * lon_deg) * cos(D2R * lat_deg) + 5 * sin(D2R * lat_deg);
+}
+
+START_TEST(test_geoid_grid_regional) {
+  size_t len = make_grids(10, 30, 0.5, 1, 21, 16, linear_height);
+  size_t gtx_len = len - GEOID_GRID_HEADER_LEN + GEOID_GRID_GTX_HEADER_LEN;
+
+  geoid_grid_t grid, gtx;
+  fail_unless(geoid_grid_init(&grid, grid_buf, len) == 0,
+              "Compact grid rejected");
+  fail_unless(geoid_grid_init(&gtx, gtx_buf, gtx_len) == 0, "GTX rejected");
+  fail_unless(grid.model == GEOID_MODEL_EGM96 && grid.n_lat == 21 &&
+                  grid.n_lon == 16 && grid.lon_period == 0,
+              "Compact grid header decoded incorrectly");
+  fail_unless(gtx.model == GEOID_MODEL_NONE && gtx.n_lat == 21 &&
+                  gtx.n_lon == 16 && gtx.lon_period == 0,
+              "GTX header decoded incorrectly");
+  fail_unless(geoid_grid_post(&grid, 2, 3) == (float)linear_height(11, 33) &&
+                  geoid_grid_post(&gtx, 2, 3) == (float)linear_height(11, 33),
+              "Grid post read incorrectly");
+
+  /* Both interpolation schemes reproduce a linear function, including in the
+   * edge cells and on the boundary. */
+  srand(1);
+  for (int i = 0; i < 1000; i++) {
+    double lat = frand(10, 20);
+    double lon = frand(30, 45);
+    if (i == 0) {
+      lat = 20;
+      lon = 45;
+    }
+    float a, b;
+    fail_unless(geoid_grid_offset(&grid, D2R * lat, D2R * lon, &a) == 0 &&
+                    geoid_grid_offset(&gtx, D2R * lat, D2R * lon, &b) == 0,
+                "Location inside grid not covered");
+    fail_unless(a == b, "Compact and GTX grids differ: %f vs %f", a, b);
+    fail_unless(fabs(a - linear_height(lat, lon)) < 1e-4,
+                "Interpolation error at %f, %f: %f vs %f",
+                lat,
+                lon,
+                a,
+                linear_height(lat, lon));
+  }
+
+  float h;
+  fail_unless(geoid_grid_offset(&grid, D2R * 9.9, D2R * 35, &h) < 0 &&
+                  geoid_grid_offset(&grid, D2R * 15, D2R * 45.1, &h) < 0 &&
+                  geoid_grid_offset(&grid, NAN, D2R * 35, &h) < 0,
+              "Location outside regional grid reported as covered");
+
+  /* Regional grids with longitudes in [0, 360) cover western longitudes. */
+  len = make_grids(10, 250, 0.5, 1, 21, 16, linear_height);
+  fail_unless(geoid_grid_init(&grid, grid_buf, len) == 0,
+              "Compact grid rejected");
+  float west, east;
+  fail_unless(geoid_grid_offset(&grid, D2R * 15, D2R * -105.5, &west) == 0 &&
+                  geoid_grid_offset(&grid, D2R * 15, D2R * 254.5, &east) == 0,
+              "Western longitude not covered by grid east of 180");
+  fail_unless(west == east && fabs(east - linear_height(15, 254.5)) < 1e-4,
+              "Longitude wrap changes result: %f vs %f",
+              west,
+              east);
+  fail_unless(geoid_grid_offset(&grid, D2R * 15, D2R * -94, &h) < 0,
+              "Location outside regional grid reported as covered");
+}
+END_TEST
+
+START_TEST(test_geoid_grid_global) {
+  /* Global grid without and with a repeated first column. */
+  for (u32 extra = 0; extra < 2; extra++) {
+    size_t len = make_grids(-90, -180, 1, 1, 181, 360 + extra, smooth_height);
+    geoid_grid_t grid;
+    fail_unless(geoid_grid_init(&grid, grid_buf, len) == 0, "Grid rejected");
+    fail_unless(grid.lon_period == 360, "Global grid not detected");
+
+    srand(2);
+    for (int i = 0; i < 1000; i++) {
+      double lat = frand(-90, 90);
+      double lon = frand(-180, 180);
+      float a, b, c;
+      fail_unless(geoid_grid_offset(&grid, D2R * lat, D2R * lon, &a) == 0 &&
+                      geoid_grid_offset(
+                          &grid, D2R * lat, D2R * (lon + 360), &b) == 0 &&
+                      geoid_grid_offset(
+                          &grid, D2R * lat, D2R * (lon - 360), &c) == 0,
+                  "Location not covered by global grid");
+      fail_unless(fabs(a - b) < 1e-4 && fabs(a - c) < 1e-4,
+                  "Longitude wrap changes result");
+      fail_unless(fabs(a - smooth_height(lat, lon)) < 2e-3,
+                  "Interpolation error at %f, %f: %f vs %f",
+                  lat,
+                  lon,
+                  a,
+                  smooth_height(lat, lon));
+    }
+
+    /* Continuous across the seam. */
+    float west, east;
+    geoid_grid_offset(&grid, D2R * 45, D2R * 179.9999, &west);
+    geoid_grid_offset(&grid, D2R * 45, D2R * -179.9999, &east);
+    fail_unless(fabs(west - east) < 1e-3, "Discontinuity at the seam");
+  }
+}
+END_TEST
+
+START_TEST(test_geoid_grid_invalid) {
+  size_t len = make_grids(10, 30, 0.5, 1, 21, 16, linear_height);
+  size_t gtx_len = len - GEOID_GRID_HEADER_LEN + GEOID_GRID_GTX_HEADER_LEN;
+  geoid_grid_t grid;
+
+  fail_unless(geoid_grid_init(&grid, grid_buf, len - 1) < 0,
+              "Truncated grid accepted");
+  fail_unless(geoid_grid_init(&grid, gtx_buf, gtx_len + 4) < 0,
+              "GTX with trailing data accepted");
+  fail_unless(geoid_grid_init(&grid, grid_buf, 10) < 0,
+              "Short buffer accepted");
+
+  put_u32(&grid_buf[8], GEOID_GRID_VERSION + 1, false);
+  fail_unless(geoid_grid_init(&grid, grid_buf, len) < 0,
+              "Unknown version accepted");
+  put_u32(&grid_buf[8], GEOID_GRID_VERSION, false);
+
+  put_double(&grid_buf[32], 0, false);
+  fail_unless(geoid_grid_init(&grid, grid_buf, len) < 0,
+              "Zero spacing accepted");
+  put_double(&grid_buf[32], 0.5, false);
+
+  put_u32(&grid_buf[48], 1, false);
+  fail_unless(geoid_grid_init(&grid, grid_buf, len) < 0,
+              "Single row grid accepted");
+
+  /* 2^31 x 2^31 posts of 4 bytes wrap a 64 bit size to zero. */
+  put_u32(&grid_buf[48], 0x80000000u, false);
+  put_u32(&grid_buf[52], 0x80000000u, false);
+  fail_unless(geoid_grid_init(&grid, grid_buf, len) < 0,
+              "Overflowing grid size accepted");
+}
+END_TEST
+
+START_TEST(test_geoid_grid_map_file) {
+  const char *path = "check_geoid_grid.bin";
+  size_t len = make_grids(10, 30, 0.5, 1, 21, 16, linear_height);
+  FILE *f = fopen(path, "wb");
+  fail_unless(NULL != f, "Unable to create grid file");
+  fail_unless(fwrite(grid_buf, 1, len, f) == len, "Unable to write grid");
+  fclose(f);
+
+  float builtin_inside = get_geoid_offset(D2R * 15, D2R * 40);
+  float builtin_outside = get_geoid_offset(D2R * 50, D2R * 10);
+  geoid_model_t builtin_model = get_geoid_model();
+
+  geoid_grid_t grid;
+  fail_unless(geoid_grid_map_file(&grid, path) == 0, "Unable to map grid");
+  /* The mapping stays valid after the file is removed. */
+  remove(path);
+  fail_unless(grid.model == GEOID_MODEL_EGM96 && NULL != grid.mapping,
+              "Mapped grid header decoded incorrectly");
+
+  set_geoid_grid(&grid);
+  fail_unless(get_geoid_model() == GEOID_MODEL_EGM96,
+              "Loaded grid model not reported");
+  fail_unless(fabs(get_geoid_offset(D2R * 15, D2R * 40) -
+                   linear_height(15, 40)) < 1e-4,
+              "get_geoid_offset() does not use the loaded grid");
+  fail_unless(get_geoid_offset(D2R * 50, D2R * 10) == builtin_outside,
+              "No fall back to compiled in model outside the loaded grid");
+
+  set_geoid_grid(NULL);
+  fail_unless(get_geoid_model() == builtin_model &&
+                  get_geoid_offset(D2R * 15, D2R * 40) == builtin_inside,
+              "Compiled in model not restored");
+
+  geoid_grid_unmap_file(&grid);
+  fail_unless(NULL == grid.data && NULL == grid.mapping, "Grid not released");
+  fail_unless(geoid_grid_map_file(&grid, path) < 0, "Missing file mapped");
+}
+END_TEST
+
+/* Tile directory entry used as the cache key of tile `t`. */
+static bool tile_cached(const geoid_tile_cache_t *cache,
+                        const geoid_grid_t *grid,
+                        u32 t) {
+  const u8 *key = &grid->tile_index[t * GEOID_GRID_TILE_ENTRY_LEN];
+  for (u32 i = 0; i < GEOID_GRID_TILE_CACHE_SLOTS; i++) {
+    if (cache->slots[i].tile == key && cache->slots[i].grid_id == grid->id) {
+      return true;
+    }
+  }
+  return false;
+}
+
+START_TEST(test_geoid_grid_tiled) {
+  size_t len = make_grids(-90, -180, 1, 1, 181, 361, smooth_height);
+  geoid_grid_t grid;
+  fail_unless(geoid_grid_init(&grid, grid_buf, len) == 0, "Grid rejected");
+
+  const u32 tile_sizes[] = {GEOID_GRID_MAX_TILE_SIZE, 7};
+  for (u32 k = 0; k < 2; k++) {
+    size_t raw_len = 0;
+    for (u32 e = 0; e < GEOID_TILE_ENCODING_COUNT; e++) {
+      size_t tiled_len = sizeof(tiled_buf);
+      fail_unless(geoid_grid_encode_tiled(&grid,
+                                          tile_sizes[k],
+                                          (geoid_tile_encoding_t)e,
+                                          tiled_buf,
+                                          &tiled_len) == 0,
+                  "Unable to encode tiled grid");
+      if (GEOID_TILE_ENCODING_RAW == e) {
+        raw_len = tiled_len;
+      } else {
+        fail_unless(tiled_len < raw_len,
+                    "Delta coding does not compress: %zu vs %zu bytes",
+                    tiled_len,
+                    raw_len);
+      }
+
+      geoid_grid_t tiled;
+      fail_unless(geoid_grid_init(&tiled, tiled_buf, tiled_len) == 0,
+                  "Tiled grid rejected");
+      geoid_grid_set_cache(&tiled, (k == 0) ? NULL : &test_cache);
+      fail_unless(tiled.tile_size == tile_sizes[k] &&
+                      tiled.tile_encoding == (geoid_tile_encoding_t)e &&
+                      tiled.model == grid.model && tiled.n_lat == 181 &&
+                      tiled.n_lon == 361 && tiled.lon_period == 360,
+                  "Tiled grid header decoded incorrectly");
+
+      for (u32 r = 0; r < grid.n_lat; r++) {
+        for (u32 c = 0; c < grid.n_lon; c++) {
+          float a = geoid_grid_post(&grid, r, c);
+          float b = geoid_grid_post(&tiled, r, c);
+          fail_unless(fabs(a - b) <= 0.5 * GEOID_GRID_TILE_RESOLUTION + 1e-6,
+                      "Quantization error at %u, %u: %f vs %f",
+                      r,
+                      c,
+                      a,
+                      b);
+        }
+      }
+
+      srand(3);
+      for (int i = 0; i < 1000; i++) {
+        double lat = frand(-90, 90);
+        double lon = frand(-180, 180);
+        float a, b;
+        fail_unless(geoid_grid_offset(&grid, D2R * lat, D2R * lon, &a) == 0 &&
+                        geoid_grid_offset(
+                            &tiled, D2R * lat, D2R * lon, &b) == 0,
+                    "Location not covered by tiled grid");
+        fail_unless(fabs(a - b) < 2 * GEOID_GRID_TILE_RESOLUTION,
+                    "Tiled grid differs at %f, %f: %f vs %f",
+                    lat,
+                    lon,
+                    a,
+                    b);
+      }
+    }
+  }
+
+  /* Coarser quantization where the heights in a tile span more than the
+   * 16 bit range at 1 mm. */
+  len = make_grids(10, 30, 0.5, 1, 21, 16, linear_height);
+  geoid_grid_init(&grid, grid_buf, len);
+  size_t tiled_len = sizeof(tiled_buf);
+  fail_unless(geoid_grid_encode_tiled(&grid,
+                                      GEOID_GRID_MAX_TILE_SIZE,
+                                      GEOID_TILE_ENCODING_DELTA,
+                                      tiled_buf,
+                                      &tiled_len) == 0,
+              "Unable to encode tiled grid");
+  geoid_grid_t tiled;
+  fail_unless(geoid_grid_init(&tiled, tiled_buf, tiled_len) == 0,
+              "Tiled grid rejected");
+  for (u32 r = 0; r < grid.n_lat; r++) {
+    for (u32 c = 0; c < grid.n_lon; c++) {
+      fail_unless(fabs(geoid_grid_post(&grid, r, c) -
+                       geoid_grid_post(&tiled, r, c)) < 1e-3,
+                  "Quantization error too large");
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_geoid_grid_tile_cache) {
+  size_t len = make_grids(-90, -180, 1, 1, 181, 360, smooth_height);
+  geoid_grid_t grid, tiled;
+  geoid_grid_init(&grid, grid_buf, len);
+  size_t tiled_len = sizeof(tiled_buf);
+  fail_unless(geoid_grid_encode_tiled(&grid,
+                                      10,
+                                      GEOID_TILE_ENCODING_DELTA,
+                                      tiled_buf,
+                                      &tiled_len) == 0,
+              "Unable to encode tiled grid");
+  fail_unless(geoid_grid_init(&tiled, tiled_buf, tiled_len) == 0,
+              "Tiled grid rejected");
+  geoid_grid_set_cache(&tiled, &test_cache);
+
+  /* Fill the cache with the first tiles of the bottom tile row. */
+  for (u32 t = 0; t < GEOID_GRID_TILE_CACHE_SLOTS; t++) {
+    geoid_grid_post(&tiled, 0, t * 10);
+  }
+  /* Touch tile 0 so tile 1 becomes the least recently used. */
+  geoid_grid_post(&tiled, 5, 5);
+  geoid_grid_post(&tiled, 0, GEOID_GRID_TILE_CACHE_SLOTS * 10);
+  fail_unless(tile_cached(&test_cache, &tiled, 0) &&
+                  !tile_cached(&test_cache, &tiled, 1) &&
+                  tile_cached(&test_cache, &tiled, 2) &&
+                  tile_cached(&test_cache, &tiled, GEOID_GRID_TILE_CACHE_SLOTS),
+              "Least recently used tile not evicted");
+
+  /* A bicubic stencil spans up to four tiles, all of which stay cached. */
+  float h;
+  geoid_grid_offset(&tiled, D2R * -80, D2R * -170, &h);
+  const u32 n_tile_cols = tiled.n_tile_cols;
+  fail_unless(tile_cached(&test_cache, &tiled, 0) &&
+                  tile_cached(&test_cache, &tiled, 1) &&
+                  tile_cached(&test_cache, &tiled, n_tile_cols) &&
+                  tile_cached(&test_cache, &tiled, n_tile_cols + 1),
+              "Stencil tiles not cached");
+
+  geoid_tile_cache_reset(&test_cache);
+  fail_unless(!tile_cached(&test_cache, &tiled, 0), "Cache not reset");
+
+  /* Tiles of a grid previously held in the same buffer are not reused, with
+   * the default cache or a dedicated one. */
+  for (u32 dedicated = 0; dedicated < 2; dedicated++) {
+    len = make_grids(10, 30, 0.5, 1, 21, 16, linear_height);
+    geoid_grid_init(&grid, grid_buf, len);
+    tiled_len = sizeof(tiled_buf);
+    geoid_grid_encode_tiled(
+        &grid, 8, GEOID_TILE_ENCODING_DELTA, tiled_buf, &tiled_len);
+    geoid_grid_init(&tiled, tiled_buf, tiled_len);
+    geoid_grid_set_cache(&tiled, dedicated ? &test_cache : NULL);
+    const float before = geoid_grid_post(&tiled, 2, 3);
+
+    len = make_grids(10, 30, 0.5, 1, 21, 16, smooth_height);
+    geoid_grid_init(&grid, grid_buf, len);
+    tiled_len = sizeof(tiled_buf);
+    geoid_grid_encode_tiled(
+        &grid, 8, GEOID_TILE_ENCODING_DELTA, tiled_buf, &tiled_len);
+    geoid_grid_init(&tiled, tiled_buf, tiled_len);
+    if (dedicated) {
+      tiled.cache = &test_cache;
+    }
+    const float after = geoid_grid_post(&tiled, 2, 3);
+    fail_unless(fabs(before - linear_height(11, 33)) < 1e-3 &&
+                    fabs(after - smooth_height(11, 33)) < 1e-3,
+                "Stale tile returned after reinitialising the buffer");
+  }
+}
+END_TEST
+
+START_TEST(test_geoid_grid_tiled_invalid) {
+  size_t len = make_grids(10, 30, 0.5, 1, 21, 16, linear_height);
+  geoid_grid_t grid, tiled;
+  geoid_grid_init(&grid, grid_buf, len);
+  size_t tiled_len = sizeof(tiled_buf);
+  fail_unless(geoid_grid_encode_tiled(
+                  &grid, 8, GEOID_TILE_ENCODING_DELTA, tiled_buf, &tiled_len) ==
+                  0,
+              "Unable to encode tiled grid");
+  fail_unless(geoid_grid_init(&tiled, tiled_buf, tiled_len) == 0,
+              "Tiled grid rejected");
+
+  size_t short_len = GEOID_GRID_TILED_HEADER_LEN;
+  fail_unless(geoid_grid_encode_tiled(&grid,
+                                      8,
+                                      GEOID_TILE_ENCODING_DELTA,
+                                      tiled_buf,
+                                      &short_len) < 0,
+              "Encoded into a short buffer");
+  fail_unless(geoid_grid_encode_tiled(&grid,
+                                      GEOID_GRID_MAX_TILE_SIZE + 1,
+                                      GEOID_TILE_ENCODING_DELTA,
+                                      tiled_buf,
+                                      &tiled_len) < 0,
+              "Oversized tiles accepted");
+
+  fail_unless(geoid_grid_init(&tiled, tiled_buf, tiled_len - 1) < 0,
+              "Truncated tile data accepted");
+  put_u32(&tiled_buf[56], 0, false);
+  fail_unless(geoid_grid_init(&tiled, tiled_buf, tiled_len) < 0,
+              "Zero tile size accepted");
+  put_u32(&tiled_buf[56], 8, false);
+  put_u32(&tiled_buf[60], GEOID_TILE_ENCODING_COUNT, false);
+  fail_unless(geoid_grid_init(&tiled, tiled_buf, tiled_len) < 0,
+              "Unknown tile encoding accepted");
+  put_u32(&tiled_buf[60], GEOID_TILE_ENCODING_DELTA, false);
+  put_u32(&tiled_buf[48], UINT32_MAX, false);
+  put_u32(&tiled_buf[52], UINT32_MAX, false);
+  fail_unless(geoid_grid_init(&tiled, tiled_buf, tiled_len) < 0,
+              "Overflowing tile count accepted");
+  put_u32(&tiled_buf[48], 21, false);
+  put_u32(&tiled_buf[52], 16, false);
+
+  /* A corrupt tile only affects locations that depend on it. */
+  u8 *entry = &tiled_buf[GEOID_GRID_TILED_HEADER_LEN];
+  put_u32(&entry[4], 1, false);
+  fail_unless(geoid_grid_init(&tiled, tiled_buf, tiled_len) == 0,
+              "Tiled grid rejected");
+  float h;
+  fail_unless(geoid_grid_offset(&tiled, D2R * 11, D2R * 31, &h) < 0,
+              "Corrupt tile used");
+  fail_unless(geoid_grid_offset(&tiled, D2R * 19.5, D2R * 44, &h) == 0 &&
+                  fabs(h - linear_height(19.5, 44)) < 1e-3,
+              "Intact tile not used");
+}
+END_TEST
+
+Suite *geoid_grid_suite(void) {
+  Suite *s = suite_create("Geoid grid");
+
+  TCase *tc_core = tcase_create("Core");
+  tcase_add_test(tc_core, test_geoid_grid_regional);
+  tcase_add_test(tc_core, test_geoid_grid_global);
+  tcase_add_test(tc_core, test_geoid_grid_invalid);
+  tcase_add_test(tc_core, test_geoid_grid_map_file);
+  tcase_add_test(tc_core, test_geoid_grid_tiled);
+  tcase_add_test(tc_core, test_geoid_grid_tile_cache);
+  tcase_add_test(tc_core, test_geoid_grid_tiled_invalid);
+  suite_add_tcase(s, tc_core);
+
+  return s;
+}
@@ -7,7 +7,9 @@
  */
 
 #include <check.h>
+#include <stdlib.h>
 #include <swiftnav/constants.h>
+#include <swiftnav/geoid_grid.h>
 #include <swiftnav/geoid_model.h>
 
 #ifdef __cplusplus
@@ -90,6 +92,96 @@ namespace src_geoid_model_15_minute {
 #include "src/geoid_model.c"
 }  // namespace src_geoid_model_15_minute
 
+// directly include our implementation reading the geoids in their original
+// layout rather than the padded, tiled copies generated at build time
+namespace src_geoid_model_1_degree_flat {
+#undef GEOID_MODEL_15_MINUTE_RESOLUTION
+#define GEOID_MODEL_FLAT_LAYOUT
+#include "src/geoid_model.c"
+}  // namespace src_geoid_model_1_degree_flat
+
+namespace src_geoid_model_15_minute_flat {
+#define GEOID_MODEL_15_MINUTE_RESOLUTION
+#include "src/geoid_model.c"
+#undef GEOID_MODEL_FLAT_LAYOUT
+}  // namespace src_geoid_model_15_minute_flat
+
+/*
+ * get_geoid_offset_batch() must match get_geoid_offset() for scattered
+ * points, points along a track and the special cases at the poles and the
+ * longitude seam.
+ */
+template <typename Scalar, typename Batch>
+static void check_batch(Scalar scalar, Batch batch) {
+  static const size_t n = 2000;
+  static double lat[n];
+  static double lon[n];
+  static float batch_offset[n];
+
+  srand(1);
+  for (size_t i = 0; i < n; i++) {
+    if (i < n / 2) {
+      // scattered, including invalid latitudes
+      lat[i] = (rand() / (double)RAND_MAX * 190. - 95.) * D2R;
+      lon[i] = (rand() / (double)RAND_MAX * 720. - 360.) * D2R;
+    } else {
+      // track crossing the seam, 100 points per degree
+      lat[i] = (45. + (double)(i - n / 2) / 300.) * D2R;
+      lon[i] = (175. + (double)(i - n / 2) / 100.) * D2R;
+    }
+  }
+  const double special[][2] = {{90., 10.},
+                               {-90., 10.},
+                               {89.9, 10.},
+                               {89.1, 10.},
+                               {88.9, 10.},
+                               {-89.9, 10.},
+                               {-88.9, 10.},
+                               {0., 360.},
+                               {0., -360.},
+                               {0., 0.},
+                               {0., -1e-9}};
+  for (size_t i = 0; i < sizeof(special) / sizeof(special[0]); i++) {
+    lat[i] = special[i][0] * D2R;
+    lon[i] = special[i][1] * D2R;
+  }
+
+  batch(n, lat, lon, batch_offset);
+  for (size_t i = 0; i < n; i++) {
+    float expected = scalar(lat[i], lon[i]);
+    fail_unless(fabs(batch_offset[i] - expected) < 1e-5,
+                "Batch geoid offset differs at lat %g, lon %g: %f vs %f\n",
+                lat[i] * R2D,
+                lon[i] * R2D,
+                batch_offset[i],
+                expected);
+  }
+}
+
+/*
+ * The padded, tiled copies of the geoids must give exactly the same heights
+ * as the original tables, including across the longitude seam.
+ */
+template <typename Flat, typename Tiled>
+static void check_flat_and_tiled_layouts(Flat flat_offset,
+                                         Tiled tiled_offset) {
+  for (int lon = -3600; lon <= 3600; lon += 7) {
+    for (int lat = -900; lat <= 900; lat += 3) {
+      double lat_rad = lat / 10. * D2R;
+      double lon_rad = lon / 10. * D2R;
+      float flat = flat_offset(lat_rad, lon_rad);
+      float tiled = tiled_offset(lat_rad, lon_rad);
+      fail_unless(flat == tiled,
+                  "Mismatch between flat and tiled geoid layouts at lat %g, "
+                  "lon %g: %f vs %f\n",
+                  lat / 10.,
+                  lon / 10.,
+                  flat,
+                  tiled);
+    }
+  }
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -200,6 +292,78 @@ START_TEST(compare_15_minute_bilinear_vs_bicubic) {
 }
 END_TEST
 
+/*
+ * A runtime loaded grid holding the 1 degree model must give the same
+ * heights as the compiled in 1 degree model.
+ */
+START_TEST(compare_1_degree_loaded_grid) {
+  static const size_t n_lat = 181;
+  static const size_t n_lon = 361;
+  static unsigned char buf[GEOID_GRID_HEADER_LEN + 4 * n_lat * n_lon];
+
+  // compact format header, little endian
+  const uint32_t version = GEOID_GRID_VERSION;
+  const uint32_t model = GEOID_MODEL_EGM2008;
+  const double header[4] = {-90., 0., 1., 1.};
+  const uint32_t dims[2] = {n_lat, n_lon};
+  memcpy(buf, GEOID_GRID_MAGIC, GEOID_GRID_MAGIC_LEN);
+  memcpy(&buf[8], &version, sizeof(version));
+  memcpy(&buf[12], &model, sizeof(model));
+  memcpy(&buf[16], header, sizeof(header));
+  memcpy(&buf[48], dims, sizeof(dims));
+  for (size_t lat = 0; lat < n_lat; lat++) {
+    for (size_t lon = 0; lon < n_lon; lon++) {
+      memcpy(&buf[GEOID_GRID_HEADER_LEN + 4 * (lat * n_lon + lon)],
+             &geoid_1_degree::GEOID[lon][lat],
+             sizeof(float));
+    }
+  }
+
+  geoid_grid_t grid;
+  fail_unless(geoid_grid_init(&grid, buf, sizeof(buf)) == 0,
+              "1 degree grid rejected");
+  fail_unless(grid.lon_period == 360, "1 degree grid is not global");
+
+  for (int lon = 0; lon <= 3600; lon += 3) {
+    for (int lat = -900; lat <= 900; lat += 3) {
+      double lat_rad = lat / 10. * D2R;
+      double lon_rad = lon / 10. * D2R;
+      float loaded;
+      fail_unless(geoid_grid_offset(&grid, lat_rad, lon_rad, &loaded) == 0,
+                  "Location not covered by global grid");
+      float builtin =
+          src_geoid_model_1_degree::get_geoid_offset(lat_rad, lon_rad);
+      fail_unless(fabs(loaded - builtin) < 1e-3,
+                  "Mismatch between loaded and compiled in 1 degree geoid "
+                  "at lat %g, lon %g: %f vs %f\n",
+                  lat / 10.,
+                  lon / 10.,
+                  loaded,
+                  builtin);
+    }
+  }
+}
+END_TEST
+
+START_TEST(compare_batch_offsets) {
+  check_batch(src_geoid_model_1_degree::get_geoid_offset,
+              src_geoid_model_1_degree::get_geoid_offset_batch);
+  check_batch(src_geoid_model_15_minute::get_geoid_offset,
+              src_geoid_model_15_minute::get_geoid_offset_batch);
+  check_batch(get_geoid_offset, get_geoid_offset_batch);
+}
+END_TEST
+
+START_TEST(compare_flat_and_tiled_layouts) {
+  check_flat_and_tiled_layouts(
+      src_geoid_model_1_degree_flat::get_geoid_offset,
+      src_geoid_model_1_degree::get_geoid_offset);
+  check_flat_and_tiled_layouts(
+      src_geoid_model_15_minute_flat::get_geoid_offset,
+      src_geoid_model_15_minute::get_geoid_offset);
+}
+END_TEST
+
 Suite* geoid_model_test_suite(void) {
   Suite* s = suite_create("Geoid model");
 
@@ -208,6 +372,9 @@ Suite* geoid_model_test_suite(void) {
   tcase_add_test(tc_core, compare_geoid_models_tenth_degree);
   tcase_add_test(tc_core, compare_1_degree_bilinear_vs_bicubic);
   tcase_add_test(tc_core, compare_15_minute_bilinear_vs_bicubic);
+  tcase_add_test(tc_core, compare_1_degree_loaded_grid);
+  tcase_add_test(tc_core, compare_batch_offsets);
+  tcase_add_test(tc_core, compare_flat_and_tiled_layouts);
   suite_add_tcase(s, tc_core);
 
   return s;
@@ -11,6 +11,8 @@
  */
 
 #include <check.h>
+#include <math.h>
+#include <swiftnav/constants.h>
 #include <swiftnav/glo_map.h>
 #include <swiftnav/logging.h>
 
@@ -99,10 +101,61 @@ START_TEST(test_glo_map) {
 }
 END_TEST
 
+START_TEST(test_glo_map_carrier) {
+  glo_map_init(glo_map_lock, glo_map_unlock);
+  glo_map_clear_all();
+
+  gnss_signal_t l1 = construct_sid(CODE_GLO_L1OF, SLOT_ID_TEST_VAL_1);
+  gnss_signal_t l2 = construct_sid(CODE_GLO_L2OF, SLOT_ID_TEST_VAL_1);
+  fail_unless(sid_to_carrier(l1)->freq == GLO_L1_HZ &&
+                  sid_to_carrier(l2)->freq == GLO_L2_HZ,
+              "Unmapped slot should be at the band centre");
+
+  for (u16 fcn = GLO_MIN_FCN; fcn <= GLO_MAX_FCN; fcn++) {
+    for (u16 i = 1; i <= NUM_SATS_GLO; i++) {
+      glo_map_set_slot_id((u16)(GLO_MIN_FCN + (fcn + i) % GLO_MAX_FCN), i);
+    }
+    glo_map_set_slot_id(fcn, SLOT_ID_TEST_VAL_1);
+    double f1 = GLO_L1_HZ + (fcn - GLO_FCN_OFFSET) * GLO_L1_DELTA_HZ;
+    double f2 = GLO_L2_HZ + (fcn - GLO_FCN_OFFSET) * GLO_L2_DELTA_HZ;
+    const sid_carrier_t *c1 = sid_to_carrier(l1);
+    const sid_carrier_t *c2 = sid_to_carrier(l2);
+    fail_unless(c1->freq == f1 && c1->lambda == GPS_C / f1 &&
+                    fabs(c1->lambda * c1->inv_lambda - 1) < 1e-15,
+                "Incorrect L1 carrier for FCN %d",
+                fcn);
+    fail_unless(c2->freq == f2 && c2->lambda == GPS_C / f2 &&
+                    fabs(c2->lambda * c2->inv_lambda - 1) < 1e-15,
+                "Incorrect L2 carrier for FCN %d",
+                fcn);
+    for (u16 i = 1; i <= NUM_SATS_GLO; i++) {
+      gnss_signal_t sid = construct_sid(CODE_GLO_L1OF, i);
+      fail_unless(sid_to_carr_freq(sid) ==
+                      GLO_L1_HZ + (glo_map_get_fcn(sid) - GLO_FCN_OFFSET) *
+                                      GLO_L1_DELTA_HZ,
+                  "Carrier table out of step with the map for slot %d",
+                  i);
+    }
+  }
+
+  glo_map_clear_slot_id(SLOT_ID_TEST_VAL_1);
+  fail_unless(sid_to_carrier(l1)->freq == GLO_L1_HZ,
+              "Cleared slot should be at the band centre");
+  sid_carrier_set_glo_fcn(SLOT_ID_TEST_VAL_1, GLO_MAX_FCN + 1);
+  fail_unless(sid_to_carrier(l2)->freq == GLO_L2_HZ,
+              "Invalid frequency slot should be at the band centre");
+  fail_unless(sid_to_lambda(construct_sid(CODE_GPS_L2CM, 3)) ==
+                  GPS_C / GPS_L2_HZ,
+              "Incorrect CDMA wavelength");
+  glo_map_clear_all();
+}
+END_TEST
+
 Suite *glo_map_test_suite(void) {
   Suite *s = suite_create("GLO FCN map");
   TCase *tc_core = tcase_create("Core");
   tcase_add_test(tc_core, test_glo_map);
+  tcase_add_test(tc_core, test_glo_map_carrier);
   suite_add_tcase(s, tc_core);
 
   return s;
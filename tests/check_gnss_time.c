@@ -1,5 +1,7 @@
 #include <check.h>
+#include <inttypes.h>
 #include <math.h>
+#include <string.h>
 #include <swiftnav/constants.h>
 #include <swiftnav/gnss_time.h>
 #include <time.h>
@@ -531,6 +533,144 @@ START_TEST(test_utc_offset) {
 }
 END_TEST
 
+/* Linear search of the leap second table as in the original lookups. */
+static double utc_offset_linear(const gps_time_t *t, bool utc) {
+  for (s16 i = ARRAY_SIZE(utc_leaps) - 1; i >= 0; i--) {
+    gps_time_t t_leap = {.wn = utc_leaps[i][0], .tow = utc_leaps[i][1]};
+    double threshold = utc ? 1.0 - utc_leaps[i][2] : 1.0;
+    if (gpsdifftime(t, &t_leap) >= threshold) {
+      return utc_leaps[i][2];
+    }
+  }
+  return 0.0;
+}
+
+START_TEST(test_utc_offset_table_search) {
+  for (u32 i = 0; i < ARRAY_SIZE(utc_leaps); i++) {
+    fail_unless(utc_leap_secs[i] ==
+                    (s64)utc_leaps[i][0] * WEEK_SECS + utc_leaps[i][1],
+                "utc_leap_secs[%u] does not match utc_leaps",
+                i);
+  }
+
+  /* Times around every leap second, alternating between events so that the
+   * cached interval is both reused and replaced. */
+  static const double offsets[] = {
+      -86400, -2, -1.5, -1e-6, 0, 1e-9, 0.5, 1 - 1e-9, 1, 1.5, 2, 86400};
+  for (u32 k = 0; k < ARRAY_SIZE(offsets); k++) {
+    for (u32 step = 0; step < 2 * ARRAY_SIZE(utc_leaps); step++) {
+      u32 i = (step % 2) ? step / 2 : (u32)ARRAY_SIZE(utc_leaps) - 1 - step / 2;
+      gps_time_t t = {.wn = utc_leaps[i][0], .tow = utc_leaps[i][1]};
+      t.tow += offsets[k];
+      normalize_gps_time(&t);
+
+      double dt = gpsdifftime(&t, &(gps_time_t){.wn = utc_leaps[i][0],
+                                                .tow = utc_leaps[i][1]});
+      fail_unless(get_gps_utc_offset(&t, NULL) == utc_offset_linear(&t, false),
+                  "GPS offset at leap %u %+g s",
+                  i,
+                  offsets[k]);
+      fail_unless(get_utc_gps_offset(&t, NULL) == -utc_offset_linear(&t, true),
+                  "UTC offset at leap %u %+g s",
+                  i,
+                  offsets[k]);
+      fail_unless(is_leap_second_event(&t, NULL) == (dt >= 0 && dt < 1),
+                  "Leap second event at leap %u %+g s",
+                  i,
+                  offsets[k]);
+    }
+  }
+
+  /* Before the first and long after the last leap second. */
+  gps_time_t t = {.wn = 0, .tow = 0};
+  fail_unless(get_gps_utc_offset(&t, NULL) == 0, "Offset at the GPS epoch");
+  t.wn = 30000;
+  fail_unless(get_gps_utc_offset(&t, NULL) ==
+                  utc_leaps[ARRAY_SIZE(utc_leaps) - 1][2],
+              "Offset after the last leap second");
+  fail_unless(!is_leap_second_event(&t, NULL),
+              "Leap second event after the last leap second");
+}
+END_TEST
+
+START_TEST(test_gps_time_ns) {
+  /* Late in the week, where a double time of week resolves about 0.1 ns. */
+  gps_time_t t = {.wn = 2300, .tow = 604799.999999999};
+  gps_time_ns_t t_ns = gps2ns(&t);
+  fail_unless(t_ns.ns == (2301 * WEEK_NS_INT - 1),
+              "gps2ns late in the week %" PRId64,
+              t_ns.ns);
+  gps_time_t unnormalized = {.wn = 2301, .tow = -1e-9};
+  fail_unless(gps2ns(&unnormalized).ns == t_ns.ns,
+              "gps2ns of an unnormalized time");
+
+  /* Exact round trips through gps_time_t at any nanosecond of the week. */
+  for (u32 i = 0; i < 10000; i++) {
+    s64 ns = (s64)(frand(0, GPS_TIME_NS_MAX_WN) * WEEK_NS_INT);
+    ns = ns / 1000 * 1000 + i % 1000;
+    gps_time_ns_t a = {ns};
+    gps_time_t g = ns2gps(a);
+    fail_unless(gps_time_valid(&g), "ns2gps invalid time %" PRId64, ns);
+    fail_unless(gps2ns(&g).ns == ns, "Round trip of %" PRId64, ns);
+  }
+
+  /* Before the GPS epoch the week number is negative. */
+  gps_time_t g = ns2gps((gps_time_ns_t){-1});
+  fail_unless(g.wn == -1 && g.tow == WEEK_SECS - 1e-9, "ns2gps before epoch");
+
+  /* Unknown and unrepresentable times. */
+  fail_unless(!gps_time_ns_valid(gps2ns(&GPS_TIME_UNKNOWN)),
+              "gps2ns of an unknown time");
+  t.wn = GPS_TIME_NS_MAX_WN + 1;
+  fail_unless(!gps_time_ns_valid(gps2ns(&t)), "gps2ns out of range");
+  g = ns2gps(GPS_TIME_NS_UNKNOWN);
+  fail_unless(g.wn == WN_UNKNOWN, "ns2gps of an unknown time");
+
+  /* Integer arithmetic. */
+  gps_time_ns_t a = {5 * WEEK_NS_INT};
+  gps_time_ns_t b = gps_time_ns_add(a, -3);
+  fail_unless(gps_time_ns_diff(a, b) == 3, "gps_time_ns_diff");
+  fail_unless(gps_time_ns_cmp(a, b) == 1 && gps_time_ns_cmp(b, a) == -1 &&
+                  gps_time_ns_cmp(a, a) == 0,
+              "gps_time_ns_cmp");
+  b = gps_time_ns_add_secs(a, 1.5e-9);
+  fail_unless(b.ns - a.ns == 2, "gps_time_ns_add_secs rounding");
+  fail_unless(gps_time_ns_diff_secs(a, gps_time_ns_add_secs(a, -0.25)) == 0.25,
+              "gps_time_ns_diff_secs");
+}
+END_TEST
+
+START_TEST(test_glo_time_ns) {
+  /* GLO time 31st Dec 2010 12:12:12.123456789 */
+  glo_time_t glo_t = {.nt = 1096, .n4 = 4, .h = 12, .m = 12, .s = 12.123456789};
+  gps_time_ns_t t = glo2ns(&glo_t, NULL);
+  fail_unless(t.ns == (1616 * WEEK_SECS + 465147) * SECS_NS_INT + 123456789,
+              "glo2ns %" PRId64,
+              t.ns);
+  glo_time_t back = ns2glo(t, NULL);
+  fail_unless(back.nt == glo_t.nt && back.n4 == glo_t.n4 &&
+                  back.h == glo_t.h && back.m == glo_t.m &&
+                  fabs(back.s - glo_t.s) < 1e-12,
+              "ns2glo %u %u %u %u %.12f",
+              back.nt,
+              back.n4,
+              back.h,
+              back.m,
+              back.s);
+
+  /* During a leap second. */
+  glo_time_t leap = {.nt = 367, .n4 = 6, .h = 2, .m = 59, .s = 60.25};
+  t = glo2ns(&leap, NULL);
+  fail_unless(t.ns == (1930 * WEEK_SECS + 17) * SECS_NS_INT + 250000000,
+              "glo2ns during a leap second %" PRId64,
+              t.ns);
+
+  glo_t.nt = 0;
+  fail_unless(!gps_time_ns_valid(glo2ns(&glo_t, NULL)),
+              "glo2ns of an invalid time");
+}
+END_TEST
+
 /* test a fictional leap second on 1st Jan 2020 */
 /* note also the polynomial correction which shifts the time of effectivity */
 static utc_params_t p_neg_offset = {.a0 = -0.125,
@@ -568,6 +708,92 @@ static utc_params_t p_neg_trend = {
     .dt_ls = 18,
     .dt_lsf = 19};
 
+/* Compare the formatter with gps2utc() at `n` times `step` seconds apart. */
+static void check_utc_formatter(utc_formatter_t *f,
+                                gps_time_t t,
+                                double step,
+                                u32 n,
+                                const utc_params_t *p) {
+  for (u32 i = 0; i < n; i++) {
+    utc_tm u_ref, u;
+    gps2utc(&t, &u_ref, p);
+    utc_formatter_tm(f, &t, &u);
+    fail_unless(u.year == u_ref.year && u.year_day == u_ref.year_day &&
+                    u.month == u_ref.month &&
+                    u.month_day == u_ref.month_day &&
+                    u.week_day == u_ref.week_day && u.hour == u_ref.hour &&
+                    u.minute == u_ref.minute &&
+                    u.second_int == u_ref.second_int &&
+                    fabs(u.second_frac - u_ref.second_frac) < 1e-9,
+                "utc_formatter_tm at %d %.3f: %u-%u-%u %u:%u:%u.%.9f",
+                t.wn,
+                t.tow,
+                u.year,
+                u.month,
+                u.month_day,
+                u.hour,
+                u.minute,
+                u.second_int,
+                u.second_frac);
+    add_secs(&t, step);
+  }
+}
+
+START_TEST(test_utc_formatter) {
+  utc_formatter_t f;
+  utc_formatter_init(&f, NULL);
+
+  /* Across the leap second at the end of 2016 and an ordinary midnight. */
+  gps_time_t t = {.wn = 1929, .tow = 604790};
+  check_utc_formatter(&f, t, 0.01, 4000, NULL);
+  fail_unless(f.valid, "Day after a leap second not cached");
+  t = (gps_time_t){.wn = 1930, .tow = 86410};
+  check_utc_formatter(&f, t, 1e-3, 16000, NULL);
+  /* Backwards in time. */
+  t.tow = 86430;
+  check_utc_formatter(&f, t, -0.37, 200, NULL);
+  /* Leap second with a constant offset from UTC parameters. */
+  t = (gps_time_t){.wn = 2086, .tow = 259200};
+  utc_formatter_init(&f, &p_pos_offset);
+  check_utc_formatter(&f, t, 0.01, 4000, &p_pos_offset);
+  /* A drifting offset is never cached. */
+  utc_formatter_init(&f, &p_pos_trend);
+  check_utc_formatter(&f, t, 0.5, 100, &p_pos_trend);
+  fail_unless(!f.valid, "Day with a drifting UTC offset cached");
+
+  /* ISO 8601 strings. */
+  char buf[32];
+  utc_formatter_init(&f, NULL);
+  t = (gps_time_t){.wn = 1930, .tow = 16.25};
+  fail_unless(utc_formatter_iso8601(&f, &t, 0, buf, sizeof(buf)) == 20 &&
+                  strcmp(buf, "2016-12-31T23:59:59Z") == 0,
+              "ISO 8601 %s",
+              buf);
+  t.tow = 17.25;
+  fail_unless(utc_formatter_iso8601(&f, &t, 2, buf, sizeof(buf)) == 23 &&
+                  strcmp(buf, "2016-12-31T23:59:60.25Z") == 0,
+              "ISO 8601 during a leap second %s",
+              buf);
+  t.tow = 18.5;
+  fail_unless(utc_formatter_iso8601(&f, &t, 3, buf, sizeof(buf)) == 24 &&
+                  strcmp(buf, "2017-01-01T00:00:00.500Z") == 0,
+              "ISO 8601 after a leap second %s",
+              buf);
+  t.tow = 18 + 3723.123456789;
+  fail_unless(utc_formatter_iso8601(&f, &t, 9, buf, sizeof(buf)) == 30 &&
+                  strcmp(buf, "2017-01-01T01:02:03.123456789Z") == 0,
+              "ISO 8601 nanoseconds %s",
+              buf);
+  t.tow = 18 + 59.9999999999;
+  fail_unless(utc_formatter_iso8601(&f, &t, 3, buf, sizeof(buf)) == 24 &&
+                  strcmp(buf, "2017-01-01T00:00:59.999Z") == 0,
+              "ISO 8601 truncation %s",
+              buf);
+  fail_unless(utc_formatter_iso8601(&f, &t, 3, buf, 24) == 0,
+              "ISO 8601 into a short buffer");
+}
+END_TEST
+
 START_TEST(test_utc_params) {
   struct utc_params_testcase {
     gps_time_t t;
@@ -1124,6 +1350,70 @@ START_TEST(test_gps2utc) {
 }
 END_TEST
 
+#define N_BATCH_TIMES 2000
+
+START_TEST(test_time_conversions_batch) {
+  static gps_time_t gps[N_BATCH_TIMES], gps_batch[N_BATCH_TIMES];
+  static utc_tm utc[N_BATCH_TIMES];
+  static double mjd[N_BATCH_TIMES], mjd_batch[N_BATCH_TIMES];
+
+  /* Ordered times through the Jan 2017 and Jan 2020 (fictional) leap seconds
+   * and some random ones, with and without UTC parameters. */
+  const gps_time_t starts[] = {{.wn = 1930, .tow = 17 - 250},
+                               {.wn = 2086, .tow = 259218 - 250}};
+  const utc_params_t *params[] = {NULL, &p_pos_offset};
+  for (u32 k = 0; k < 3; k++) {
+    const utc_params_t *p = (k < 2) ? params[k] : NULL;
+    for (u32 i = 0; i < N_BATCH_TIMES; i++) {
+      if (k < 2) {
+        gps[i] = starts[k];
+        add_secs(&gps[i], 0.25 * i);
+      } else {
+        gps[i].wn = (s16)frand(1, 2500);
+        gps[i].tow = frand(0, WEEK_SECS - 1);
+      }
+      gps2utc(&gps[i], &utc[i], p);
+    }
+
+    gps2mjd_batch(N_BATCH_TIMES, gps, p, mjd_batch);
+    for (u32 i = 0; i < N_BATCH_TIMES; i++) {
+      double ref = gps2mjd_params(&gps[i], p);
+      fail_unless(fabs(mjd_batch[i] - ref) < 1e-10,
+                  "gps2mjd_batch %u %u: %.12f %.12f",
+                  k,
+                  i,
+                  mjd_batch[i],
+                  ref);
+    }
+
+    utc2mjd_batch(N_BATCH_TIMES, utc, mjd_batch);
+    for (u32 i = 0; i < N_BATCH_TIMES; i++) {
+      mjd[i] = utc2mjd(&utc[i]);
+      fail_unless(mjd_batch[i] == mjd[i], "utc2mjd_batch %u %u", k, i);
+    }
+
+    mjd2gps_batch(N_BATCH_TIMES, mjd, p, gps_batch);
+    for (u32 i = 0; i < N_BATCH_TIMES; i++) {
+      gps_time_t ref = mjd2gps_params(mjd[i], p);
+      fail_unless(gps_batch[i].wn == ref.wn && gps_batch[i].tow == ref.tow,
+                  "mjd2gps_batch %u %u",
+                  k,
+                  i);
+    }
+
+    utc2gps_batch(N_BATCH_TIMES, utc, p, gps_batch);
+    for (u32 i = 0; i < N_BATCH_TIMES; i++) {
+      gps_time_t ref;
+      utc2gps(&utc[i], &ref, p);
+      fail_unless(gps_batch[i].wn == ref.wn && gps_batch[i].tow == ref.tow,
+                  "utc2gps_batch %u %u",
+                  k,
+                  i);
+    }
+  }
+}
+END_TEST
+
 START_TEST(test_time_conversions) {
   gps_time_t testcases[] = {
       {567890.0, 1234},
@@ -1238,12 +1528,17 @@ Suite *gnss_time_test_suite(void) {
   tcase_add_test(tc_core, test_gps_adjust_week_cycle);
   tcase_add_test(tc_core, test_is_leap_year);
   tcase_add_test(tc_core, test_utc_offset);
+  tcase_add_test(tc_core, test_utc_offset_table_search);
   tcase_add_test(tc_core, test_utc_params);
   tcase_add_test(tc_core, test_gps2utc);
+  tcase_add_test(tc_core, test_utc_formatter);
   tcase_add_test(tc_core, test_glo2gps);
+  tcase_add_test(tc_core, test_gps_time_ns);
+  tcase_add_test(tc_core, test_glo_time_ns);
   tcase_add_test(tc_core, test_gps2utc_time);
   tcase_add_test(tc_core, test_gps2utc_date);
   tcase_add_test(tc_core, test_time_conversions);
+  tcase_add_test(tc_core, test_time_conversions_batch);
   tcase_add_test(tc_core, test_round_to_epoch);
   tcase_add_test(tc_core, test_floor_to_epoch);
   suite_add_tcase(s, tc_core);
@@ -2,6 +2,7 @@
 #include <math.h>
 #include <swiftnav/constants.h>
 #include <swiftnav/gnss_time.h>
+#include <swiftnav/gnss_time.hpp>
 #include <time.h>
 
 #include "check_suites.h"
@@ -80,6 +81,78 @@ START_TEST(test_gpstime_operator_minus_assignment) {
 }
 END_TEST
 
+START_TEST(test_gpstime_ns_ops) {
+  gps_time_ns_t a = {1234 * WEEK_NS_INT + 567890 * SECS_NS_INT};
+  gps_time_ns_t b = {a.ns + 500000000};
+  gps_time_ns_t c = a;
+  fail_unless(a < b && b > a && a <= b && b >= a, "ordering failed");
+  fail_unless(a == c && a != b && a <= c && a >= c, "equality failed");
+  fail_unless(GPS_TIME_NS_UNKNOWN == GPS_TIME_NS_UNKNOWN, "operator== failed");
+  fail_unless(b - a == 0.5, "operator- failed");
+  fail_unless(a + 0.5 == b && 0.5 + a == b, "operator+ failed");
+  fail_unless(b - 0.5 == a, "operator- failed");
+  c += 0.5;
+  fail_unless(c == b, "operator+= failed");
+  c -= 0.5;
+  fail_unless(c == a, "operator-= failed");
+  /* Differences stay exact late in the week. */
+  gps_time_ns_t d = {a.ns + 37000};
+  fail_unless(d - a == 37e-6, "operator- lost precision");
+}
+END_TEST
+
+START_TEST(test_gpstime_constexpr) {
+  static_assert(swiftnav::gps_adjust_week_cycle(1, 2000) == 2049,
+                "week cycle not constant");
+  static_assert(swiftnav::gps_adjust_week_cycle256(10, 2000) == 2058,
+                "week cycle not constant");
+  static_assert(swiftnav::gpsdifftime(gps_time_t{1.0, 1235},
+                                      gps_time_t{WEEK_SECS - 1.0, 1234}) == 2.0,
+                "gpsdifftime not constant");
+  static_assert(swiftnav::add_secs(gps_time_t{WEEK_SECS - 1.0, 1234}, 2.0).wn ==
+                    1235,
+                "add_secs not constant");
+  static_assert(
+      swiftnav::ns2gps(gps_time_ns_t{WEEK_NS_INT + SECS_NS_INT}).tow == 1.0,
+      "ns2gps not constant");
+
+  const double offsets[] = {
+      -2 * WEEK_SECS, -WEEK_SECS / 2 - 1, -0.5, 0, 0.25, WEEK_SECS, 1e7};
+  gps_time_t base = {WEEK_SECS - 0.75, 1234};
+  gps_time_t base_unknown = {3.5, WN_UNKNOWN};
+  for (double dt : offsets) {
+    gps_time_t a = base;
+    add_secs(&a, dt);
+    gps_time_t b = swiftnav::add_secs(base, dt);
+    fail_unless(a.wn == b.wn && a.tow == b.tow, "add_secs mismatch");
+    fail_unless(swiftnav::gpsdifftime(b, base) == gpsdifftime(&a, &base),
+                "gpsdifftime mismatch");
+    gps_time_t c = {base_unknown.tow + dt, WN_UNKNOWN};
+    gps_time_t d = c;
+    normalize_gps_time(&c);
+    d = swiftnav::normalize_gps_time(d);
+    fail_unless(c.wn == d.wn && c.tow == d.tow, "normalize mismatch");
+    fail_unless(swiftnav::gpsdifftime(d, base_unknown) ==
+                    gpsdifftime(&c, &base_unknown),
+                "gpsdifftime mismatch for unknown week");
+    gps_time_ns_t ns = gps2ns(&b);
+    gps_time_t e = ns2gps(ns);
+    gps_time_t f = swiftnav::ns2gps(ns);
+    fail_unless(e.wn == f.wn && e.tow == f.tow, "ns2gps mismatch");
+  }
+  for (u16 ref = 0; ref < 4096; ref += 7) {
+    for (u16 raw = 0; raw < 1024; raw += 13) {
+      fail_unless(swiftnav::gps_adjust_week_cycle(raw, ref) ==
+                      gps_adjust_week_cycle(raw, ref),
+                  "week cycle mismatch");
+      fail_unless(swiftnav::gps_adjust_week_cycle256(raw % 256, ref) ==
+                      gps_adjust_week_cycle256(raw % 256, ref),
+                  "week cycle 256 mismatch");
+    }
+  }
+}
+END_TEST
+
 Suite *gnss_time_cpp_test_suite(void) {
   Suite *s = suite_create("GPS Time C++ operators");
 
@@ -89,6 +162,8 @@ Suite *gnss_time_cpp_test_suite(void) {
   tcase_add_test(tc_core, test_gpstime_operator_plus);
   tcase_add_test(tc_core, test_gpstime_operator_plus_assignment);
   tcase_add_test(tc_core, test_gpstime_operator_minus_assignment);
+  tcase_add_test(tc_core, test_gpstime_ns_ops);
+  tcase_add_test(tc_core, test_gpstime_constexpr);
   suite_add_tcase(s, tc_core);
 
   return s;
@@ -94,6 +94,47 @@ START_TEST(test_calc_ionosphere) {
 }
 END_TEST
 
+START_TEST(test_calc_ionosphere_batch) {
+  gps_time_t t = {.wn = 1875, .tow = 479820};
+  ionosphere_t i = {.a0 = 0.1583e-7,
+                    .a1 = -0.7451e-8,
+                    .a2 = -0.5960e-7,
+                    .a3 = 0.1192e-6,
+                    .b0 = 0.1290e6,
+                    .b1 = -0.2130e6,
+                    .b2 = 0.6554e5,
+                    .b3 = 0.3277e6};
+  double lat_u = -35.3 * D2R, lon_u = 149.1 * D2R;
+
+  enum { N = 36 };
+  double a[N], e[N], d_l1[N], d[N];
+  gnss_signal_t sids[N];
+  const gnss_signal_t l2 = {.sat = 5, .code = CODE_GPS_L2CM};
+  const gnss_signal_t e5a = {.sat = 11, .code = CODE_GAL_E5I};
+  for (int k = 0; k < N; k++) {
+    a[k] = (k * 37 % 360) * D2R;
+    e[k] = (k * 2.5) * D2R;
+    sids[k] = (k % 2) ? l2 : e5a;
+  }
+
+  calc_ionosphere_batch(&t, lat_u, lon_u, &i, N, a, e, NULL, d_l1);
+  calc_ionosphere_batch(&t, lat_u, lon_u, &i, N, a, e, sids, d);
+  for (int k = 0; k < N; k++) {
+    double expected = calc_ionosphere(&t, lat_u, lon_u, a[k], e[k], &i);
+    fail_unless(fabs(d_l1[k] - expected) < 1e-12,
+                "Batch L1 delay %f differs from calc_ionosphere() %f",
+                d_l1[k],
+                expected);
+    double f = (k % 2) ? GPS_L2_HZ : GAL_E5_HZ;
+    double scaled = expected * (GPS_L1_HZ / f) * (GPS_L1_HZ / f);
+    fail_unless(fabs(d[k] - scaled) < 1e-9 && d[k] > d_l1[k],
+                "Batch delay %f not scaled to signal frequency, expected %f",
+                d[k],
+                scaled);
+  }
+}
+END_TEST
+
 START_TEST(test_decode_iono_parameters) {
 #define tol 1e-12
   struct {
@@ -170,6 +211,7 @@ Suite *ionosphere_suite(void) {
 
   TCase *tc_core = tcase_create("Core");
   tcase_add_test(tc_core, test_calc_ionosphere);
+  tcase_add_test(tc_core, test_calc_ionosphere_batch);
   tcase_add_test(tc_core, test_decode_iono_parameters);
   suite_add_tcase(s, tc_core);
 
@@ -24,6 +24,7 @@ int main(void) {
   srunner_add_suite(sr, gnss_time_test_suite());
   srunner_add_suite(sr, signal_test_suite());
   srunner_add_suite(sr, geoid_model_test_suite());
+  srunner_add_suite(sr, geoid_grid_suite());
   srunner_add_suite(sr, glo_map_test_suite());
   srunner_add_suite(sr, shm_suite());
   srunner_add_suite(sr, pvt_test_suite());
@@ -32,6 +33,11 @@ int main(void) {
   srunner_add_suite(sr, status_report_suite());
   srunner_add_suite(sr, log_suite());
   srunner_add_suite(sr, gnss_time_cpp_test_suite());
+  srunner_add_suite(sr, udu_filter_suite());
+  srunner_add_suite(sr, nequick_suite());
+  srunner_add_suite(sr, sbas_suite());
+  srunner_add_suite(sr, signal_cpp_test_suite());
+  srunner_add_suite(sr, set_cpp_test_suite());
 
   srunner_set_fork_status(sr, CK_NOFORK);
   srunner_run_all(sr, CK_NORMAL);
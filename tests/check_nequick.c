@@ -0,0 +1,567 @@
+#include <check.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <swiftnav/constants.h>
+#include <swiftnav/nequick.h>
+
+#include "check_suites.h"
+
+#define RE_KM 6371.2
+
+static nequick_data_t data;
+
+static double linear_modip(double lat, double lon) {
+  return 0.8 * lat + 0.05 * lon;
+}
+
+/* Synthetic tables: linear modip and foF2 / M(3000)F2 maps that are constant
+ * in space and time. foF2 is 8 MHz at low and 10 MHz at high solar activity,
+ * M(3000)F2 is 3. */
+static void fill_data(void) {
+  memset(&data, 0, sizeof(data));
+  for (u32 i = 0; i < NEQUICK_MODIP_ROWS; i++) {
+    for (u32 j = 0; j < NEQUICK_MODIP_COLS; j++) {
+      data.modip[i][j] = linear_modip(5.0 * i - 95.0, 10.0 * j - 190.0);
+    }
+  }
+  data.modip_loaded = true;
+  for (u32 m = 0; m < 12; m++) {
+    data.f2[m][0][0][0] = 8;
+    data.f2[m][1][0][0] = 10;
+    data.fm3[m][0][0][0] = 3;
+    data.fm3[m][1][0][0] = 3;
+    data.ccir_loaded[m] = true;
+  }
+}
+
+static void prepare(nequick_context_t *ctx,
+                    u8 month,
+                    u8 hour,
+                    double lat,
+                    double lon,
+                    double h) {
+  static const nequick_coeffs_t coeffs = {.ai0 = 120, .ai1 = 0.1};
+  utc_tm t = {.year = 2026, .month = month, .hour = hour};
+  nequick_init(ctx, &data, &coeffs);
+  fail_unless(nequick_prepare(ctx, &t, lat * D2R, lon * D2R, h) == 0,
+              "nequick_prepare() failed");
+}
+
+/* Point a fraction `f` of the way from the receiver to the satellite. */
+static void ray_point(const double x1[3],
+                      const double x2[3],
+                      double f,
+                      double *lat,
+                      double *lon,
+                      double *h) {
+  double x[3];
+  for (u32 i = 0; i < 3; i++) {
+    x[i] = x1[i] + f * (x2[i] - x1[i]);
+  }
+  double r = sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]);
+  *lat = asin(x[2] / r) * R2D;
+  *lon = atan2(x[1], x[0]) * R2D;
+  *h = r - RE_KM;
+}
+
+/* Reference slant TEC by composite Simpson's rule with a fixed step. */
+static double simpson_stec(const nequick_context_t *ctx,
+                           double lat2,
+                           double lon2,
+                           double h2,
+                           u32 n) {
+  double r1 = RE_KM + ctx->rx_h;
+  double r2 = RE_KM + h2;
+  double la1 = ctx->rx_lat * D2R, lo1 = ctx->rx_lon * D2R;
+  double la2 = lat2 * D2R, lo2 = lon2 * D2R;
+  double x1[3] = {r1 * cos(la1) * cos(lo1),
+                  r1 * cos(la1) * sin(lo1),
+                  r1 * sin(la1)};
+  double x2[3] = {r2 * cos(la2) * cos(lo2),
+                  r2 * cos(la2) * sin(lo2),
+                  r2 * sin(la2)};
+  double d = 0;
+  for (u32 i = 0; i < 3; i++) {
+    d += (x2[i] - x1[i]) * (x2[i] - x1[i]);
+  }
+  d = sqrt(d);
+
+  double sum = 0;
+  for (u32 k = 0; k <= n; k++) {
+    double lat, lon, h;
+    ray_point(x1, x2, (double)k / n, &lat, &lon, &h);
+    double w = (0 == k || n == k) ? 1 : ((k & 1) ? 4 : 2);
+    sum += w * nequick_electron_density(ctx, lat, lon, h);
+  }
+  return sum * d / n / 3 * 1e-13;
+}
+
+START_TEST(test_nequick_modip) {
+  fill_data();
+  for (double lat = -89.5; lat < 90; lat += 3.7) {
+    for (double lon = -180; lon < 540; lon += 7.3) {
+      double lon_n = fmod(lon + 180, 360) - 180;
+      double mu = nequick_modip(&data, lat, lon);
+      fail_unless(fabs(mu - linear_modip(lat, lon_n)) < 1e-9,
+                  "modip at %f, %f: %f != %f",
+                  lat,
+                  lon,
+                  mu,
+                  linear_modip(lat, lon_n));
+    }
+  }
+  fail_unless(nequick_modip(&data, 90, 10) == 90, "North pole modip");
+  fail_unless(nequick_modip(&data, -90, 10) == -90, "South pole modip");
+}
+END_TEST
+
+START_TEST(test_nequick_load) {
+  const char *path = "check_nequick.asc";
+  fill_data();
+
+  FILE *f = fopen(path, "w");
+  fail_unless(NULL != f, "Unable to create modip file");
+  for (u32 i = 0; i < NEQUICK_MODIP_ROWS; i++) {
+    for (u32 j = 0; j < NEQUICK_MODIP_COLS; j++) {
+      fprintf(f, "%8.3f%s", i - 0.5 * j, (j % 10 == 9) ? "\n" : "");
+    }
+    fprintf(f, "\n");
+  }
+  fclose(f);
+  data.modip_loaded = false;
+  fail_unless(nequick_load_modip(&data, path) == 0, "Unable to load modip");
+  fail_unless(data.modip_loaded, "Loaded modip grid not marked");
+  fail_unless(data.modip[0][0] == 0 && data.modip[38][0] == 38 &&
+                  data.modip[3][7] == -0.5,
+              "Modip grid loaded incorrectly");
+
+  /* CCIR files are too short for a modip grid and vice versa. */
+  data.modip[0][0] = 42;
+  fail_unless(nequick_load_ccir(&data, 1, path) < 0, "Short CCIR accepted");
+
+  f = fopen(path, "w");
+  fail_unless(NULL != f, "Unable to create CCIR file");
+  u32 n = 2 * (NEQUICK_F2_COEFFS * NEQUICK_F2_HARMONICS +
+               NEQUICK_FM3_COEFFS * NEQUICK_FM3_HARMONICS);
+  for (u32 i = 0; i < n; i++) {
+    fprintf(f, " %.8E%s", i * 0.25, (i % 4 == 3) ? "\n" : "");
+  }
+  fclose(f);
+  fail_unless(nequick_load_modip(&data, path) < 0, "Long modip accepted");
+  fail_unless(data.modip[0][0] == 42, "Failed load changed the tables");
+  fail_unless(nequick_load_ccir(&data, 13, path) < 0, "Month 13 accepted");
+  data.ccir_loaded[2] = false;
+  fail_unless(nequick_load_ccir(&data, 3, path) == 0, "Unable to load CCIR");
+  fail_unless(data.ccir_loaded[2], "Loaded month not marked");
+  fail_unless(data.f2[2][0][0][1] == 0.25 && data.f2[2][0][1][0] == 3.25 &&
+                  data.f2[2][1][0][0] == 247,
+              "foF2 map loaded incorrectly");
+  fail_unless(data.fm3[2][0][0][0] == 494 && data.fm3[2][1][0][0] == 604.25,
+              "M(3000)F2 map loaded incorrectly");
+  remove(path);
+  fail_unless(nequick_load_ccir(&data, 3, path) < 0, "Missing file accepted");
+}
+END_TEST
+
+/* Deterministic pseudo random number in [-1, 1). */
+static double rand_unit(u32 *state) {
+  *state = *state * 1664525u + 1013904223u;
+  return (*state >> 8) / 8388608.0 - 1;
+}
+
+/* Cubic through (-1, z[0]), (0, z[1]), (1, z[2]) and (2, z[3]). */
+static double lagrange4(const double z[4], double x) {
+  return -z[0] * x * (x - 1) * (x - 2) / 6 +
+         z[1] * (x + 1) * (x - 1) * (x - 2) / 2 -
+         z[2] * (x + 1) * x * (x - 2) / 2 + z[3] * (x + 1) * x * (x - 1) / 6;
+}
+
+/* Reference modip by bicubic Lagrange interpolation, for latitudes within
+ * 85 degrees and longitudes in [-180, 180). */
+static double reference_modip(double lat, double lon) {
+  double y = (lat + 90) / 5 + 1;
+  double x = (lon + 180) / 10 + 1;
+  int i = (int)floor(y);
+  int j = (int)floor(x);
+  double z[4];
+  for (int k = 0; k < 4; k++) {
+    double col[4];
+    for (int l = 0; l < 4; l++) {
+      col[l] = data.modip[i - 1 + l][j - 1 + k];
+    }
+    z[k] = lagrange4(col, y - i);
+  }
+  return lagrange4(z, x - j);
+}
+
+/* Reference CCIR map in space: the Legendre terms of order `q` are
+ * `terms[q]` pairs of cos(q lon) and sin(q lon) coefficients. */
+static double reference_map(const double *c,
+                            const u8 *terms,
+                            u32 n_q,
+                            double mu,
+                            double lat,
+                            double lon) {
+  double sin_mu = sin(mu * D2R);
+  double v = 0;
+  u32 idx = 0;
+  for (u32 k = 0; k < terms[0]; k++) {
+    v += c[idx++] * pow(sin_mu, k);
+  }
+  for (u32 q = 1; q <= n_q; q++) {
+    double g = pow(cos(lat * D2R), q);
+    for (u32 k = 0; k < terms[q]; k++, idx += 2) {
+      v += (c[idx] * cos(q * lon * D2R) + c[idx + 1] * sin(q * lon * D2R)) *
+           g * pow(sin_mu, k);
+    }
+  }
+  return v;
+}
+
+/* Reference CCIR map in time at universal time `ut` [h] for sunspot weight
+ * `w`, `n_h` harmonics per coefficient. */
+static void reference_time(const double *low,
+                           const double *high,
+                           u32 n_c,
+                           u32 n_h,
+                           double w,
+                           double ut,
+                           double *out) {
+  double tt = (15 * ut - 180) * D2R;
+  for (u32 j = 0; j < n_c; j++) {
+    const double *a0 = &low[j * n_h];
+    const double *a1 = &high[j * n_h];
+    out[j] = a0[0] * (1 - w) + a1[0] * w;
+    for (u32 k = 1; 2 * k < n_h; k++) {
+      out[j] += (a0[2 * k - 1] * (1 - w) + a1[2 * k - 1] * w) * sin(k * tt) +
+                (a0[2 * k] * (1 - w) + a1[2 * k] * w) * cos(k * tt);
+    }
+  }
+}
+
+/* Pseudo random MODIP grid and CCIR maps written in the distributed text
+ * formats, loaded, and the evaluated maps compared with the reference. */
+START_TEST(test_nequick_ccir_maps) {
+  static const u8 f2_terms[9] = {12, 12, 9, 5, 2, 1, 1, 1, 1};
+  static const nequick_coeffs_t coeffs = {
+      .ai0 = 80, .ai1 = 0.4, .ai2 = 0.004};
+  const char *path = "check_nequick_maps.asc";
+  u32 seed = 37;
+  memset(&data, 0, sizeof(data));
+
+  FILE *f = fopen(path, "w");
+  fail_unless(NULL != f, "Unable to create modip file");
+  for (u32 i = 0; i < NEQUICK_MODIP_ROWS; i++) {
+    for (u32 j = 0; j < NEQUICK_MODIP_COLS; j++) {
+      double lat = 5.0 * i - 95.0;
+      double lon = 10.0 * j - 190.0;
+      double mu = 60 * sin(lat * D2R) + 8 * cos(lon * D2R) + rand_unit(&seed);
+      fprintf(f, "%9.3f%s", mu, (j % 10 == 9) ? "\n" : "");
+    }
+    fprintf(f, "\n");
+  }
+  fclose(f);
+  fail_unless(nequick_load_modip(&data, path) == 0, "Unable to load modip");
+
+  /* foF2 around 8 MHz at low and 10 MHz at high solar activity, M(3000)F2
+   * around 3. */
+  f = fopen(path, "w");
+  fail_unless(NULL != f, "Unable to create CCIR file");
+  u32 n = 0;
+  for (u32 s = 0; s < 2; s++) {
+    for (u32 i = 0; i < NEQUICK_F2_COEFFS * NEQUICK_F2_HARMONICS; i++) {
+      double v = (0 == i) ? 8 + 2 * s : 0.05 * rand_unit(&seed);
+      fprintf(f, " %.8E%s", v, (n++ % 4 == 3) ? "\n" : "");
+    }
+  }
+  for (u32 s = 0; s < 2; s++) {
+    for (u32 i = 0; i < NEQUICK_FM3_COEFFS * NEQUICK_FM3_HARMONICS; i++) {
+      double v = (0 == i) ? 3 : 0.005 * rand_unit(&seed);
+      fprintf(f, " %.8E%s", v, (n++ % 4 == 3) ? "\n" : "");
+    }
+  }
+  fclose(f);
+  fail_unless(nequick_load_ccir(&data, 7, path) == 0, "Unable to load CCIR");
+  remove(path);
+
+  for (u32 k = 0; k < 200; k++) {
+    double lat = 85 * rand_unit(&seed);
+    double lon = 180 * rand_unit(&seed);
+    double mu = nequick_modip(&data, lat, lon);
+    fail_unless(fabs(mu - reference_modip(lat, lon)) < 1e-9,
+                "modip at %f, %f: %f != %f",
+                lat,
+                lon,
+                mu,
+                reference_modip(lat, lon));
+  }
+
+  static const double rx[][3] = {{40.5, 15.25, 9.5}, {-33.9, 151.2, 22.75}};
+  for (u32 r = 0; r < sizeof(rx) / sizeof(rx[0]); r++) {
+    nequick_context_t ctx;
+    utc_tm t = {.year = 2026,
+                .month = 7,
+                .hour = (u8)rx[r][2],
+                .minute = (u8)(60 * fmod(rx[r][2], 1))};
+    nequick_init(&ctx, &data, &coeffs);
+    fail_unless(
+        nequick_prepare(&ctx, &t, rx[r][0] * D2R, rx[r][1] * D2R, 0) == 0,
+        "nequick_prepare() failed");
+
+    double mu = reference_modip(rx[r][0], rx[r][1]);
+    double az = coeffs.ai0 + coeffs.ai1 * mu + coeffs.ai2 * mu * mu;
+    double az_r = sqrt(167273 + (az - 63.7) * 1123.6) - 408.99;
+    fail_unless(fabs(ctx.az_r - az_r) < 1e-9,
+                "Effective sunspot number %f != %f",
+                ctx.az_r,
+                az_r);
+
+    double cf2[NEQUICK_F2_COEFFS];
+    double cm3[NEQUICK_FM3_COEFFS];
+    reference_time(&data.f2[6][0][0][0],
+                   &data.f2[6][1][0][0],
+                   NEQUICK_F2_COEFFS,
+                   NEQUICK_F2_HARMONICS,
+                   az_r / 100,
+                   rx[r][2],
+                   cf2);
+    reference_time(&data.fm3[6][0][0][0],
+                   &data.fm3[6][1][0][0],
+                   NEQUICK_FM3_COEFFS,
+                   NEQUICK_FM3_HARMONICS,
+                   az_r / 100,
+                   rx[r][2],
+                   cm3);
+    for (u32 j = 0; j < NEQUICK_F2_COEFFS; j++) {
+      fail_unless(fabs(ctx.cf2[j] - cf2[j]) < 1e-12,
+                  "foF2 coefficient %u: %g != %g",
+                  j,
+                  ctx.cf2[j],
+                  cf2[j]);
+    }
+    for (u32 j = 0; j < NEQUICK_FM3_COEFFS; j++) {
+      fail_unless(fabs(ctx.cm3[j] - cm3[j]) < 1e-12,
+                  "M(3000)F2 coefficient %u: %g != %g",
+                  j,
+                  ctx.cm3[j],
+                  cm3[j]);
+    }
+
+    /* The F2 peak density along a few verticals. */
+    for (u32 k = 0; k < 4; k++) {
+      double lat = rx[r][0] + 10 * rand_unit(&seed);
+      double lon = rx[r][1] + 10 * rand_unit(&seed);
+      double fo_f2 = reference_map(cf2,
+                                   f2_terms,
+                                   8,
+                                   reference_modip(lat, lon),
+                                   lat,
+                                   lon);
+      double nm_f2 = 0.124 * fo_f2 * fo_f2 * 1e11;
+      double peak_h = 100;
+      for (double h = 100; h < 1000; h += 1) {
+        if (nequick_electron_density(&ctx, lat, lon, h) >
+            nequick_electron_density(&ctx, lat, lon, peak_h)) {
+          peak_h = h;
+        }
+      }
+      double peak = 0;
+      for (double h = peak_h - 1; h < peak_h + 1; h += 1e-3) {
+        peak = MAX(peak, nequick_electron_density(&ctx, lat, lon, h));
+      }
+      fail_unless(fabs(peak / nm_f2 - 1) < 1e-6,
+                  "F2 peak density at %f, %f: %g != %g",
+                  lat,
+                  lon,
+                  peak,
+                  nm_f2);
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_nequick_profile) {
+  fill_data();
+  nequick_context_t ctx;
+  prepare(&ctx, 3, 12, 45, 10, 0);
+  double fo_f2 = 8 + 2 * ctx.az_r / 100;
+  double nm_f2 = 0.124 * fo_f2 * fo_f2 * 1e11;
+
+  /* The F2 peak dominates, the E and F1 layers vanish at its height. */
+  double peak = 0;
+  double peak_h = 0;
+  for (double h = 100; h < 1000; h += 0.01) {
+    double n = nequick_electron_density(&ctx, 45, 10, h);
+    if (n > peak) {
+      peak = n;
+      peak_h = h;
+    }
+  }
+  fail_unless(fabs(peak / nm_f2 - 1) < 1e-6,
+              "F2 peak density %g != %g",
+              peak,
+              nm_f2);
+  fail_unless(peak_h > 200 && peak_h < 500, "F2 peak at %f km", peak_h);
+
+  double below = nequick_electron_density(&ctx, 45, 10, 50);
+  double at100 = nequick_electron_density(&ctx, 45, 10, 100);
+  double top = nequick_electron_density(&ctx, 45, 10, 20000);
+  fail_unless(below > 0 && below < at100, "Chapman layer below 100 km");
+  fail_unless(top > 0 && top < 1e-3 * nm_f2, "Topside density %g", top);
+}
+END_TEST
+
+START_TEST(test_nequick_vertical) {
+  fill_data();
+  nequick_context_t ctx;
+  prepare(&ctx, 7, 14, -30, 150, 100);
+  double stec;
+  fail_unless(nequick_stec(&ctx, -30 * D2R, 150 * D2R, 20200e3, &stec) == 0,
+              "Vertical STEC failed");
+  double ref = simpson_stec(&ctx, -30, 150, 20200, 200000);
+  fail_unless(stec > 1 && fabs(stec / ref - 1) < 2e-3,
+              "Vertical STEC %f != %f",
+              stec,
+              ref);
+}
+END_TEST
+
+START_TEST(test_nequick_slant) {
+  static const double sats[][3] = {
+      {30, 40, 23222}, {-20, 80, 23222}, {70, -10, 20200}, {5, 20, 800}};
+  fill_data();
+  nequick_context_t ctx;
+  prepare(&ctx, 11, 9, 10, 30, 50);
+  for (u32 i = 0; i < sizeof(sats) / sizeof(sats[0]); i++) {
+    double stec;
+    fail_unless(nequick_stec(&ctx,
+                             sats[i][0] * D2R,
+                             sats[i][1] * D2R,
+                             sats[i][2] * 1e3,
+                             &stec) == 0,
+                "STEC %u failed",
+                i);
+    double ref = simpson_stec(&ctx, sats[i][0], sats[i][1], sats[i][2], 40000);
+    fail_unless(stec > 0 && fabs(stec / ref - 1) < 5e-3,
+                "STEC %u: %f != %f",
+                i,
+                stec,
+                ref);
+  }
+
+  /* Satellite on the other side of the Earth. */
+  double stec;
+  fail_unless(nequick_stec(&ctx, -10 * D2R, -150 * D2R, 20200e3, &stec) < 0,
+              "Satellite below the horizon accepted");
+}
+END_TEST
+
+START_TEST(test_nequick_batch) {
+  fill_data();
+  nequick_context_t ctx;
+  prepare(&ctx, 5, 20, 52, -1, 30);
+
+  double lat[6] = {60, 60, 40, -60, 45, 45};
+  double lon[6] = {20, 20, -30, 120, 5, 5};
+  double h[6] = {23222e3, 23222e3, 20200e3, 20200e3, 21528e3, 21528e3};
+  gnss_signal_t sids[6] = {{1, CODE_GAL_E1B},
+                           {1, CODE_GAL_E5X},
+                           {5, CODE_GPS_L1CA},
+                           {7, CODE_GAL_E1B},
+                           {3, CODE_BDS2_B1},
+                           {3, CODE_BDS2_B2}};
+  for (u32 i = 0; i < 6; i++) {
+    lat[i] *= D2R;
+    lon[i] *= D2R;
+  }
+  double delay[6];
+  fail_unless(nequick_delay_batch(&ctx, 6, lat, lon, h, sids, delay) < 0,
+              "Satellite below the horizon not reported");
+  for (u32 i = 0; i < 6; i++) {
+    double stec;
+    s8 ret = nequick_stec(&ctx, lat[i], lon[i], h[i], &stec);
+    double f = sid_to_carr_freq(sids[i]);
+    double expected = (ret < 0) ? 0 : 40.3e16 * stec / (f * f);
+    fail_unless(fabs(delay[i] - expected) < 1e-12,
+                "Batch delay %u: %f != %f",
+                i,
+                delay[i],
+                expected);
+  }
+  fail_unless(delay[3] == 0 && delay[0] > 0 && delay[1] > delay[0],
+              "Batch delays inconsistent");
+
+  double delay_e1[6];
+  nequick_delay_batch(&ctx, 6, lat, lon, h, NULL, delay_e1);
+  fail_unless(delay_e1[1] == delay[0], "Default frequency is not E1");
+
+  /* Updating the cached epoch and receiver gives the same result as a
+   * freshly prepared context. */
+  utc_tm t = {.year = 2026, .month = 9, .hour = 3};
+  fail_unless(nequick_prepare(&ctx, &t, 10 * D2R, 20 * D2R, 0) == 0,
+              "nequick_prepare() failed");
+  t.month = 5;
+  t.hour = 20;
+  fail_unless(nequick_prepare(&ctx, &t, 52 * D2R, -1 * D2R, 30) == 0,
+              "nequick_prepare() failed");
+  nequick_delay_batch(&ctx, 6, lat, lon, h, sids, delay_e1);
+  fail_unless(memcmp(delay, delay_e1, sizeof(delay)) == 0,
+              "Cached context differs from a fresh one");
+
+  t.month = 0;
+  fail_unless(nequick_prepare(&ctx, &t, 0, 0, 0) < 0, "Month 0 accepted");
+}
+END_TEST
+
+START_TEST(test_nequick_bad_maps) {
+  static const nequick_coeffs_t coeffs = {.ai0 = 120, .ai1 = 0.1};
+  fill_data();
+  nequick_context_t ctx;
+  nequick_init(&ctx, &data, &coeffs);
+
+  utc_tm t = {.year = 2026, .month = 4, .hour = 12};
+  data.ccir_loaded[3] = false;
+  fail_unless(nequick_prepare(&ctx, &t, 0, 0, 0) < 0,
+              "Month without CCIR maps accepted");
+  data.ccir_loaded[3] = true;
+  data.modip_loaded = false;
+  fail_unless(nequick_prepare(&ctx, &t, 0, 0, 0) < 0,
+              "Missing modip grid accepted");
+  data.modip_loaded = true;
+
+  /* A zero M(3000)F2 map gives no finite F2 peak height. */
+  memset(data.fm3[3], 0, sizeof(data.fm3[3]));
+  fail_unless(nequick_prepare(&ctx, &t, 0, 0, 0) == 0,
+              "nequick_prepare() failed");
+  double stec = -1;
+  fail_unless(nequick_stec(&ctx, 30 * D2R, 20 * D2R, 23222e3, &stec) < 0,
+              "Non finite STEC accepted");
+  fail_unless(stec == -1, "STEC written on failure");
+
+  double lat = 30 * D2R;
+  double lon = 20 * D2R;
+  double h = 23222e3;
+  double delay = -1;
+  fail_unless(nequick_delay_batch(&ctx, 1, &lat, &lon, &h, NULL, &delay) < 0,
+              "Non finite delay accepted");
+  fail_unless(delay == 0, "Delay not zeroed on failure");
+}
+END_TEST
+
+Suite *nequick_suite(void) {
+  Suite *s = suite_create("NeQuick-G");
+
+  TCase *tc_core = tcase_create("Core");
+  tcase_add_test(tc_core, test_nequick_modip);
+  tcase_add_test(tc_core, test_nequick_load);
+  tcase_add_test(tc_core, test_nequick_ccir_maps);
+  tcase_add_test(tc_core, test_nequick_profile);
+  tcase_add_test(tc_core, test_nequick_vertical);
+  tcase_add_test(tc_core, test_nequick_slant);
+  tcase_add_test(tc_core, test_nequick_batch);
+  tcase_add_test(tc_core, test_nequick_bad_maps);
+  suite_add_tcase(s, tc_core);
+
+  return s;
+}
@@ -15,6 +15,7 @@
 #include <swiftnav/glonass_phase_biases.h>
 #include <swiftnav/gnss_capabilities.h>
 #include <swiftnav/gnss_time.h>
+#include <swiftnav/gnss_time.hpp>
 #include <swiftnav/ionosphere.h>
 #include <swiftnav/linear_algebra.h>
 #include <swiftnav/logging.h>
@@ -24,9 +25,11 @@
 #include <swiftnav/pvt_result.h>
 #include <swiftnav/sbas_raw_data.h>
 #include <swiftnav/set.h>
+#include <swiftnav/set.hpp>
 #include <swiftnav/shm.h>
 #include <swiftnav/sid_set.h>
 #include <swiftnav/signal.h>
+#include <swiftnav/signal.hpp>
 #include <swiftnav/single_epoch_solver.h>
 #include <swiftnav/troposphere.h>
 
@@ -3,6 +3,7 @@
 #include <stdio.h>
 #include <swiftnav/constants.h>
 #include <swiftnav/coord_system.h>
+#include <swiftnav/linear_algebra.h>
 #include <swiftnav/single_epoch_solver.h>
 
 #include "check_suites.h"
@@ -767,6 +768,256 @@ START_TEST(test_pvt_successful_repair_with_cn0_mask) {
 }
 END_TEST
 
+START_TEST(test_pvt_filter) {
+  gnss_solution soln;
+  gnss_solution ref_soln;
+  dops_t dops;
+  gnss_sid_set_t rejected_sids;
+  obs_mask_config_t obs_mask_config = {{false, 25}};
+  pvt_filter_t filter;
+  pvt_filter_init(&filter, NULL);
+
+  navigation_measurement_t nms[8] = {nm2, nm3, nm4, nm5, nm6, nm7, nm8, nm9};
+
+  s8 ref_code = calc_PVT(8,
+                         nms,
+                         &tor,
+                         false,
+                         false,
+                         &obs_mask_config,
+                         ALL_CONSTELLATIONS,
+                         &ref_soln,
+                         &dops,
+                         &rejected_sids);
+  fail_unless(ref_code >= 0, "Reference solution failed: %d", ref_code);
+
+  /* First epoch seeds the filter from the single epoch solution */
+  s8 code = calc_PVT_filter(&filter,
+                            8,
+                            nms,
+                            &tor,
+                            false,
+                            &obs_mask_config,
+                            &soln,
+                            &dops,
+                            &rejected_sids);
+  fail_unless(code == ref_code, "Seed epoch returned %d", code);
+  fail_unless(soln.valid == 1, "Seed solution should be valid");
+  fail_unless(vector_distance(3, soln.pos_ecef, ref_soln.pos_ecef) < 1e-6,
+              "Seed solution differs from calc_PVT");
+
+  /* Static receiver, the filter stays on the single epoch solution */
+  gps_time_t t = tor;
+  for (u8 i = 0; i < 5; i++) {
+    add_secs(&t, 1.0);
+    code = calc_PVT_filter(&filter,
+                           8,
+                           nms,
+                           &t,
+                           false,
+                           &obs_mask_config,
+                           &soln,
+                           &dops,
+                           &rejected_sids);
+    fail_unless(
+        code == PVT_CONVERGED_RAIM_OK, "Filter epoch returned %d", code);
+    fail_unless(soln.valid == 1 && soln.velocity_valid == 1,
+                "Filter solution should be valid");
+    fail_unless(soln.n_sats_used == 8, "Saw %u sats", soln.n_sats_used);
+    fail_unless(dops.gdop > 0, "DOPs should be computed");
+  }
+  fail_unless(vector_distance(3, soln.pos_ecef, ref_soln.pos_ecef) < 1.0,
+              "Filter position too far from single epoch solution: %.2f m",
+              vector_distance(3, soln.pos_ecef, ref_soln.pos_ecef));
+  fail_unless(vector_norm(3, soln.vel_ecef) < 0.5,
+              "Static receiver velocity %.2f m/s",
+              vector_norm(3, soln.vel_ecef));
+
+  /* Too few satellites for a single epoch solution */
+  add_secs(&t, 1.0);
+  code = calc_PVT_filter(&filter,
+                         3,
+                         nms,
+                         &t,
+                         false,
+                         &obs_mask_config,
+                         &soln,
+                         &dops,
+                         &rejected_sids);
+  fail_unless(code >= 0, "Low satellite count epoch returned %d", code);
+  fail_unless(soln.valid == 1, "Low satellite count solution invalid");
+  fail_unless(vector_distance(3, soln.pos_ecef, ref_soln.pos_ecef) < 2.0,
+              "Low satellite count solution drifted %.2f m",
+              vector_distance(3, soln.pos_ecef, ref_soln.pos_ecef));
+
+  /* Outlier is rejected by the innovation gate */
+  navigation_measurement_t nms_outlier[9] = {
+      nm2, nm3, nm4, nm5, nm6, nm7, nm8, nm9, nm10b};
+  add_secs(&t, 1.0);
+  code = calc_PVT_filter(&filter,
+                         9,
+                         nms_outlier,
+                         &t,
+                         false,
+                         &obs_mask_config,
+                         &soln,
+                         &dops,
+                         &rejected_sids);
+  fail_unless(
+      code == PVT_CONVERGED_RAIM_REPAIR, "Outlier epoch returned %d", code);
+  fail_unless(sid_set_contains(&rejected_sids, nm10b.sid),
+              "Outlier was not rejected");
+  fail_unless(soln.n_sigs_used == 8, "Saw %u signals", soln.n_sigs_used);
+
+  /* Time running backwards re-seeds the filter */
+  code = calc_PVT_filter(&filter,
+                         8,
+                         nms,
+                         &tor,
+                         false,
+                         &obs_mask_config,
+                         &soln,
+                         &dops,
+                         &rejected_sids);
+  fail_unless(code == ref_code, "Re-seed epoch returned %d", code);
+  fail_unless(vector_distance(3, soln.pos_ecef, ref_soln.pos_ecef) < 1e-6,
+              "Re-seeded solution differs from calc_PVT");
+
+  /* Unseeded filter needs a full single epoch solution */
+  pvt_filter_reset(&filter);
+  code = calc_PVT_filter(&filter,
+                         3,
+                         nms,
+                         &tor,
+                         false,
+                         &obs_mask_config,
+                         &soln,
+                         &dops,
+                         &rejected_sids);
+  fail_unless(
+      code == PVT_INSUFFICENT_MEAS, "Unseeded filter returned %d", code);
+
+  /* No usable measurements */
+  code = calc_PVT_filter(&filter,
+                         0,
+                         nms,
+                         &tor,
+                         false,
+                         &obs_mask_config,
+                         &soln,
+                         &dops,
+                         &rejected_sids);
+  fail_unless(code == PVT_INSUFFICENT_MEAS, "Empty epoch returned %d", code);
+  fail_unless(soln.valid == 0, "Empty epoch solution should be invalid");
+}
+END_TEST
+
+START_TEST(test_pvt_filter_velocity_lockout) {
+  gnss_solution soln;
+  dops_t dops;
+  gnss_sid_set_t rejected_sids;
+  obs_mask_config_t obs_mask_config = {{false, 25}};
+  pvt_filter_t filter;
+  pvt_filter_init(&filter, NULL);
+
+  navigation_measurement_t nms[8] = {nm2, nm3, nm4, nm5, nm6, nm7, nm8, nm9};
+  s8 code = calc_PVT_filter(&filter,
+                            8,
+                            nms,
+                            &tor,
+                            false,
+                            &obs_mask_config,
+                            &soln,
+                            &dops,
+                            &rejected_sids);
+  fail_unless(code >= 0, "Seed epoch returned %d", code);
+
+  /* Force the velocity state above 1000 kts. Without Doppler measurements
+   * and with no time elapsed, the next epoch leaves it there. */
+  filter.kf.x[3 + CONSTELLATION_COUNT] = 600.0;
+
+  /* Four satellites with a GDOP far above 20 */
+  navigation_measurement_t nms_bad_geometry[4] = {nm2, nm3, nm4, nm7};
+  for (u8 i = 0; i < 4; i++) {
+    nms_bad_geometry[i].flags &= ~NAV_MEAS_FLAG_MEAS_DOPPLER_VALID;
+  }
+  code = calc_PVT_filter(&filter,
+                         4,
+                         nms_bad_geometry,
+                         &tor,
+                         false,
+                         &obs_mask_config,
+                         &soln,
+                         &dops,
+                         &rejected_sids);
+  fail_unless(dops.gdop > 20.0, "Expected a GDOP above 20, saw %f", dops.gdop);
+  fail_unless(code == PVT_VELOCITY_LOCKOUT, "Lockout epoch returned %d", code);
+  fail_unless(soln.valid == 0, "Lockout solution should be invalid");
+}
+END_TEST
+
+/* A measurement with a good pseudorange but a bad Doppler is rejected as a
+ * whole, its pseudorange must not have moved the filter. */
+START_TEST(test_pvt_filter_bad_doppler) {
+  gnss_solution soln, ref_soln;
+  dops_t dops;
+  gnss_sid_set_t rejected_sids;
+  obs_mask_config_t obs_mask_config = {{false, 25}};
+  pvt_filter_t filter, ref_filter;
+  pvt_filter_init(&filter, NULL);
+
+  navigation_measurement_t nms[8] = {nm2, nm3, nm4, nm5, nm6, nm7, nm8, nm9};
+  s8 code = calc_PVT_filter(&filter,
+                            8,
+                            nms,
+                            &tor,
+                            false,
+                            &obs_mask_config,
+                            &soln,
+                            &dops,
+                            &rejected_sids);
+  fail_unless(code >= 0, "Seed epoch returned %d", code);
+  ref_filter = filter;
+
+  gps_time_t t = tor;
+  add_secs(&t, 1.0);
+  navigation_measurement_t nms_bad_doppler[8] = {
+      nm2, nm3, nm4, nm5, nm6, nm7, nm8, nm9};
+  nms_bad_doppler[7].raw_measured_doppler += 1000.0;
+  code = calc_PVT_filter(&filter,
+                         8,
+                         nms_bad_doppler,
+                         &t,
+                         false,
+                         &obs_mask_config,
+                         &soln,
+                         &dops,
+                         &rejected_sids);
+  fail_unless(
+      code == PVT_CONVERGED_RAIM_REPAIR, "Bad Doppler epoch returned %d", code);
+  fail_unless(sid_set_contains(&rejected_sids, nm9.sid),
+              "Bad Doppler was not rejected");
+  fail_unless(soln.n_sigs_used == 7, "Saw %u signals", soln.n_sigs_used);
+
+  s8 ref_code = calc_PVT_filter(&ref_filter,
+                                7,
+                                nms,
+                                &t,
+                                false,
+                                &obs_mask_config,
+                                &ref_soln,
+                                &dops,
+                                &rejected_sids);
+  fail_unless(ref_code == PVT_CONVERGED_RAIM_OK,
+              "Reference epoch returned %d",
+              ref_code);
+  fail_unless(vector_distance(3, soln.pos_ecef, ref_soln.pos_ecef) < 1e-9 &&
+                  fabs(soln.clock_offset - ref_soln.clock_offset) < 1e-15,
+              "Rejected pseudorange changed the solution by %g m",
+              vector_distance(3, soln.pos_ecef, ref_soln.pos_ecef));
+}
+END_TEST
+
 Suite *pvt_test_suite(void) {
   Suite *s = suite_create("PVT Solver");
 
@@ -786,6 +1037,9 @@ Suite *pvt_test_suite(void) {
   tcase_add_test(tc_core, test_count_sats_l1ca_only);
   tcase_add_test(tc_core, test_dops);
   tcase_add_test(tc_core, test_pvt_successful_repair_with_cn0_mask);
+  tcase_add_test(tc_core, test_pvt_filter);
+  tcase_add_test(tc_core, test_pvt_filter_velocity_lockout);
+  tcase_add_test(tc_core, test_pvt_filter_bad_doppler);
   suite_add_tcase(s, tc_core);
 
   return s;
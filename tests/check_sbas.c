@@ -0,0 +1,544 @@
+#include <check.h>
+#include <math.h>
+#include <string.h>
+#include <swiftnav/bits.h>
+#include <swiftnav/constants.h>
+#include <swiftnav/edc.h>
+#include <swiftnav/sbas.h>
+
+#include "check_suites.h"
+
+static sbas_decoder_t dec;
+static u8 frame[SBAS_FRAME_BYTES];
+
+static void frame_start(u8 type) {
+  memset(frame, 0, sizeof(frame));
+  setbitu(frame, 0, 8, 0x9A);
+  setbitu(frame, 8, 6, type);
+}
+
+/* Fields are positioned relative to the start of the data field. */
+static void put_u(u32 pos, u32 len, u32 v) {
+  setbitu(frame, 14 + pos, len, v);
+}
+
+static void put_s(u32 pos, u32 len, s32 v) {
+  setbits(frame, 14 + pos, len, v);
+}
+
+static s8 frame_decode(const gps_time_t *t) {
+  setbitu(frame, 226, 24, crc24q_bits(0, frame, 226, false));
+  return sbas_decode_frame(&dec, frame, t);
+}
+
+static void igp_lat_lon(u16 index, s32 *lat, s32 *lon) {
+  *lat = (index / SBAS_IGP_COLS) * 5 - 90;
+  *lon = (index % SBAS_IGP_COLS) * 5 - 180;
+}
+
+static double linear_delay(double lat, double lon) {
+  return 20 + 0.1 * lat + 0.05 * lon;
+}
+
+/* PRN mask with GPS 1, 5 and 37, GLONASS slot 2 and SBAS 131. */
+static void send_prn_mask(u8 iodp, const gps_time_t *t) {
+  frame_start(1);
+  put_u(0, 1, 1);
+  put_u(4, 1, 1);
+  put_u(36, 1, 1);
+  put_u(38, 1, 1);
+  put_u(130, 1, 1);
+  put_u(210, 2, iodp);
+  fail_unless(frame_decode(t) == 0, "PRN mask rejected");
+}
+
+/* Grid point mask with all points of a band and delays from
+ * linear_delay(), block by block. */
+static void send_igp_band(u8 band, u8 iodi, const gps_time_t *t) {
+  frame_start(18);
+  put_u(0, 4, 1);
+  put_u(4, 4, band);
+  put_u(8, 2, iodi);
+  for (u32 bit = 1; bit <= SBAS_IGP_BAND_SIZE; bit++) {
+    put_u(9 + bit, 1, 1);
+  }
+  fail_unless(frame_decode(t) == 0, "IGP mask rejected");
+
+  u32 n = dec.band_n_igps[band];
+  for (u32 block = 0; block * 15 < n; block++) {
+    frame_start(26);
+    put_u(0, 4, band);
+    put_u(4, 4, block);
+    for (u32 i = 0; i < 15 && block * 15 + i < n; i++) {
+      s32 lat, lon;
+      igp_lat_lon(dec.band_igps[band][block * 15 + i], &lat, &lon);
+      put_u(8 + 13 * i, 9, (u32)(linear_delay(lat, lon) * 8));
+      put_u(17 + 13 * i, 4, 3);
+    }
+    put_u(203, 2, iodi);
+    fail_unless(frame_decode(t) == 0, "IGP delays rejected");
+  }
+}
+
+START_TEST(test_sbas_frame_check) {
+  gps_time_t t = {.wn = 2300, .tow = 1000};
+  sbas_decoder_init(&dec);
+  frame_start(63);
+  fail_unless(frame_decode(&t) == 0, "Null message rejected");
+
+  frame[10] ^= 0x10;
+  fail_unless(sbas_decode_frame(&dec, frame, &t) < 0, "Bad CRC accepted");
+
+  frame_start(63);
+  setbitu(frame, 0, 8, 0x55);
+  fail_unless(frame_decode(&t) < 0, "Bad preamble accepted");
+
+  frame_start(62);
+  fail_unless(frame_decode(&t) < 0, "Unsupported type accepted");
+
+  /* Corrections need a PRN mask first. */
+  frame_start(2);
+  fail_unless(frame_decode(&t) < 0, "Fast corrections without mask");
+}
+END_TEST
+
+START_TEST(test_sbas_fast_corrections) {
+  gps_time_t t = {.wn = 2300, .tow = 1000};
+  gnss_signal_t g1 = {1, CODE_GPS_L1CA};
+  gnss_signal_t g37 = {37, CODE_GPS_L1CA};
+  gnss_signal_t r2 = {2, CODE_GLO_L1OF};
+  gnss_signal_t s131 = {131, CODE_SBAS_L1CA};
+  gnss_signal_t g2 = {2, CODE_GPS_L1CA};
+  sbas_decoder_init(&dec);
+  send_prn_mask(2, &t);
+  fail_unless(dec.n_sats == 5 && dec.sats[3].sid.sat == 2 &&
+                  dec.sats[3].sid.code == CODE_GLO_L1OF &&
+                  dec.sats[4].sid.sat == 131,
+              "PRN mask decoded incorrectly");
+
+  frame_start(2);
+  put_u(0, 2, 1);
+  put_u(2, 2, 2);
+  s32 prc[5] = {-100, 37, 2047, -2048, 8};
+  for (u32 i = 0; i < 5; i++) {
+    put_s(4 + 12 * i, 12, prc[i]);
+    put_u(160 + 4 * i, 4, i);
+  }
+  fail_unless(frame_decode(&t) == 0, "Fast corrections rejected");
+
+  double c, var;
+  fail_unless(sbas_fast_correction(&dec, g1, &t, &c, &var) == 0 &&
+                  c == -12.5 && var == 0.0520,
+              "GPS 1 fast correction %f %f",
+              c,
+              var);
+  fail_unless(sbas_fast_correction(&dec, r2, &t, &c, &var) == 0 &&
+                  c == -256 && var == 0.2830,
+              "GLONASS 2 fast correction %f",
+              c);
+  fail_unless(sbas_fast_correction(&dec, s131, &t, &c, &var) == 0 && c == 1,
+              "SBAS 131 fast correction %f",
+              c);
+  fail_unless(sbas_fast_correction(&dec, g2, &t, &c, &var) < 0,
+              "Correction for a satellite outside the mask");
+
+  /* A second correction gives the rate of change. */
+  gps_time_t t2 = t;
+  t2.tow += 6;
+  frame_start(2);
+  put_u(0, 2, 2);
+  put_u(2, 2, 2);
+  put_s(4, 12, -100 + 48);
+  put_u(160, 4, 1);
+  fail_unless(frame_decode(&t2) == 0, "Fast corrections rejected");
+  gps_time_t t3 = t2;
+  t3.tow += 2;
+  fail_unless(sbas_fast_correction(&dec, g1, &t3, &c, &var) == 0 &&
+                  fabs(c - (-6.5 + 2 * 1.0)) < 1e-12,
+              "Extrapolated fast correction %f",
+              c);
+  t3.tow += SBAS_FAST_CORR_TIMEOUT;
+  fail_unless(sbas_fast_correction(&dec, g1, &t3, &c, &var) < 0,
+              "Timed out fast correction used");
+
+  /* Mismatched IODP is ignored. */
+  frame_start(2);
+  put_u(2, 2, 1);
+  fail_unless(frame_decode(&t2) < 0, "Mismatched IODP accepted");
+
+  /* Integrity information for the current IODF and an alert. */
+  frame_start(6);
+  put_u(0, 2, 1);
+  for (u32 i = 0; i < 5; i++) {
+    put_u(8 + 4 * i, 4, 10);
+  }
+  fail_unless(frame_decode(&t2) == 0, "Integrity message rejected");
+  fail_unless(dec.sats[0].udrei == 1 && dec.sats[1].udrei == 0,
+              "UDREI of a different IODF applied");
+  put_u(0, 2, 3);
+  put_u(8 + 4 * 4, 4, SBAS_UDREI_DO_NOT_USE);
+  fail_unless(frame_decode(&t2) == 0, "Integrity message rejected");
+  fail_unless(dec.sats[0].udrei == 10, "Alert UDREI not applied");
+  fail_unless(sbas_fast_correction(&dec, s131, &t2, &c, &var) < 0,
+              "Do not use satellite corrected");
+  fail_unless(sbas_fast_correction(&dec, g37, &t2, &c, &var) == 0 &&
+                  var == 5.1968,
+              "UDRE variance %f",
+              var);
+
+  frame_start(7);
+  put_u(0, 4, 9);
+  put_u(4, 2, 2);
+  put_u(8 + 4 * 2, 4, 6);
+  fail_unless(frame_decode(&t2) == 0, "Degradation message rejected");
+  fail_unless(dec.tlat == 9 && dec.sats[2].ai == 6, "Degradation factors");
+
+  /* The same data field without preamble and CRC. */
+  static sbas_decoder_t before, from_raw;
+  before = dec;
+  sbas_raw_data_t raw = {.sid = s131, .time_of_transmission = t2};
+  raw.message_type = 7;
+  put_u(8 + 4 * 2, 4, 7);
+  for (u32 i = 0; i < SBAS_DATA_BITS; i++) {
+    setbitu(raw.data, i, 1, getbitu(frame, 14 + i, 1));
+  }
+  fail_unless(sbas_decode_raw(&dec, &raw) == 0, "Raw message rejected");
+  fail_unless(dec.sats[2].ai == 7, "Raw message not applied");
+  from_raw = dec;
+  dec = before;
+  fail_unless(frame_decode(&t2) == 0, "Degradation message rejected");
+  fail_unless(memcmp(&from_raw, &dec, sizeof(dec)) == 0,
+              "Raw and frame decoding differ");
+
+  frame_start(0);
+  fail_unless(frame_decode(&t2) == 0, "Type 0 rejected");
+  fail_unless(sbas_fast_correction(&dec, g1, &t2, &c, &var) < 0,
+              "Test mode data used");
+
+  /* Type 0 suspends the corrections for a limited time only. */
+  gps_time_t t4 = t2;
+  t4.tow += SBAS_DO_NOT_USE_TIMEOUT + 1;
+  fail_unless(sbas_fast_correction(&dec, g1, &t4, &c, &var) == 0,
+              "Corrections still suspended after type 0 timeout");
+  frame_start(63);
+  fail_unless(frame_decode(&t4) == 0 && !dec.do_not_use,
+              "Type 0 not cleared after timeout");
+}
+END_TEST
+
+START_TEST(test_sbas_long_term) {
+  gps_time_t t = {.wn = 2300, .tow = 86400 * 3 + 100};
+  gnss_signal_t g1 = {1, CODE_GPS_L1CA};
+  gnss_signal_t g5 = {5, CODE_GPS_L1CA};
+  gnss_signal_t g37 = {37, CODE_GPS_L1CA};
+  sbas_decoder_init(&dec);
+  send_prn_mask(1, &t);
+
+  /* First half: velocity code 0 for GPS 1 and 5. Second half: velocity
+   * code 1 for GPS 37 with a time of applicability just before midnight. */
+  frame_start(25);
+  put_u(0, 1, 0);
+  put_u(1, 6, 1);
+  put_u(7, 8, 17);
+  put_s(15, 9, -8);
+  put_s(24, 9, 255);
+  put_s(33, 9, -256);
+  put_s(42, 10, -512);
+  put_u(52, 6, 2);
+  put_u(58, 8, 200);
+  put_s(66, 9, 1);
+  put_u(103, 2, 1);
+  put_u(106, 1, 1);
+  put_u(107, 6, 3);
+  put_u(113, 8, 99);
+  put_s(121, 11, -1024);
+  put_s(132, 11, 1023);
+  put_s(143, 11, 4);
+  put_s(154, 11, 100);
+  put_s(165, 8, -128);
+  put_s(173, 8, 127);
+  put_s(181, 8, 2);
+  put_s(189, 8, -3);
+  put_u(197, 13, 5395);
+  put_u(210, 2, 1);
+  fail_unless(frame_decode(&t) == 0, "Long term corrections rejected");
+
+  double dpos[3], dclk;
+  fail_unless(sbas_long_term_correction(&dec, g1, 17, &t, dpos, &dclk) == 0 &&
+                  dpos[0] == -1 && dpos[1] == 31.875 && dpos[2] == -32 &&
+                  dclk == -512 * C_1_2P31,
+              "GPS 1 long term correction");
+  fail_unless(sbas_long_term_correction(&dec, g1, 18, &t, dpos, &dclk) < 0,
+              "Long term correction for a different IODE");
+  fail_unless(sbas_long_term_correction(&dec, g5, 200, &t, dpos, &dclk) == 0 &&
+                  dpos[0] == 0.125,
+              "GPS 5 long term correction");
+
+  /* Time of applicability 86320 s of the previous day, 180 s ago. */
+  fail_unless(fabs(gpsdifftime(&t, &dec.sats[2].t_long_term) - 180) < 1e-9,
+              "Time of applicability %f",
+              gpsdifftime(&t, &dec.sats[2].t_long_term));
+  fail_unless(
+      sbas_long_term_correction(&dec, g37, 99, &t, dpos, &dclk) == 0,
+      "GPS 37 long term correction");
+  fail_unless(fabs(dpos[0] - (-128 - 128 * C_1_2P11 * 180)) < 1e-9 &&
+                  fabs(dpos[1] - (127.875 + 127 * C_1_2P11 * 180)) < 1e-9 &&
+                  fabs(dclk - (100 * C_1_2P31 - 3 * C_1_2P39 * 180)) < 1e-18,
+              "GPS 37 long term correction extrapolated");
+  t.tow += SBAS_LONG_TERM_TIMEOUT + 1;
+  fail_unless(sbas_long_term_correction(&dec, g1, 17, &t, dpos, &dclk) < 0,
+              "Timed out long term correction used");
+
+  /* Type 24: fast corrections of block 0 and a long term half. */
+  frame_start(24);
+  put_s(12, 12, 80);
+  put_u(72 + 4, 4, 2);
+  put_u(96, 2, 1);
+  put_u(106, 1, 0);
+  put_u(107, 6, 2);
+  put_u(113, 8, 201);
+  put_u(209, 2, 1);
+  fail_unless(frame_decode(&t) == 0, "Mixed corrections rejected");
+  double c, var;
+  fail_unless(sbas_fast_correction(&dec, g5, &t, &c, &var) == 0 && c == 10 &&
+                  var == 0.1444,
+              "Mixed fast correction");
+  fail_unless(sbas_long_term_correction(&dec, g5, 201, &t, dpos, &dclk) == 0,
+              "Mixed long term correction");
+}
+END_TEST
+
+START_TEST(test_sbas_igp_mask) {
+  gps_time_t t = {.wn = 2300, .tow = 1000};
+  sbas_decoder_init(&dec);
+  u32 count[SBAS_IGP_ROWS * SBAS_IGP_COLS] = {0};
+  for (u8 band = 0; band < SBAS_IGP_BANDS; band++) {
+    frame_start(18);
+    put_u(0, 4, 11);
+    put_u(4, 4, band);
+    for (u32 bit = 1; bit <= SBAS_IGP_BAND_SIZE; bit++) {
+      put_u(9 + bit, 1, 1);
+    }
+    fail_unless(frame_decode(&t) == 0, "IGP mask rejected");
+    u32 expected = (band < 8) ? 201 : ((8 == band) ? 200 : 192);
+    fail_unless(dec.band_n_igps[band] == expected,
+                "Band %u has %u points",
+                band,
+                dec.band_n_igps[band]);
+    for (u32 j = 0; j < dec.band_n_igps[band]; j++) {
+      s32 lat, lon;
+      u16 index = dec.band_igps[band][j];
+      igp_lat_lon(index, &lat, &lon);
+      if (band <= 8) {
+        fail_unless(lon >= -180 + 40 * band && lon < -140 + 40 * band,
+                    "Band %u point at %d, %d",
+                    band,
+                    lat,
+                    lon);
+      } else {
+        fail_unless((9 == band) ? lat >= 60 : lat <= -60,
+                    "Band %u point at %d, %d",
+                    band,
+                    lat,
+                    lon);
+      }
+      count[index] += (band <= 8);
+    }
+  }
+  /* Bands 0 to 8 cover each grid point once. */
+  u32 total = 0;
+  for (u32 i = 0; i < SBAS_IGP_ROWS * SBAS_IGP_COLS; i++) {
+    fail_unless(count[i] <= 1, "Grid point %u in several bands", i);
+    total += count[i];
+  }
+  fail_unless(total == 8 * 201 + 200, "Bands 0 to 8 cover %u points", total);
+  s32 lat, lon;
+  igp_lat_lon(dec.band_igps[1][0], &lat, &lon);
+  fail_unless(lat == -85 && lon == -140, "First point of band 1");
+  igp_lat_lon(dec.band_igps[0][27], &lat, &lon);
+  fail_unless(lat == 85 && lon == -180, "Last point of first column");
+  igp_lat_lon(dec.band_igps[10][191], &lat, &lon);
+  fail_unless(lat == -85 && lon == 160, "Last point of band 10");
+}
+END_TEST
+
+START_TEST(test_sbas_iono) {
+  gps_time_t t = {.wn = 2300, .tow = 1000};
+  sbas_decoder_init(&dec);
+  send_igp_band(4, 1, &t);
+  send_igp_band(5, 2, &t);
+
+  double delay, var;
+  for (double lat = -54.9; lat < 55; lat += 2.3) {
+    for (double lon = -19.9; lon < 55; lon += 1.7) {
+      fail_unless(sbas_iono_vertical_delay(
+                      &dec, &t, lat * D2R, lon * D2R, &delay, &var) == 0,
+                  "No delay at %f, %f",
+                  lat,
+                  lon);
+      fail_unless(fabs(delay - linear_delay(lat, lon)) < 1e-5 &&
+                      fabs(var - 0.1331) < 1e-12,
+                  "Delay at %f, %f: %f != %f",
+                  lat,
+                  lon,
+                  delay,
+                  linear_delay(lat, lon));
+    }
+  }
+  /* 10 degree cells beyond 55 degrees. */
+  fail_unless(sbas_iono_vertical_delay(
+                  &dec, &t, 68 * D2R, 3 * D2R, &delay, &var) == 0 &&
+                  fabs(delay - linear_delay(68, 3)) < 1e-5,
+              "10 degree cell delay %f",
+              delay);
+  fail_unless(sbas_iono_vertical_delay(
+                  &dec, &t, 10 * D2R, -30 * D2R, &delay, &var) < 0,
+              "Delay outside the grid");
+
+  /* Remove the grid point at 10N 5E, only the triangle opposite of it can
+   * be used. */
+  frame_start(26);
+  put_u(0, 4, 4);
+  u32 j = 0;
+  while (dec.band_igps[4][j] != 100 / 5 * SBAS_IGP_COLS + 185 / 5) {
+    j++;
+  }
+  put_u(4, 4, j / 15);
+  for (u32 i = 0; i < 15; i++) {
+    s32 lat, lon;
+    igp_lat_lon(dec.band_igps[4][j / 15 * 15 + i], &lat, &lon);
+    put_u(8 + 13 * i, 9, (u32)(linear_delay(lat, lon) * 8));
+    put_u(17 + 13 * i, 4, (i == j % 15) ? SBAS_GIVEI_NOT_MONITORED : 3);
+  }
+  put_u(203, 2, 1);
+  fail_unless(frame_decode(&t) == 0, "IGP delays rejected");
+  fail_unless(sbas_iono_vertical_delay(
+                  &dec, &t, 7 * D2R, 1 * D2R, &delay, &var) == 0 &&
+                  fabs(delay - linear_delay(7, 1)) < 1e-5,
+              "Triangle delay %f",
+              delay);
+  fail_unless(sbas_iono_vertical_delay(
+                  &dec, &t, 9 * D2R, 4 * D2R, &delay, &var) < 0,
+              "Delay outside the triangle");
+
+  /* Delays for a different mask are rejected, masks are replaced on a new
+   * IODI. */
+  put_u(203, 2, 2);
+  fail_unless(frame_decode(&t) < 0, "Mismatched IODI accepted");
+  frame_start(18);
+  put_u(0, 4, 2);
+  put_u(4, 4, 4);
+  put_u(8, 2, 3);
+  put_u(10, 1, 1);
+  fail_unless(frame_decode(&t) == 0, "IGP mask rejected");
+  fail_unless(dec.band_n_igps[4] == 1, "New IGP mask not applied");
+  fail_unless(sbas_iono_vertical_delay(
+                  &dec, &t, 2 * D2R, 2 * D2R, &delay, &var) < 0,
+              "Delay of the previous mask used");
+
+  /* Slant delay: zenith equals the vertical delay, lower satellites see
+   * the obliquity factor at their pierce point. */
+  double slant;
+  fail_unless(sbas_iono_delay(&dec,
+                              &t,
+                              30 * D2R,
+                              32 * D2R,
+                              0.3,
+                              M_PI / 2,
+                              &slant,
+                              &var) == 0 &&
+                  fabs(slant - linear_delay(30, 32)) < 1e-5,
+              "Zenith delay %f",
+              slant);
+  fail_unless(sbas_iono_delay(&dec,
+                              &t,
+                              30 * D2R,
+                              32 * D2R,
+                              M_PI / 2,
+                              10 * D2R,
+                              &slant,
+                              &var) == 0,
+              "Slant delay failed");
+  double k = 6378.1363 / (6378.1363 + 350) * cos(10 * D2R);
+  double psi = M_PI / 2 - 10 * D2R - asin(k);
+  double lat_pp = asin(sin(30 * D2R) * cos(psi));
+  double lon_pp = 32 * D2R + asin(sin(psi) / cos(lat_pp));
+  double expected = linear_delay(lat_pp * R2D, lon_pp * R2D) / sqrt(1 - k * k);
+  fail_unless(fabs(slant - expected) < 1e-5,
+              "Slant delay %f != %f",
+              slant,
+              expected);
+
+  t.tow += SBAS_IONO_TIMEOUT + 1;
+  fail_unless(sbas_iono_vertical_delay(
+                  &dec, &t, 30 * D2R, 32 * D2R, &delay, &var) < 0,
+              "Timed out delays used");
+}
+END_TEST
+
+/* Between 75 and 85 degrees the corners at 85 degrees are interpolated
+ * from the grid points 90 degrees apart, which reproduces a linear field. */
+START_TEST(test_sbas_iono_polar) {
+  gps_time_t t = {.wn = 2300, .tow = 1000};
+  sbas_decoder_init(&dec);
+  send_igp_band(3, 1, &t);
+  send_igp_band(4, 1, &t);
+  send_igp_band(5, 1, &t);
+  send_igp_band(6, 1, &t);
+
+  const double lats[] = {80, -80, 76.5, -84.5};
+  const double lons[] = {12, 12, 3, 17.5};
+  for (u32 i = 0; i < 4; i++) {
+    double delay, var;
+    fail_unless(sbas_iono_vertical_delay(
+                    &dec, &t, lats[i] * D2R, lons[i] * D2R, &delay, &var) ==
+                        0 &&
+                    fabs(delay - linear_delay(lats[i], lons[i])) < 1e-5 &&
+                    fabs(var - 0.1331) < 1e-12,
+                "Polar delay at %f, %f: %f != %f",
+                lats[i],
+                lons[i],
+                delay,
+                linear_delay(lats[i], lons[i]));
+  }
+
+  double delay, var;
+  fail_unless(sbas_iono_vertical_delay(
+                  &dec, &t, 86 * D2R, 12 * D2R, &delay, &var) < 0,
+              "Delay poleward of 85 degrees");
+
+  /* A new band 9 mask drops the delays only it provided, the points it
+   * shares with bands 0 to 8 keep theirs. */
+  send_igp_band(9, 1, &t);
+  const u16 shared = (75 + 90) / 5 * SBAS_IGP_COLS + (10 + 180) / 5;
+  const u16 band_9_only = (70 + 90) / 5 * SBAS_IGP_COLS + (10 + 180) / 5;
+  fail_unless(dec.igps[shared].valid && dec.igps[band_9_only].valid,
+              "Band 9 delays not applied");
+  frame_start(18);
+  put_u(0, 4, 5);
+  put_u(4, 4, 9);
+  put_u(8, 2, 2);
+  put_u(10, 1, 1);
+  fail_unless(frame_decode(&t) == 0, "IGP mask rejected");
+  fail_unless(dec.igps[shared].valid && !dec.igps[band_9_only].valid,
+              "Delays of the replaced band 9 mask");
+  fail_unless(sbas_iono_vertical_delay(
+                  &dec, &t, 80 * D2R, 12 * D2R, &delay, &var) == 0,
+              "Delays shared with bands 0 to 8 dropped");
+}
+END_TEST
+
+Suite *sbas_suite(void) {
+  Suite *s = suite_create("SBAS");
+
+  TCase *tc_core = tcase_create("Core");
+  tcase_add_test(tc_core, test_sbas_frame_check);
+  tcase_add_test(tc_core, test_sbas_fast_corrections);
+  tcase_add_test(tc_core, test_sbas_long_term);
+  tcase_add_test(tc_core, test_sbas_igp_mask);
+  tcase_add_test(tc_core, test_sbas_iono);
+  tcase_add_test(tc_core, test_sbas_iono_polar);
+  suite_add_tcase(s, tc_core);
+
+  return s;
+}
@@ -2,6 +2,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <swiftnav/set.h>
 
 #include "check_suites.h"
@@ -216,6 +217,127 @@ START_TEST(test_is_prn_set) {
 }
 END_TEST
 
+/* Deterministic pseudo random sorted set of n distinct values below
+ * n * spread. */
+static u32 random_set_s32(u32 n, u32 spread, s32 *set, u32 *state) {
+  u32 count = 0;
+  for (u32 v = 0; (v < n * spread) && (count < n); v++) {
+    *state = *state * 1664525 + 1013904223;
+    if ((*state >> 8) % spread == 0) {
+      set[count++] = (s32)v;
+    }
+  }
+  return count;
+}
+
+START_TEST(test_intersection_typed) {
+  /* Balanced and skewed sizes, to take both the merge and galloping paths */
+  const u32 sizes[][2] = {
+      {0, 5}, {5, 0}, {10, 10}, {3, 200}, {200, 3}, {1, 200}, {64, 64}};
+  u32 state = 1;
+  for (u32 t = 0; t < LEN(sizes); t++) {
+    s32 a[200], b[200];
+    s32 expected_a[200], expected_b[200];
+    s32 a_out[200], b_out[200];
+    u16 a16[200], b16[200], a16_out[200], b16_out[200];
+    gnss_signal_t sa[200], sb[200], sa_out[200], sb_out[200];
+    u32 ia[200], ib[200];
+    u32 na = random_set_s32(sizes[t][0], 2, a, &state);
+    u32 nb = random_set_s32(sizes[t][1], 2, b, &state);
+
+    s32 expected = intersection(na,
+                                sizeof(s32),
+                                a,
+                                expected_a,
+                                nb,
+                                sizeof(s32),
+                                b,
+                                expected_b,
+                                cmp_s32_s32);
+
+    fail_unless(intersection_s32(na, a, a_out, nb, b, b_out) == expected,
+                "bad s32 intersection length for sizes %u %u",
+                na,
+                nb);
+    fail_unless(memcmp(a_out, expected_a, expected * sizeof(s32)) == 0);
+    fail_unless(memcmp(b_out, expected_b, expected * sizeof(s32)) == 0);
+
+    fail_unless(intersection_index_s32(na, a, ia, nb, b, ib) == expected);
+    for (s32 i = 0; i < expected; i++) {
+      fail_unless(a[ia[i]] == expected_a[i] && b[ib[i]] == expected_a[i],
+                  "bad intersection index %d",
+                  i);
+    }
+    fail_unless(intersection_s32(na, a, NULL, nb, b, NULL) == expected);
+
+    for (u32 i = 0; i < na; i++) {
+      a16[i] = (u16)a[i];
+      sa[i] = construct_sid(CODE_GPS_L1CA, (u16)a[i]);
+    }
+    for (u32 i = 0; i < nb; i++) {
+      b16[i] = (u16)b[i];
+      sb[i] = construct_sid(CODE_GPS_L1CA, (u16)b[i]);
+    }
+    fail_unless(intersection_u16(na, a16, a16_out, nb, b16, b16_out) ==
+                expected);
+    fail_unless(intersection_sid(na, sa, sa_out, nb, sb, sb_out) == expected);
+    for (s32 i = 0; i < expected; i++) {
+      fail_unless(a16_out[i] == expected_a[i] && b16_out[i] == expected_a[i]);
+      fail_unless(sa_out[i].sat == expected_a[i] &&
+                  sb_out[i].sat == expected_a[i]);
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_insert_remove_typed) {
+  s32 set[8] = {2, 4, 6};
+  s32 out[8];
+  u32 n = 3;
+
+  fail_unless(insertion_index_s32(n, set, 1) == 0);
+  fail_unless(insertion_index_s32(n, set, 4) == 1);
+  fail_unless(insertion_index_s32(n, set, 7) == 3);
+
+  /* out of place */
+  fail_unless(insert_element_s32(n, set, out, 5) == 2);
+  s32 inserted[] = {2, 4, 5, 6};
+  fail_unless(memcmp(out, inserted, sizeof(inserted)) == 0);
+
+  /* in place, at both ends */
+  fail_unless(insert_element_s32(n++, set, set, 7) == 3);
+  fail_unless(insert_element_s32(n++, set, set, 0) == 0);
+  s32 grown[] = {0, 2, 4, 6, 7};
+  fail_unless(memcmp(set, grown, sizeof(grown)) == 0);
+
+  fail_unless(remove_element_s32(n, set, out, 3) == 2);
+  s32 removed[] = {0, 2, 6, 7};
+  fail_unless(memcmp(out, removed, sizeof(removed)) == 0);
+
+  fail_unless(remove_element_s32(n--, set, set, 4) == 2);
+  /* larger than all, the last element goes */
+  fail_unless(remove_element_s32(n--, set, set, 100) == 3);
+  s32 shrunk[] = {0, 2, 6};
+  fail_unless(memcmp(set, shrunk, sizeof(shrunk)) == 0);
+
+  /* sids are ordered by constellation and code first */
+  gnss_signal_t sids[4] = {{.sat = 3, .code = CODE_GPS_L1CA},
+                           {.sat = 1, .code = CODE_GPS_L2CM},
+                           {.sat = 2, .code = CODE_GAL_E1B}};
+  gnss_signal_t sid = {.sat = 9, .code = CODE_GPS_L1CA};
+  fail_unless(insert_element_sid(3, sids, sids, sid) == 1);
+  fail_unless(is_sid_set(4, sids));
+  fail_unless(remove_element_sid(4, sids, sids, sid) == 1);
+  fail_unless(is_sid_set(3, sids));
+
+  u16 set16[4] = {10, 20, 30};
+  fail_unless(insert_element_u16(3, set16, set16, 25) == 2);
+  fail_unless(set16[2] == 25 && set16[3] == 30);
+  fail_unless(remove_element_u16(4, set16, set16, 10) == 0);
+  fail_unless(set16[0] == 20 && set16[2] == 30);
+}
+END_TEST
+
 Suite *set_suite(void) {
   Suite *s = suite_create("Set");
 
@@ -230,8 +352,10 @@ Suite *set_suite(void) {
   tcase_add_test(tc_intersection, test_intersection_map_8);
   tcase_add_test(tc_intersection, test_intersection_map_9);
   tcase_add_test(tc_intersection, test_intersection_map_10);
+  tcase_add_test(tc_intersection, test_intersection_typed);
   TCase *tc_set = tcase_create("Set");
   tcase_add_test(tc_set, test_is_prn_set);
+  tcase_add_test(tc_set, test_insert_remove_typed);
   suite_add_tcase(s, tc_intersection);
   suite_add_tcase(s, tc_set);
 
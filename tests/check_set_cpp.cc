@@ -0,0 +1,123 @@
+#include <check.h>
+#include <string.h>
+#include <swiftnav/set.h>
+#include <swiftnav/set.hpp>
+
+#include "check_suites.h"
+
+/* Satellite of a GPS signal or a plain satellite number, to intersect a set
+ * of signals with a set of satellites. */
+static u16 sat_key(const gnss_signal_t &sid) { return sid.sat; }
+static u16 sat_key(u16 sat) { return sat; }
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+START_TEST(test_set_cpp_intersection) {
+  /* Balanced and skewed sizes, to take both the merge and galloping paths */
+  const u32 sizes[][2] = {{0, 5}, {12, 10}, {3, 150}, {150, 3}, {1, 150}};
+  u32 state = 5;
+  for (const auto &size : sizes) {
+    gnss_signal_t a[150], b[150];
+    u32 na = 0, nb = 0;
+    for (u16 sat = 0; sat < 300 && (na < size[0] || nb < size[1]); sat++) {
+      state = state * 1664525 + 1013904223;
+      if (na < size[0] && (state >> 30) < 2) {
+        a[na++] = gnss_signal_t{sat, CODE_GPS_L1CA};
+      }
+      if (nb < size[1] && ((state >> 28) & 3) < 2) {
+        b[nb++] = gnss_signal_t{sat, CODE_GPS_L1CA};
+      }
+    }
+
+    gnss_signal_t expected_a[150], a_out[150], b_out[150];
+    s32 expected = intersection(na,
+                                sizeof(gnss_signal_t),
+                                a,
+                                expected_a,
+                                nb,
+                                sizeof(gnss_signal_t),
+                                b,
+                                NULL,
+                                cmp_sid_sid);
+    fail_unless(swiftnav::intersection(a, na, a_out, b, nb, b_out) ==
+                    static_cast<std::size_t>(expected),
+                "bad intersection length for sizes %u %u",
+                na,
+                nb);
+    for (s32 i = 0; i < expected; i++) {
+      fail_unless(a_out[i] == expected_a[i] && b_out[i] == expected_a[i],
+                  "bad intersection element %d",
+                  i);
+    }
+
+    /* mixed element types, sats against sids */
+    u16 sats[150];
+    for (u32 i = 0; i < nb; i++) {
+      sats[i] = b[i].sat;
+    }
+    s32 n_matched = 0;
+    std::size_t n = swiftnav::intersection_map(
+        a,
+        na,
+        sats,
+        nb,
+        [&](const gnss_signal_t &sid, const u16 &sat) {
+          fail_unless(sid.sat == sat && sid == expected_a[n_matched],
+                      "bad intersection_map pair");
+          n_matched++;
+        },
+        [](const auto &x, const auto &y) {
+          return sat_key(x) < sat_key(y);
+        });
+    fail_unless(n == static_cast<std::size_t>(expected) &&
+                    n_matched == expected,
+                "bad intersection_map length");
+  }
+}
+END_TEST
+
+START_TEST(test_set_cpp_insert_remove) {
+  s32 set[8] = {2, 4, 6};
+  s32 out[8];
+  std::size_t n = 3;
+
+  fail_unless(swiftnav::insertion_index(set, n, 5) == 2);
+  fail_unless(swiftnav::insert_element(set, n, out, 5) == 2);
+  s32 inserted[] = {2, 4, 5, 6};
+  fail_unless(memcmp(out, inserted, sizeof(inserted)) == 0);
+
+  fail_unless(swiftnav::insert_element(set, n++, set, 7) == 3);
+  fail_unless(swiftnav::insert_element(set, n++, set, 0) == 0);
+  s32 grown[] = {0, 2, 4, 6, 7};
+  fail_unless(memcmp(set, grown, sizeof(grown)) == 0);
+
+  fail_unless(swiftnav::remove_element(set, n--, set, 4) == 2);
+  fail_unless(swiftnav::remove_element(set, n--, set, 100) == 3);
+  s32 shrunk[] = {0, 2, 6};
+  fail_unless(memcmp(set, shrunk, sizeof(shrunk)) == 0);
+
+  /* descending order through the comparison */
+  s32 descending[4] = {9, 5, 1};
+  fail_unless(swiftnav::insert_element(
+                  descending, 3, descending, 3, std::greater<s32>()) == 2);
+  s32 expected[] = {9, 5, 3, 1};
+  fail_unless(memcmp(descending, expected, sizeof(expected)) == 0);
+}
+END_TEST
+
+Suite *set_cpp_test_suite(void) {
+  Suite *s = suite_create("Set C++ templates");
+
+  TCase *tc_core = tcase_create("Core");
+  tcase_add_test(tc_core, test_set_cpp_intersection);
+  tcase_add_test(tc_core, test_set_cpp_insert_remove);
+  suite_add_tcase(s, tc_core);
+
+  return s;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -86,12 +86,148 @@ START_TEST(test_sid_set_contains) {
 }
 END_TEST
 
+/* Deterministic pseudo random sid set, about one signal in four. */
+static void random_sid_set(gnss_sid_set_t *sid_set, u32 *state) {
+  sid_set_init(sid_set);
+  for (u16 i = 0; i < SID_GLOBAL_COUNT; i++) {
+    *state = *state * 1664525 + 1013904223;
+    if ((*state >> 30) == 0) {
+      sid_set_add(sid_set, global_index_to_sid(i));
+    }
+  }
+}
+
+START_TEST(test_sid_set_algebra) {
+  u32 state = 1;
+  for (int trial = 0; trial < 20; trial++) {
+    gnss_sid_set_t a, b, u, n, d;
+    random_sid_set(&a, &state);
+    random_sid_set(&b, &state);
+    sid_set_union(&u, &a, &b);
+    sid_set_intersection(&n, &a, &b);
+    sid_set_difference(&d, &a, &b);
+
+    for (u16 i = 0; i < SID_GLOBAL_COUNT; i++) {
+      gnss_signal_t sid = global_index_to_sid(i);
+      bool in_a = sid_set_contains(&a, sid);
+      bool in_b = sid_set_contains(&b, sid);
+      fail_unless(sid_set_contains(&u, sid) == (in_a || in_b),
+                  "bad union for (code %d, sat %d)",
+                  sid.code,
+                  sid.sat);
+      fail_unless(sid_set_contains(&n, sid) == (in_a && in_b),
+                  "bad intersection for (code %d, sat %d)",
+                  sid.code,
+                  sid.sat);
+      fail_unless(sid_set_contains(&d, sid) == (in_a && !in_b),
+                  "bad difference for (code %d, sat %d)",
+                  sid.code,
+                  sid.sat);
+    }
+
+    fail_unless(sid_set_is_subset(&a, &u));
+    fail_unless(sid_set_is_subset(&n, &a));
+    fail_unless(sid_set_is_subset(&d, &a));
+    fail_unless(!sid_set_is_subset(&u, &n));
+    fail_unless(sid_set_get_sig_count(&u) + sid_set_get_sig_count(&n) ==
+                sid_set_get_sig_count(&a) + sid_set_get_sig_count(&b));
+
+    /* in place */
+    sid_set_difference(&a, &a, &b);
+    fail_unless(memcmp(&a, &d, sizeof(a)) == 0);
+    sid_set_intersection(&d, &d, &b);
+    fail_unless(sid_set_is_empty(&d));
+  }
+}
+END_TEST
+
+START_TEST(test_sid_set_iter) {
+  u32 state = 7;
+  gnss_sid_set_t sid_set;
+  random_sid_set(&sid_set, &state);
+
+  gnss_sid_set_t visited;
+  sid_set_init(&visited);
+  sid_set_iter_t iter;
+  sid_set_iter_init(&iter, &sid_set);
+  gnss_signal_t sid;
+  u32 count = 0;
+  gnss_signal_t prev = {0, CODE_INVALID};
+  while (sid_set_iter_next(&iter, &sid)) {
+    fail_unless(sid_set_contains(&sid_set, sid),
+                "(code %d, sat %d) not in set",
+                sid.code,
+                sid.sat);
+    fail_unless(prev.code < sid.code ||
+                    (prev.code == sid.code && prev.sat < sid.sat),
+                "(code %d, sat %d) out of order",
+                sid.code,
+                sid.sat);
+    sid_set_add(&visited, sid);
+    prev = sid;
+    count++;
+  }
+  fail_unless(!sid_set_iter_next(&iter, &sid), "iterator did not stay done");
+  fail_unless(count == sid_set_get_sig_count(&sid_set),
+              "visited %u of %u signals",
+              count,
+              sid_set_get_sig_count(&sid_set));
+  fail_unless(memcmp(&visited, &sid_set, sizeof(visited)) == 0);
+
+  sid_set_init(&sid_set);
+  sid_set_iter_init(&iter, &sid_set);
+  fail_unless(!sid_set_iter_next(&iter, &sid), "empty set has members");
+  fail_unless(sid_set_is_empty(&sid_set));
+}
+END_TEST
+
+START_TEST(test_sid_set_sats) {
+  gnss_sid_set_t sid_set;
+  sid_set_init(&sid_set);
+  gnss_signal_t l2 = {.code = CODE_GPS_L2CM, .sat = 5};
+  gnss_signal_t l1 = {.code = CODE_GPS_L1CA, .sat = 5};
+  gnss_signal_t gal = {.code = CODE_GAL_E1B, .sat = 5};
+  gnss_signal_t glo = {.code = CODE_GLO_L2OF, .sat = 28};
+
+  sid_set_add(&sid_set, l2);
+  sid_set_add(&sid_set, glo);
+  fail_unless(sid_set_contains_sat(&sid_set, l1));
+  fail_unless(!sid_set_contains_sat(&sid_set, gal));
+  fail_unless(sid_set_contains_sat(
+      &sid_set, (gnss_signal_t){.code = CODE_GLO_L1OF, .sat = 28}));
+
+  u64 sats[CONSTELLATION_COUNT];
+  sid_set_get_sats(&sid_set, sats);
+  fail_unless(sats[CONSTELLATION_GPS] == ((u64)1 << 4));
+  fail_unless(sats[CONSTELLATION_GLO] == ((u64)1 << 27));
+  fail_unless(sats[CONSTELLATION_GAL] == 0);
+
+  /* the satellite count only grows for signals of new satellites */
+  u32 state = 3;
+  random_sid_set(&sid_set, &state);
+  for (u16 i = 0; i < SID_GLOBAL_COUNT; i++) {
+    gnss_signal_t sid = global_index_to_sid(i);
+    gnss_sid_set_t added = sid_set;
+    sid_set_add(&added, sid);
+    fail_unless(sid_set_contains_sat(&sid_set, sid) ==
+                    (sid_set_get_sat_count(&added) ==
+                     sid_set_get_sat_count(&sid_set)),
+                "bad satellite check for (code %d, sat %d)",
+                sid.code,
+                sid.sat);
+  }
+}
+END_TEST
+
 Suite *sid_set_test_suite(void) {
   Suite *s = suite_create("SID Set");
   TCase *tc_core = tcase_create("Core");
   tcase_add_test(tc_core, test_sid_set_empty);
   tcase_add_test(tc_core, test_sid_set);
   tcase_add_test(tc_core, test_sid_set_contains);
+  tcase_add_test(tc_core, test_sid_set_algebra);
+  tcase_add_test(tc_core, test_sid_set_iter);
+  tcase_add_test(tc_core, test_sid_set_sats);
   suite_add_tcase(s, tc_core);
   return s;
 }
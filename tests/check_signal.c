@@ -1,4 +1,10 @@
+/* src/signal.c is included below and defines the out of line lookups. */
+#ifndef LIBSWIFTNAV_CHECKED_SIGNAL_LOOKUP
+#define LIBSWIFTNAV_CHECKED_SIGNAL_LOOKUP
+#endif
+
 #include <check.h>
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -593,6 +599,151 @@ START_TEST(test_sub_constellation_to_constellation) {
 }
 END_TEST
 
+static void lower_case(char *dst, const char *src) {
+  for (; *src; src++, dst++) {
+    *dst = (char)tolower((unsigned char)*src);
+  }
+  *dst = 0;
+}
+
+START_TEST(test_signal_label_parse) {
+  char lower[32];
+  char padded[64];
+  for (int i = 0; i < CODE_COUNT; i++) {
+    const char *label = code_to_string((code_t)i);
+    size_t len = strlen(label);
+    fail_unless(code_string_to_enum(label) == i, "bad code %s", label);
+    fail_unless(code_string_to_enum_n(label, len) == i, "bad code %s", label);
+    lower_case(lower, label);
+    fail_unless(strcmp(lower, label) == 0 ||
+                    code_string_to_enum_n(lower, len) == CODE_INVALID,
+                "case insensitive code %s",
+                lower);
+    fail_unless(code_string_to_enum_nocase(lower, len) == i,
+                "bad code %s",
+                lower);
+    /* A label in the middle of a line, not null terminated. */
+    snprintf(padded, sizeof(padded), "x%sX", label);
+    fail_unless(code_string_to_enum_n(padded + 1, len) == i,
+                "bad code slice %s",
+                padded);
+    fail_unless(code_string_to_enum_n(padded + 1, len + 1) == CODE_INVALID,
+                "bad code slice %s",
+                padded);
+    fail_unless(code_string_to_enum_n(label, len - 1) != i,
+                "bad code prefix %s",
+                label);
+  }
+  for (int i = 0; i < CONSTELLATION_COUNT; i++) {
+    const char *label = constellation_to_string((constellation_t)i);
+    size_t len = strlen(label);
+    fail_unless(constellation_string_to_enum_n(label, len) == i,
+                "bad constellation %s",
+                label);
+    lower_case(lower, label);
+    fail_unless(constellation_string_to_enum_n(lower, len) ==
+                    CONSTELLATION_INVALID,
+                "case insensitive constellation %s",
+                lower);
+    fail_unless(constellation_string_to_enum_nocase(lower, len) == i,
+                "bad constellation %s",
+                lower);
+  }
+  for (int i = 0; i < SUB_CONSTELLATION_COUNT; i++) {
+    const char *label = sub_constellation_to_string((sub_constellation_t)i);
+    size_t len = strlen(label);
+    fail_unless(sub_constellation_string_to_enum_n(label, len) == i,
+                "bad sub constellation %s",
+                label);
+    lower_case(lower, label);
+    fail_unless(sub_constellation_string_to_enum_n(lower, len) ==
+                    SUB_CONSTELLATION_INVALID,
+                "case insensitive sub constellation %s",
+                lower);
+    fail_unless(sub_constellation_string_to_enum_nocase(lower, len) == i,
+                "bad sub constellation %s",
+                lower);
+  }
+
+  fail_unless(code_string_to_enum("GPS L1CAX") == CODE_INVALID);
+  fail_unless(code_string_to_enum("") == CODE_INVALID);
+  fail_unless(code_string_to_enum_n("", 0) == CODE_INVALID);
+  fail_unless(code_string_to_enum_nocase("gps l1ca", 8) == CODE_GPS_L1CA);
+  fail_unless(constellation_string_to_enum("GPS") == CONSTELLATION_GPS);
+  fail_unless(constellation_string_to_enum_n("GPS\0", 4) ==
+              CONSTELLATION_INVALID);
+  fail_unless(constellation_string_to_enum_n("GPSX", 3) == CONSTELLATION_GPS);
+  fail_unless(constellation_string_to_enum_nocase("gAl", 3) ==
+              CONSTELLATION_GAL);
+  fail_unless(sub_constellation_string_to_enum("BDS3") ==
+              SUB_CONSTELLATION_BDS3);
+  fail_unless(sub_constellation_string_to_enum_n("BDS", 3) ==
+              SUB_CONSTELLATION_INVALID);
+}
+END_TEST
+
+START_TEST(test_sid_to_string_n) {
+  char expected[SID_STR_LEN_MAX];
+  char s[SID_STR_LEN_MAX];
+  for (int i = 0; i < CODE_COUNT; i++) {
+    code_t code = (code_t)i;
+    for (u16 index = 0; index < code_table[code].sat_count; index++) {
+      gnss_signal_t sid = sid_from_code_index(code, index);
+      int len = sid_to_string(expected, sizeof(expected), sid);
+      fail_unless(sid_to_string_n(s, sizeof(s), sid) == (size_t)len,
+                  "bad length for %s",
+                  expected);
+      fail_unless(strcmp(s, expected) == 0, "%s != %s", s, expected);
+      fail_unless(
+          sid_to_string_n(s, 5, sid) == 4 && strncmp(s, expected, 4) == 0 &&
+              s[4] == 0,
+          "bad truncation of %s",
+          expected);
+    }
+  }
+  gnss_signal_t sid = construct_sid(CODE_GPS_L1CA, 12);
+  s[0] = 'x';
+  fail_unless(sid_to_string_n(s, 0, sid) == 0 && s[0] == 'x');
+  fail_unless(sid_to_string_n(s, 1, sid) == 0 && s[0] == 0);
+  sid_to_string_n(s, sizeof(s), sid);
+  ck_assert_str_eq("GPS L1CA 12", s);
+}
+END_TEST
+
+START_TEST(test_sid_global_index) {
+  static bool seen[SID_GLOBAL_COUNT];
+  memset(seen, 0, sizeof(seen));
+  u32 n_sids = 0;
+  for (int i = 0; i < CODE_COUNT; i++) {
+    code_t code = (code_t)i;
+    for (u16 index = 0; index < code_table[code].sat_count; index++) {
+      gnss_signal_t sid = sid_from_code_index(code, index);
+      u16 global_index = sid_to_global_index(sid);
+      fail_unless(global_index < SID_GLOBAL_COUNT,
+                  "global index %d out of range",
+                  global_index);
+      fail_unless(!seen[global_index],
+                  "global index %d used twice",
+                  global_index);
+      seen[global_index] = true;
+      fail_unless(sid_is_equal(global_index_to_sid(global_index), sid),
+                  "global index %d does not map back",
+                  global_index);
+      n_sids++;
+    }
+  }
+  fail_unless(n_sids == SID_GLOBAL_COUNT,
+              "%d signals, SID_GLOBAL_COUNT is %d",
+              n_sids,
+              SID_GLOBAL_COUNT);
+  fail_unless(sid_to_global_index(construct_sid(CODE_GPS_L1CA, 1)) == 0);
+  code_t last = (code_t)global_index_codes[CODE_COUNT - 1];
+  fail_unless(sid_is_equal(
+      global_index_to_sid(SID_GLOBAL_COUNT - 1),
+      sid_from_code_index(last, code_table[last].sat_count - 1)));
+}
+END_TEST
+
 Suite *signal_test_suite(void) {
   Suite *s = suite_create("Signal");
   TCase *tc_core = tcase_create("Core");
@@ -613,6 +764,9 @@ Suite *signal_test_suite(void) {
   tcase_add_test(tc_core, test_constellation_to_string);
   tcase_add_test(tc_core, test_sub_constellation_to_string);
   tcase_add_test(tc_core, test_sub_constellation_to_constellation);
+  tcase_add_test(tc_core, test_signal_label_parse);
+  tcase_add_test(tc_core, test_sid_to_string_n);
+  tcase_add_test(tc_core, test_sid_global_index);
   suite_add_tcase(s, tc_core);
   return s;
 }
@@ -0,0 +1,207 @@
+#include <check.h>
+#include <stdint.h>
+#include <string.h>
+#include <swiftnav/glo_map.h>
+#include <swiftnav/signal.h>
+#include <swiftnav/signal.hpp>
+
+#include "check_suites.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+static_assert(swiftnav::code_to_constellation(CODE_GAL_E5Q) ==
+                  CONSTELLATION_GAL,
+              "constellation not constant");
+static_assert(swiftnav::code_to_carr_freq(CODE_GPS_L2CM) == GPS_L2_HZ,
+              "carrier frequency not constant");
+static_assert(swiftnav::code_to_chip_rate(CODE_GPS_L1CA) ==
+                  GPS_CA_CHIPPING_RATE,
+              "chip rate not constant");
+static_assert(swiftnav::sid_to_code_index(gnss_signal_t{5, CODE_GPS_L1CA}) ==
+                  4,
+              "code index not constant");
+static_assert(swiftnav::constellation_to_sat_count(CONSTELLATION_GPS) ==
+                  NUM_SATS_GPS,
+              "sat count not constant");
+static_assert(!swiftnav::sid_valid(gnss_signal_t{0, CODE_GPS_L1CA}),
+              "sid_valid not constant");
+static_assert(swiftnav::sid_to_global_index(
+                  swiftnav::global_index_to_sid(SID_GLOBAL_COUNT - 1)) ==
+                  SID_GLOBAL_COUNT - 1,
+              "global index not constant");
+static_assert(swiftnav::glo_carr_freq(CODE_GLO_L1OF, GLO_FCN_OFFSET) ==
+                  GLO_L1_HZ,
+              "GLO frequency not constant");
+
+START_TEST(test_signal_props_layout) {
+  fail_unless(sizeof(code_props_t) == 16, "code_props_t is not packed");
+  fail_unless((uintptr_t)code_props % 64 == 0,
+              "code_props is not cache line aligned");
+}
+END_TEST
+
+START_TEST(test_signal_cpp_table) {
+  for (int i = 0; i < CODE_COUNT; i++) {
+    code_t code = (code_t)i;
+    fail_unless(swiftnav::code_to_constellation(code) ==
+                    code_to_constellation(code),
+                "constellation mismatch for code %d",
+                i);
+    fail_unless(strcmp(swiftnav::code_to_string(code), code_to_string(code)) ==
+                    0,
+                "string mismatch for code %d",
+                i);
+    fail_unless(swiftnav::code_to_chip_count(code) == code_to_chip_count(code),
+                "chip count mismatch for code %d",
+                i);
+    fail_unless(swiftnav::code_to_chip_rate(code) == code_to_chip_rate(code),
+                "chip rate mismatch for code %d",
+                i);
+    fail_unless(
+        swiftnav::code_to_prn_period_ms(code) == code_to_prn_period_ms(code),
+        "PRN period mismatch for code %d",
+        i);
+    fail_unless(swiftnav::code_requires_direct_acq(code) ==
+                    code_requires_direct_acq(code),
+                "direct acquisition mismatch for code %d",
+                i);
+    fail_unless(
+        swiftnav::code_to_sv_doppler_min(code) == code_to_sv_doppler_min(code),
+        "Doppler min mismatch for code %d",
+        i);
+    fail_unless(
+        swiftnav::code_to_sv_doppler_max(code) == code_to_sv_doppler_max(code),
+        "Doppler max mismatch for code %d",
+        i);
+    fail_unless(
+        swiftnav::code_requires_decoder(code) == code_requires_decoder(code),
+        "decoder mismatch for code %d",
+        i);
+    fail_unless(swiftnav::code_to_phase_alignment(code) ==
+                    code_to_phase_alignment(code),
+                "phase alignment mismatch for code %d",
+                i);
+    fail_unless(swiftnav::code_to_sig_count(code) == code_to_sig_count(code),
+                "signal count mismatch for code %d",
+                i);
+    fail_unless(swiftnav::is_gps(code) == is_gps(code) &&
+                    swiftnav::is_sbas(code) == is_sbas(code) &&
+                    swiftnav::is_glo(code) == is_glo(code) &&
+                    swiftnav::is_bds2(code) == is_bds2(code) &&
+                    swiftnav::is_gal(code) == is_gal(code) &&
+                    swiftnav::is_qzss(code) == is_qzss(code),
+                "constellation predicate mismatch for code %d",
+                i);
+  }
+  fail_unless(strcmp(swiftnav::code_to_string(CODE_INVALID), "Invalid code") ==
+                  0,
+              "invalid code string");
+  for (int c = 0; c < CONSTELLATION_COUNT; c++) {
+    constellation_t cons = (constellation_t)c;
+    fail_unless(swiftnav::constellation_to_sat_count(cons) ==
+                    constellation_to_sat_count(cons),
+                "sat count mismatch for constellation %d",
+                c);
+  }
+}
+END_TEST
+
+START_TEST(test_signal_cpp_sids) {
+  glo_map_init(NULL, NULL);
+  for (u16 fcn = GLO_MIN_FCN; fcn <= GLO_MAX_FCN; fcn++) {
+    glo_map_set_slot_id(fcn, fcn);
+  }
+  for (int i = 0; i < CODE_COUNT; i++) {
+    code_t code = (code_t)i;
+    for (u16 sat = 0; sat < 256; sat++) {
+      gnss_signal_t sid = {sat, code};
+      fail_unless(swiftnav::sid_valid(sid) == sid_valid(sid),
+                  "sid_valid mismatch for code %d sat %d",
+                  i,
+                  sat);
+      if (!sid_valid(sid)) {
+        continue;
+      }
+      u16 index = sid_to_code_index(sid);
+      fail_unless(swiftnav::sid_to_code_index(sid) == index,
+                  "code index mismatch for code %d sat %d",
+                  i,
+                  sat);
+      fail_unless(swiftnav::sid_from_code_index(code, index) == sid,
+                  "sid mismatch for code %d sat %d",
+                  i,
+                  sat);
+      fail_unless(swiftnav::sid_to_constellation(sid) ==
+                      sid_to_constellation(sid),
+                  "constellation mismatch for code %d sat %d",
+                  i,
+                  sat);
+      if (is_glo(code) && !glo_map_valid(sid)) {
+        continue;
+      }
+      fail_unless(swiftnav::sid_to_carr_freq(sid) == sid_to_carr_freq(sid),
+                  "frequency mismatch for code %d sat %d",
+                  i,
+                  sat);
+      fail_unless(swiftnav::sid_to_lambda(sid) == sid_to_lambda(sid),
+                  "lambda mismatch for code %d sat %d",
+                  i,
+                  sat);
+      if (CODE_GLO_L1OF == code || CODE_GLO_L2OF == code) {
+        fail_unless(swiftnav::glo_carr_freq(code, glo_map_get_fcn(sid)) ==
+                        sid_to_carr_freq(sid),
+                    "GLO frequency mismatch for sat %d",
+                    sat);
+      }
+    }
+  }
+  glo_map_clear_all();
+}
+END_TEST
+
+START_TEST(test_signal_cpp_global_index) {
+  for (u16 i = 0; i < SID_GLOBAL_COUNT; i++) {
+    gnss_signal_t sid = global_index_to_sid(i);
+    fail_unless(swiftnav::global_index_to_sid(i) == sid,
+                "sid mismatch for global index %d",
+                i);
+    fail_unless(swiftnav::sid_to_global_index(sid) == i,
+                "global index mismatch for global index %d",
+                i);
+  }
+
+  static swiftnav::sid_array<int> counts{};
+  fail_unless(counts.size() == SID_GLOBAL_COUNT, "bad sid_array size");
+  for (u16 i = 0; i < SID_GLOBAL_COUNT; i++) {
+    counts[global_index_to_sid(i)] += i;
+  }
+  int expected = 0;
+  for (const int &count : counts) {
+    fail_unless(count == expected, "bad sid_array element %d", expected);
+    expected++;
+  }
+  const swiftnav::sid_array<int> &const_counts = counts;
+  gnss_signal_t sid = {3, CODE_GPS_L1CA};
+  fail_unless(const_counts[sid] == 2,
+              "bad sid_array lookup");
+}
+END_TEST
+
+Suite *signal_cpp_test_suite(void) {
+  Suite *s = suite_create("Signal C++ helpers");
+
+  TCase *tc_core = tcase_create("Core");
+  tcase_add_test(tc_core, test_signal_props_layout);
+  tcase_add_test(tc_core, test_signal_cpp_table);
+  tcase_add_test(tc_core, test_signal_cpp_sids);
+  tcase_add_test(tc_core, test_signal_cpp_global_index);
+  suite_add_tcase(s, tc_core);
+
+  return s;
+}
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -18,6 +18,7 @@ Suite* gnss_time_test_suite(void);
 Suite* gnss_time_cpp_test_suite(void);
 Suite* signal_test_suite(void);
 Suite* geoid_model_test_suite(void);
+Suite* geoid_grid_suite(void);
 Suite* glo_map_test_suite(void);
 Suite* shm_suite(void);
 Suite* troposphere_suite(void);
@@ -27,6 +28,11 @@ Suite* nav_meas_calc_test_suite(void);
 Suite* sid_set_test_suite(void);
 Suite* status_report_suite(void);
 Suite* log_suite(void);
+Suite* udu_filter_suite(void);
+Suite* nequick_suite(void);
+Suite* sbas_suite(void);
+Suite* signal_cpp_test_suite(void);
+Suite* set_cpp_test_suite(void);
 
 #ifdef __cplusplus
 } /* extern "C" */
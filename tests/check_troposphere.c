@@ -89,11 +89,63 @@ START_TEST(test_calc_troposphere) {
 }
 END_TEST
 
+START_TEST(test_calc_troposphere_zenith) {
+  const double doys[] = {1.0, 32.5, 200.25};
+  const double lats[] = {-80, -40, -10, 0, 20, 50, 89};
+  const double heights[] = {-100, 0, 1300, 5000, 12000};
+  double els[100];
+  double delays[100];
+  for (u8 i = 0; i < 100; i++) {
+    els[i] = (i - 5) * D2R;
+  }
+
+  for (u8 d = 0; d < sizeof(doys) / sizeof(doys[0]); d++) {
+    for (u8 la = 0; la < sizeof(lats) / sizeof(lats[0]); la++) {
+      for (u8 hi = 0; hi < sizeof(heights) / sizeof(heights[0]); hi++) {
+        double lat = lats[la] * D2R;
+        tropo_zenith_t zenith;
+        calc_troposphere_zenith(doys[d], lat, heights[hi], &zenith);
+        calc_troposphere_slant_batch(&zenith, 100, els, delays);
+
+        if (heights[hi] > MAX_ALTITUDE) {
+          fail_unless(zenith.zhd == 0 && zenith.zwd == 0,
+                      "Zenith delay above the troposphere");
+        } else {
+          /* Zenith delays are the slant delays at 90 degrees elevation */
+          fail_unless(fabs(calc_troposphere_slant(&zenith, M_PI / 2) -
+                           (zenith.zhd + zenith.zwd)) < 1e-9,
+                      "Zenith delay does not map to itself");
+          fail_unless(zenith.zhd > 1.0 && zenith.zhd < 2.5 &&
+                          zenith.zwd >= 0 && zenith.zwd < 0.5,
+                      "Zenith delays out of range: %f, %f",
+                      zenith.zhd,
+                      zenith.zwd);
+        }
+
+        for (u8 i = 0; i < 100; i++) {
+          double expected =
+              calc_troposphere(doys[d], lat, heights[hi], els[i]);
+          fail_unless(calc_troposphere_slant(&zenith, els[i]) == expected &&
+                          fabs(delays[i] - expected) < 1e-12,
+                      "Split model differs from calc_troposphere() at doy "
+                      "%f, lat %f, h %f, el %f",
+                      doys[d],
+                      lats[la],
+                      heights[hi],
+                      els[i] * R2D);
+        }
+      }
+    }
+  }
+}
+END_TEST
+
 Suite *troposphere_suite(void) {
   Suite *s = suite_create("Troposphere");
 
   TCase *tc_core = tcase_create("Core");
   tcase_add_test(tc_core, test_calc_troposphere);
+  tcase_add_test(tc_core, test_calc_troposphere_zenith);
   suite_add_tcase(s, tc_core);
 
   return s;
@@ -0,0 +1,252 @@
+#include <check.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <swiftnav/linear_algebra.h>
+#include <swiftnav/udu_filter.h>
+
+#include "check_suites.h"
+#include "common/check_utils.h"
+
+#define UDU_TOL 1e-8
+#define UDU_NUM 20
+
+/* Random symmetric positive definite n x n matrix. */
+static void random_spd(u32 n, double *P) {
+  double A[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+  double At[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+  arr_frand(n * n, -10, 10, A);
+  matrix_transpose(n, n, A, At);
+  matrix_multiply(n, n, n, A, At, P);
+  for (u32 i = 0; i < n; i++) {
+    P[i * n + i] += 1;
+  }
+}
+
+static void check_matrix_close(u32 n,
+                               u32 m,
+                               const double *a,
+                               const double *b) {
+  for (u32 i = 0; i < n * m; i++) {
+    double scale = MAX(1.0, fabs(b[i]));
+    fail_unless(fabs(a[i] - b[i]) < UDU_TOL * scale,
+                "element %u differs: %.12g vs %.12g",
+                i,
+                a[i],
+                b[i]);
+  }
+}
+
+START_TEST(test_udu_filter_init) {
+  srand(1);
+  for (u32 t = 0; t < UDU_NUM; t++) {
+    u32 n = 1 + (u32)(rand() % UDU_FILTER_MAX_STATES);
+    double x[UDU_FILTER_MAX_STATES];
+    double P[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    double P_[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    arr_frand(n, -100, 100, x);
+    random_spd(n, P);
+
+    udu_filter_t f;
+    udu_filter_init(&f, n, x, P);
+    udu_filter_get_covariance(&f, P_);
+    check_matrix_close(n, n, P_, P);
+    check_matrix_close(n, 1, f.x, x);
+
+    double d[UDU_FILTER_MAX_STATES];
+    arr_frand(n, 1, 10, d);
+    udu_filter_init_diag(&f, n, x, d);
+    udu_filter_get_covariance(&f, P_);
+    for (u32 i = 0; i < n; i++) {
+      for (u32 j = 0; j < n; j++) {
+        fail_unless(P_[i * n + j] == (i == j ? d[i] : 0),
+                    "diagonal init covariance incorrect");
+      }
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_udu_filter_update) {
+  srand(2);
+  for (u32 t = 0; t < UDU_NUM; t++) {
+    u32 n = 1 + (u32)(rand() % UDU_FILTER_MAX_STATES);
+    double x[UDU_FILTER_MAX_STATES];
+    double P[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    double h[UDU_FILTER_MAX_STATES];
+    arr_frand(n, -100, 100, x);
+    arr_frand(n, -1, 1, h);
+    random_spd(n, P);
+    double z = frand(-100, 100);
+    double r = frand(0.1, 10);
+
+    udu_filter_t f;
+    udu_filter_init(&f, n, x, P);
+    double alpha = udu_filter_innovation_variance(&f, h, r);
+    fail_unless(udu_filter_update(&f, h, z, r) == 0, "update rejected");
+
+    /* Conventional Kalman update for reference. */
+    double Ph[UDU_FILTER_MAX_STATES];
+    matrix_multiply(n, n, 1, P, h, Ph);
+    double s = vector_dot(n, h, Ph) + r;
+    fail_unless(fabs(alpha - s) < UDU_TOL * s,
+                "innovation variance %f != %f",
+                alpha,
+                s);
+    double innov = z - vector_dot(n, h, x);
+    for (u32 i = 0; i < n; i++) {
+      x[i] += Ph[i] / s * innov;
+      for (u32 j = 0; j < n; j++) {
+        P[i * n + j] -= Ph[i] * Ph[j] / s;
+      }
+    }
+
+    double P_[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    udu_filter_get_covariance(&f, P_);
+    check_matrix_close(n, n, P_, P);
+    check_matrix_close(n, 1, f.x, x);
+  }
+}
+END_TEST
+
+START_TEST(test_udu_filter_update_sequential) {
+  srand(3);
+  for (u32 t = 0; t < UDU_NUM; t++) {
+    u32 n = 1 + (u32)(rand() % UDU_FILTER_MAX_STATES);
+    u32 m = 1 + (u32)(rand() % 6);
+    double x[UDU_FILTER_MAX_STATES];
+    double P[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    double H[6 * UDU_FILTER_MAX_STATES];
+    double z[6];
+    double r[6];
+    arr_frand(n, -100, 100, x);
+    arr_frand(m * n, -1, 1, H);
+    arr_frand(m, -100, 100, z);
+    arr_frand(m, 0.1, 10, r);
+    random_spd(n, P);
+
+    udu_filter_t f;
+    udu_filter_init(&f, n, x, P);
+    fail_unless(udu_filter_update_sequential(&f, m, H, z, r) == 0,
+                "sequential update rejected");
+
+    /* Batch reference: K = P H^T (H P H^T + R)^-1 */
+    double Ht[UDU_FILTER_MAX_STATES * 6];
+    double PHt[UDU_FILTER_MAX_STATES * 6];
+    double S[6 * 6];
+    double Si[6 * 6];
+    double K[UDU_FILTER_MAX_STATES * 6];
+    double innov[6];
+    double dx[UDU_FILTER_MAX_STATES];
+    double KHP[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    matrix_transpose(m, n, H, Ht);
+    matrix_multiply(n, n, m, P, Ht, PHt);
+    matrix_multiply(m, n, m, H, PHt, S);
+    for (u32 i = 0; i < m; i++) {
+      S[i * m + i] += r[i];
+    }
+    fail_unless(matrix_inverse(m, S, Si) >= 0, "singular innovation cov");
+    matrix_multiply(n, m, m, PHt, Si, K);
+    matrix_multiply(m, n, 1, H, x, innov);
+    vector_subtract(m, z, innov, innov);
+    matrix_multiply(n, m, 1, K, innov, dx);
+    vector_add(n, x, dx, x);
+    double HP[6 * UDU_FILTER_MAX_STATES];
+    matrix_transpose(n, m, PHt, HP);
+    matrix_multiply(n, m, n, K, HP, KHP);
+    matrix_add_sc(n, n, P, KHP, -1, P);
+
+    double P_[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    udu_filter_get_covariance(&f, P_);
+    check_matrix_close(n, n, P_, P);
+    check_matrix_close(n, 1, f.x, x);
+  }
+}
+END_TEST
+
+START_TEST(test_udu_filter_update_reject) {
+  double x[2] = {1, 2};
+  double d[2] = {1, 1};
+  double h[2] = {1, 0};
+  udu_filter_t f;
+  udu_filter_init_diag(&f, 2, x, d);
+  fail_unless(udu_filter_update(&f, h, 1, 0) < 0, "zero variance accepted");
+  fail_unless(udu_filter_update(&f, h, NAN, 1) < 0, "NaN accepted");
+  fail_unless(f.x[0] == 1 && f.D[0] == 1, "rejected update changed state");
+}
+END_TEST
+
+START_TEST(test_udu_filter_predict) {
+  srand(4);
+  for (u32 t = 0; t < UDU_NUM; t++) {
+    u32 n = 1 + (u32)(rand() % UDU_FILTER_MAX_STATES);
+    u32 p = 1 + (u32)(rand() % UDU_FILTER_MAX_NOISE);
+    double x[UDU_FILTER_MAX_STATES];
+    double P[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    double Phi[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    double G[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_NOISE];
+    double Q[UDU_FILTER_MAX_NOISE];
+    arr_frand(n, -100, 100, x);
+    arr_frand(n * n, -1, 1, Phi);
+    arr_frand(n * p, -1, 1, G);
+    arr_frand(UDU_FILTER_MAX_NOISE, 0.1, 10, Q);
+    random_spd(n, P);
+
+    udu_filter_t f;
+    udu_filter_init(&f, n, x, P);
+    fail_unless(udu_filter_predict(&f, Phi, p, G, Q) == 0, "predict failed");
+
+    /* Reference: P = Phi P Phi^T + G Q G^T */
+    double tmp[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    double T[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    double Pr[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    double GQ[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_NOISE];
+    double Gt[UDU_FILTER_MAX_NOISE * UDU_FILTER_MAX_STATES];
+    double xr[UDU_FILTER_MAX_STATES];
+    matrix_transpose(n, n, Phi, T);
+    matrix_multiply(n, n, n, P, T, tmp);
+    matrix_multiply(n, n, n, Phi, tmp, Pr);
+    memcpy(GQ, G, n * p * sizeof(double));
+    matrix_multiply_diag_right(n, p, GQ, Q);
+    matrix_transpose(n, p, G, Gt);
+    matrix_multiply(n, p, n, GQ, Gt, tmp);
+    matrix_add_sc(n, n, Pr, tmp, 1, Pr);
+    matrix_multiply(n, n, 1, Phi, x, xr);
+
+    double P_[UDU_FILTER_MAX_STATES * UDU_FILTER_MAX_STATES];
+    udu_filter_get_covariance(&f, P_);
+    check_matrix_close(n, n, P_, Pr);
+    check_matrix_close(n, 1, f.x, xr);
+
+    /* Identity transition and noise input. */
+    udu_filter_init(&f, n, x, P);
+    fail_unless(udu_filter_predict(&f, NULL, n, NULL, Q) == 0,
+                "predict failed");
+    udu_filter_get_covariance(&f, P_);
+    for (u32 i = 0; i < n; i++) {
+      P[i * n + i] += Q[i];
+    }
+    check_matrix_close(n, n, P_, P);
+    check_matrix_close(n, 1, f.x, x);
+
+    if (n > 1) {
+      fail_unless(udu_filter_predict(&f, NULL, n - 1, NULL, Q) < 0,
+                  "mismatched identity noise input accepted");
+    }
+  }
+}
+END_TEST
+
+Suite *udu_filter_suite(void) {
+  Suite *s = suite_create("UDU filter");
+
+  TCase *tc_core = tcase_create("Core");
+  tcase_add_test(tc_core, test_udu_filter_init);
+  tcase_add_test(tc_core, test_udu_filter_update);
+  tcase_add_test(tc_core, test_udu_filter_update_sequential);
+  tcase_add_test(tc_core, test_udu_filter_update_reject);
+  tcase_add_test(tc_core, test_udu_filter_predict);
+  suite_add_tcase(s, tc_core);
+
+  return s;
+}